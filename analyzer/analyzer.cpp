@@ -1,49 +1,101 @@
 #include "analyzer.hpp"
 
+#include <cstdint>
 #include <unordered_set>
 #include <filesystem>
-#include <latch>
 
 #include "../common/preprocessing/preprocessing_libs.hpp"
 #include "../symbol-handling/scope-manager/scope_guard.hpp"
+#include "../thread-pool/task_group.hpp"
 #include "ctx/analyzer_ctx_guard.hpp"
 #include "return_checker.hpp"
 
-semantic::Analyzer::Analyzer(semantic::ScopeManager& scopeManager, util::concurrency::ThreadPool& threadPool)
-    : threadPool{ threadPool }, globalScopeManager{scopeManager} {}
+semantic::Analyzer::Analyzer(
+    semantic::FunctionTable& functionTable, util::concurrency::ThreadPool& threadPool,
+    util::concurrency::CancellationToken* cancellation
+)
+    : threadPool{ threadPool }, functionTable{ functionTable }, cancellation{ cancellation } {}
 
 thread_local semantic::AnalyzerThreadContext semantic::Analyzer::analyzerContext;
 
 void semantic::Analyzer::visit(syntax::ast::ASTProgram* program){
-    semanticErrors[globalError] = {};
+    if(!declareFunctions(program)){
+        return;
+    }
+
+    util::concurrency::parallelForByCost(threadPool, program->getFunctionCount(),
+        [program](size_t i) -> size_t {
+            const auto* function{ program->getFunctionAtN(i) };
+            return function->isPredefined() ? 0 : function->getCost();
+        },
+        [this, program](size_t i) -> void {
+            checkFunctionAt(program, i);
+        },
+        cancellation
+    );
 
-    // global scope
-    semantic::ScopeGuard scopeGuard{ globalScopeManager };
+    checkEntryPoint();
+}
+
+bool semantic::Analyzer::declareFunctions(syntax::ast::ASTProgram* program){
+    globalErrors.clear();
 
     for(const auto& dir : program->getDirs()){
-        dir->accept(*this);
+        visitNode(dir);
     }
 
-    for(const auto& function : program->getFunctions()){
-        checkFunctionSignature(function.get());
+    // every function owns the slot at its position, tasks fill their slots without locking
+    const auto& functions{ program->getFunctions() };
+    semanticErrors.clear();
+    semanticErrors.reserve(functions.size());
+    for(const auto& function : functions){
+        semanticErrors.push_back(FunctionErrors{ function->getSymbolId(), {} });
     }
 
-    if(hasSemanticErrors(program)) return;
-    
-    std::latch doneLatch{ static_cast<std::ptrdiff_t>(program->getFunctionCount()) };
-    for(const auto& function : program->getFunctions()){
-        threadPool.enqueue(
-            [this, function=function.get(), &doneLatch] -> void {
-                function->accept(*this);
-                doneLatch.count_down();
-            }
+    // redefinitions are reported in declaration order, regardless of the order they were registered in
+    const auto redefinitions{ functionTable.registerFunctions(functions, threadPool) };
+    for(const size_t redefinition : redefinitions){
+        const auto& function{ functions[redefinition] };
+        const auto& funcToken{ function->getToken() };
+        reportError(
+            funcToken, 
+            std::format(
+                "function redefined '{} {}'", 
+                typeToStr(function->getType()), funcToken.value()
+            ),
+            globalErrors
         );
     }
-    doneLatch.wait();
 
+    // signature of the redefinition is not checked, the first definition is the one in the function table
+    auto nextRedefinition{ redefinitions.begin() };
+    for(size_t i{ 0 }; i < functions.size(); ++i){
+        if(nextRedefinition != redefinitions.end() && *nextRedefinition == i){
+            ++nextRedefinition;
+            continue;
+        }
+        checkFunctionSignature(functions[i].get(), semanticErrors[i].errors);
+    }
+
+    return !hasSemanticErrors(program);
+}
+
+bool semantic::Analyzer::checkFunctionAt(syntax::ast::ASTProgram* program, size_t n){
+    // signature is all there is to check on a predefined function, its parameters were checked with it
+    const auto& function{ program->getFunctions()[n] };
+    if(!function->isPredefined()){
+        checkFunction(function.get(), semanticErrors[n].errors, n);
+    }
+    if(cancellation){
+        cancellation->finishItem(n);
+    }
+    return semanticErrors[n].errors.empty();
+}
+
+void semantic::Analyzer::checkEntryPoint(){
     // check if main exists
-    if(!globalScopeManager.lookupSymbol("main", {semantic::Kind::FUN})){
-        semanticErrors[globalError].emplace_back("'main' function not found");
+    if(!functionTable.lookup(util::text::StringInterner::intern("main"))){
+        globalErrors.emplace_back("'main' function not found");
     }
 }
 
@@ -56,30 +108,15 @@ void semantic::Analyzer::visit(syntax::ast::ASTIncludeDir* includeDir){
                 "unknown library '{}'", 
                 includeDir->getLibName()
             ),
-            globalError
+            globalErrors
         );
     }
 }
 
-void semantic::Analyzer::checkFunctionSignature(const syntax::ast::ASTFunction* function){
+void semantic::Analyzer::checkFunctionSignature(const syntax::ast::ASTFunction* function, std::vector<std::string>& errors){
     auto returnType{ function->getType() };
     const auto& funcToken{ function->getToken() };
-    semanticErrors[funcToken.value] = {};
-
-    // function redefinition check
-    if(!globalScopeManager.pushSymbol(
-        semantic::Symbol{funcToken.value, semantic::Kind::FUN, returnType}
-    )){
-        reportError(
-            funcToken, 
-            std::format(
-                "function redefined '{} {}'", 
-                typeToStr(returnType), funcToken.value
-            ),
-            globalError
-        );
-        return;
-    }
+    const auto funcId{ function->getSymbolId() };
 
     // function type check
     if(returnType == types::Type::NO_TYPE){
@@ -87,9 +124,9 @@ void semantic::Analyzer::checkFunctionSignature(const syntax::ast::ASTFunction*
             funcToken, 
             std::format(
                 "invalid type '{} {}'", 
-                typeToStr(returnType), funcToken.value
+                typeToStr(returnType), funcToken.value()
             ),
-            funcToken.value
+            errors
         );
     }
     else if(returnType == types::Type::AUTO){
@@ -97,60 +134,61 @@ void semantic::Analyzer::checkFunctionSignature(const syntax::ast::ASTFunction*
             funcToken, 
             std::format(
                 "type deduction cannot be performed on function '{} {}'", 
-                typeToStr(returnType), funcToken.value
+                typeToStr(returnType), funcToken.value()
             ),
-            funcToken.value
+            errors
         );
     }
 
-    semantic::SymbolTable symTab;
-    semantic::ScopeManager signatureScopeManager{symTab};
     semantic::AnalyzerContextGuard contextGuard{ 
         analyzerContext, 
-        funcToken.value, 
-        &signatureScopeManager 
+        funcId, 
+        &analyzerContext.functionScopeManager 
     };
 
     {
         semantic::ScopeGuard scopeGuard{ *analyzerContext.scopeManager };
         const auto& parameters{ function->getParameters() };
 
-        // pointer to parameters for easier function call type checking
-        globalScopeManager.getSymbol(funcToken.value).setParameters(&parameters);
-        
         // parameter check for main
-        if(funcToken.value == "main" && parameters.size() > 0){
+        if(funcToken.value() == "main" && parameters.size() > 0){
             const auto& paramToken{ parameters[0]->getToken() };
             reportError(
                 paramToken, 
                 "function 'main' cannot have any parameters",
-                funcToken.value
+                errors
             );
         }
 
         for(const auto& parameter : parameters){
-            parameter->accept(*this);
+            visitNode(parameter);
         }
     }
 
-    for(const auto& err : analyzerContext.semanticErrors){
-        semanticErrors[funcToken.value].push_back(err);
-    }
+    errors.insert(
+        errors.end(),
+        std::make_move_iterator(analyzerContext.semanticErrors.begin()),
+        std::make_move_iterator(analyzerContext.semanticErrors.end())
+    );
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTFunction* function){
+    // function checked on its own, outside of the program, gets the next slot
+    semanticErrors.push_back(FunctionErrors{ function->getSymbolId(), {} });
+    checkFunction(function, semanticErrors.back().errors);
+}
+
+void semantic::Analyzer::checkFunction(syntax::ast::ASTFunction* function, std::vector<std::string>& errors, size_t n){
     const auto& funcToken{ function->getToken() };
     const auto funcReturnType{ function->getType() };
 
-    semantic::SymbolTable symTab;
-    semantic::ScopeManager functionScopeManager{symTab};
-
-    // initializing thread context
+    // initializing thread context, symbols of the function live in the table of the thread
     semantic::AnalyzerContextGuard contextGuard{ 
         analyzerContext, 
-        funcToken.value, 
-        &functionScopeManager 
+        function->getSymbolId(), 
+        &analyzerContext.functionScopeManager 
     };
+    analyzerContext.functionIndex = n;
 
     {
         // function scope
@@ -158,20 +196,23 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunction* function){
         defineParameters(function);
         if(!function->isPredefined()){
             for(const auto& stmt : function->getBody()){
-                stmt->accept(*this);
+                if(isCancelled()){
+                    break;
+                }
+                visitNode(stmt);
             }
 
-            // function return type check
-            if(funcReturnType != types::Type::VOID){
+            // function return type check, body of the cancelled function is not checked whole
+            if(funcReturnType != types::Type::VOID && !isCancelled()){
                 semantic::ReturnChecker returnChecker;
-                function->accept(returnChecker);
+                returnChecker.visitNode(function);
 
                 if(!function->alwaysReturnsValue()){
                     reportError(
                         funcToken, 
                         std::format(
                             "function '{} {}' not all paths return value", 
-                            typeToStr(funcReturnType), funcToken.value
+                            typeToStr(funcReturnType), funcToken.value()
                         )
                     );
                 }
@@ -179,17 +220,14 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunction* function){
         }
     }
 
-    {
-        std::lock_guard<std::mutex> lock(errorMtx);
-        semanticErrors[funcToken.value] = std::move(analyzerContext.semanticErrors);
-    }
+    errors = std::move(analyzerContext.semanticErrors);
 }
 
 void semantic::Analyzer::defineParameters(const syntax::ast::ASTFunction* function){
     for(const auto& parameter : function->getParameters()){
         analyzerContext.scopeManager->pushSymbol(
             semantic::Symbol{
-                parameter->getToken().value, 
+                parameter->getSymbolId(), 
                 semantic::Kind::PAR, 
                 parameter->getType()
             }
@@ -206,7 +244,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTParameter* parameter){
             paramToken, 
             std::format(
                 "invalid type '{} {}'", 
-                typeToStr(paramType), paramToken.value
+                typeToStr(paramType), paramToken.value()
             )
         );
     }
@@ -215,20 +253,20 @@ void semantic::Analyzer::visit(syntax::ast::ASTParameter* parameter){
             paramToken, 
             std::format(
                 "type deduction cannot be performed on parameters '{} {}'", 
-                typeToStr(paramType), paramToken.value
+                typeToStr(paramType), paramToken.value()
             )
         );
     }
 
     // parameter redefinition check
     if(!analyzerContext.scopeManager->pushSymbol(
-        semantic::Symbol{paramToken.value, semantic::Kind::PAR, paramType}
+        semantic::Symbol{parameter->getSymbolId(), semantic::Kind::PAR, paramType}
     )){
         reportError(
             paramToken, 
             std::format(
                 "parameter redefined '{} {}'", 
-                typeToStr(paramType), paramToken.value
+                typeToStr(paramType), paramToken.value()
             )
         );
     }
@@ -243,7 +281,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTVariableDeclStmt* variableDecl){
             variableToken, 
             std::format(
                 "invalid type '{} {}'", 
-                typeToStr(variableType), variableToken.value
+                typeToStr(variableType), variableToken.value()
             )
         );
     }
@@ -252,20 +290,20 @@ void semantic::Analyzer::visit(syntax::ast::ASTVariableDeclStmt* variableDecl){
             variableToken, 
             std::format(
                 "type deduction failed '{} {}'", 
-                typeToStr(variableType), variableToken.value
+                typeToStr(variableType), variableToken.value()
             )
         );
     }
 
     // variable redefinition check
     if(!analyzerContext.scopeManager->pushSymbol(
-        semantic::Symbol{variableToken.value, semantic::Kind::VAR, variableType}
+        semantic::Symbol{variableDecl->getSymbolId(), semantic::Kind::VAR, variableType}
     )){
         reportError(
             variableToken, 
             std::format(
                 "variable redefined '{} {}'", 
-                typeToStr(variableType), variableToken.value
+                typeToStr(variableType), variableToken.value()
             )
         );
     }
@@ -273,7 +311,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTVariableDeclStmt* variableDecl){
     // direct initialization
     if(variableDecl->hasAssignExpr()){
         auto* assignExpr{ variableDecl->getAssignExpr() };
-        assignExpr->accept(*this);
+        visitNode(assignExpr);
 
         auto rtype{ assignExpr->getType() };
 
@@ -290,7 +328,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTVariableDeclStmt* variableDecl){
         }
 
         if(variableType == types::Type::AUTO){
-            analyzerContext.scopeManager->getSymbol(variableToken.value).setType(rtype);
+            analyzerContext.scopeManager->getSymbol(variableDecl->getSymbolId()).setType(rtype);
         }
     }
 }
@@ -299,8 +337,8 @@ void semantic::Analyzer::visit(syntax::ast::ASTAssignStmt* assignStmt){
     syntax::ast::ASTIdExpr* variableExpr{ assignStmt->getVariableIdExpr() };
     syntax::ast::ASTExpr* valueExpr{ assignStmt->getAssignedExpr() };
 
-    variableExpr->accept(*this);
-    valueExpr->accept(*this);
+    visitNode(variableExpr);
+    visitNode(valueExpr);
 
     if(variableExpr->getType() == types::Type::NO_TYPE || valueExpr->getType() == types::Type::NO_TYPE) return;
 
@@ -321,7 +359,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTAssignStmt* assignStmt){
 
     if(ltype == types::Type::AUTO){
         analyzerContext.scopeManager->getSymbol(
-            variableExpr->getToken().value
+            variableExpr->getSymbolId()
         ).setType(rtype);
     }
 }
@@ -329,25 +367,28 @@ void semantic::Analyzer::visit(syntax::ast::ASTAssignStmt* assignStmt){
 void semantic::Analyzer::visit(syntax::ast::ASTCompoundStmt* compoundStmt){
     semantic::ScopeGuard scopeGuard{ *analyzerContext.scopeManager };
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        if(isCancelled()){
+            break;
+        }
+        visitNode(stmt);
     }
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTForStmt* forStmt){
     if(forStmt->hasInitializerStmt()){
-        forStmt->getInitializerStmt()->accept(*this);
+        visitNode(forStmt->getInitializerStmt());
     }
     if(forStmt->hasConditionExpr()){
-        forStmt->getConditionExpr()->accept(*this);
+        visitNode(forStmt->getConditionExpr());
     }
     if(forStmt->hasIncrementerStmt()){
-        forStmt->getIncrementerStmt()->accept(*this);
+        visitNode(forStmt->getIncrementerStmt());
     }
-    forStmt->getStmt()->accept(*this);
+    visitNode(forStmt->getStmt());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallStmt* callStmt){
-    callStmt->getFunctionCallExpr()->accept(*this);
+    visitNode(callStmt->getFunctionCallExpr());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTIfStmt* ifStmt){
@@ -356,12 +397,12 @@ void semantic::Analyzer::visit(syntax::ast::ASTIfStmt* ifStmt){
 
     const size_t size{ conditions.size() };
     for(size_t i{0}; i < size; ++i){
-        conditions[i]->accept(*this);
-        stmts[i]->accept(*this);
+        visitNode(conditions[i]);
+        visitNode(stmts[i]);
     }
 
     if(ifStmt->hasElseStmt()){
-        stmts.back()->accept(*this);
+        visitNode(stmts.back());
     }
 }
 
@@ -370,7 +411,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTReturnStmt* returnStmt){
 
     if(returnStmt->hasReturnExpr()){
         auto* returnExpr{ returnStmt->getReturnExpr() };
-        returnExpr->accept(*this);
+        visitNode(returnExpr);
         returnType = returnExpr->getType();
     }
 
@@ -379,7 +420,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTReturnStmt* returnStmt){
 
     // return type check
     auto expectedReturnType{ 
-        globalScopeManager.getSymbol(analyzerContext.functionName).getType() 
+        functionTable.getFunction(analyzerContext.functionId).type 
     };
 
     if(returnType != expectedReturnType){
@@ -389,7 +430,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTReturnStmt* returnStmt){
             std::format(
                 "invalid return statement - type mismatch: '{} {}' returns '{}'", 
                 typeToStr(expectedReturnType), 
-                analyzerContext.functionName, 
+                util::text::StringInterner::name(analyzerContext.functionId), 
                 typeToStr(returnType)
             )
         );
@@ -397,25 +438,25 @@ void semantic::Analyzer::visit(syntax::ast::ASTReturnStmt* returnStmt){
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTWhileStmt* whileStmt){
-    whileStmt->getConditionExpr()->accept(*this);
-    whileStmt->getStmt()->accept(*this);
+    visitNode(whileStmt->getConditionExpr());
+    visitNode(whileStmt->getStmt());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTDoWhileStmt* dowhileStmt){
-    dowhileStmt->getStmt()->accept(*this);
-    dowhileStmt->getConditionExpr()->accept(*this);
+    visitNode(dowhileStmt->getStmt());
+    visitNode(dowhileStmt->getConditionExpr());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTSwitchStmt* switchStmt){
     auto* variableIdExpr{ switchStmt->getVariableIdExpr() };
-    variableIdExpr->accept(*this);
+    visitNode(variableIdExpr);
 
     auto variableIdExprType{ variableIdExpr->getType() };
     if(variableIdExprType == types::Type::NO_TYPE) return;
     
-    std::unordered_set<std::string> caseSet;
+    std::unordered_set<std::string_view> caseSet;
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this);
+        visitNode(caseStmt);
 
         const auto& caseToken{ caseStmt->getToken() };
 
@@ -435,39 +476,39 @@ void semantic::Analyzer::visit(syntax::ast::ASTSwitchStmt* switchStmt){
         }
 
         // duplicates
-        if(caseSet.find(literalExprToken.value) != caseSet.end()){
+        if(caseSet.find(literalExprToken.value()) != caseSet.end()){
             reportError(
                 caseToken, 
                 std::format(
                     "duplicate case '{}'", 
-                    literalExprToken.value
+                    literalExprToken.value()
                 )
             );
         }
-        caseSet.insert(literalExprToken.value);
+        caseSet.insert(literalExprToken.value());
     }
 
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
 
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTCaseStmt* caseStmt){
     auto* literalExpr{ caseStmt->getLiteralExpr() };
-    literalExpr->accept(*this);
+    visitNode(literalExpr);
     if(literalExpr->getType() == types::Type::NO_TYPE) return;
 
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getSwitchBlockStmt());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTDefaultStmt* defaultStmt){
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void semantic::Analyzer::visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt){
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
@@ -475,8 +516,8 @@ void semantic::Analyzer::visit(syntax::ast::ASTBinaryExpr* binaryExpr){
     auto* leftOperand{ binaryExpr->getLeftOperandExpr() };
     auto* rightOperand{ binaryExpr->getRightOperandExpr() };
 
-    leftOperand->accept(*this);
-    rightOperand->accept(*this);
+    visitNode(leftOperand);
+    visitNode(rightOperand);
 
     auto ltype{ leftOperand->getType() };
     auto rtype{ rightOperand->getType() };
@@ -497,16 +538,14 @@ void semantic::Analyzer::visit(syntax::ast::ASTBinaryExpr* binaryExpr){
 void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
     const auto& callExprToken{  callExpr->getToken() };
 
-    const auto* callExprSymbol{ 
-        globalScopeManager.lookupSymbol(callExprToken.value, {semantic::Kind::FUN}) 
-    };
+    const auto* callee{ functionTable.lookup(callExpr->getSymbolId()) };
 
-    if(!callExprSymbol){
+    if(!callee){
         reportError(
             callExprToken, 
             std::format(
                 "undefined function '{}'", 
-                callExprToken.value
+                callExprToken.value()
             )
         );
         // function doesn't exist, no point checking arguments
@@ -514,7 +553,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
     }
 
     // main function can't be called
-    if(callExprToken.value == "main"){
+    if(callExprToken.value() == "main"){
         reportError(
             callExprToken, 
             "'main' is not callable function"
@@ -522,18 +561,18 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
         return;
     }
 
-    const auto* callExprParams{ callExprSymbol->getParameters() };
-    callExpr->setType(callExprSymbol->getType());
+    const auto parameterTypes{ functionTable.getParameterTypes(*callee) };
+    callExpr->setType(callee->type);
 
     // comparison of given parameter count with expected parameter count
     size_t providedParams{ callExpr->getArgumentCount() };
-    size_t expectedParams{ callExprParams->size() };
+    size_t expectedParams{ parameterTypes.size() };
     if(providedParams != expectedParams){
         reportError(
             callExprToken, 
             std::format(
                 "invalid function call '{}': provided arguments '{}', expected '{}'", 
-                callExprToken.value, providedParams, expectedParams
+                callExprToken.value(), providedParams, expectedParams
             )
         );
         return; // number of provided arguments differs from expected, no type checking
@@ -542,11 +581,11 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
     const auto& arguments{ callExpr->getArguments() };
     for(size_t i{0}; i < providedParams; ++i){
         const auto& arg{ arguments[i] };
-        arg->accept(*this);
+        visitNode(arg);
 
         // type check of corresponding parameters in function and function call
         auto ltype{ arg->getType() };
-        auto rtype{ (*callExprParams)[i]->getType() };
+        auto rtype{ parameterTypes[i] };
 
         // no point checking for types if argument is invalid
         if(ltype == types::Type::NO_TYPE) continue;
@@ -557,7 +596,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
                 argToken, 
                 std::format(
                     "invalid argument {} - type mismatch: expected '{}', got '{} {}'", 
-                    i, typeToStr(rtype), typeToStr(ltype), argToken.value
+                    i, typeToStr(rtype), typeToStr(ltype), argToken.value()
                 )
             );
         }
@@ -570,7 +609,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTIdExpr* idExpr){
     // check if id exists
     const auto* idExprSymbol{ 
         analyzerContext.scopeManager->lookupSymbol(
-            idExprToken.value, {semantic::Kind::VAR, semantic::Kind::PAR}
+            idExpr->getSymbolId(), {semantic::Kind::VAR, semantic::Kind::PAR}
         ) 
     };
 
@@ -579,7 +618,7 @@ void semantic::Analyzer::visit(syntax::ast::ASTIdExpr* idExpr){
             idExprToken, 
             std::format(
                 "undefined variable '{}'", 
-                idExprToken.value
+                idExprToken.value()
             )
         );
         idExpr->setType(types::Type::NO_TYPE);
@@ -592,18 +631,18 @@ void semantic::Analyzer::visit(syntax::ast::ASTLiteralExpr* literalExpr){
     const auto& literalExprToken{ literalExpr->getToken() };
 
     // invalid literal check
-    if(isInvalidLiteral(literalExpr->getType(), literalExprToken.value)){
+    if(isInvalidLiteral(literalExpr->getType(), literalExprToken.value())){
         reportError(
             literalExprToken, 
             std::format(
                 "invalid literal '{}'", 
-                literalExprToken.value
+                literalExprToken.value()
             )
         );
     }
 }
 
-bool semantic::Analyzer::isInvalidLiteral(types::Type type, const std::string& value) const {
+bool semantic::Analyzer::isInvalidLiteral(types::Type type, std::string_view value) const {
     if (value.empty()) [[unlikely]] return true;
 
     const char last{ value.back() };
@@ -624,42 +663,39 @@ bool semantic::Analyzer::isInvalidLiteral(types::Type type, const std::string& v
 bool semantic::Analyzer::hasSemanticErrors(
     const syntax::ast::ASTProgram* program
 ) const noexcept {
-    for(const auto& function : program->getFunctions()){
-        const std::string& funcName{ function->getToken().value };
-        if(!semanticErrors.at(funcName).empty()){
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        if(!semanticErrors[i].errors.empty()){
             return true;
         }   
     }
     
-    if(!semanticErrors.at(globalError).empty()){
-        return true;
-    }
-
-    return false;
+    return !globalErrors.empty();
 }
 
 std::string semantic::Analyzer::getSemanticErrors(
     const syntax::ast::ASTProgram* program
 ) const noexcept {
-    if(semanticErrors.empty()){
-        return "";
-    }
-
     std::stringstream errors{"Semantic check failed:\n"};
     size_t errLen{ errors.str().length() };
 
-    for(const auto& function : program->getFunctions()){
-        const std::string& funcName{ function->getToken().value };
-        if(!semanticErrors.at(funcName).empty()){
-            for(const auto& error : semanticErrors.at(funcName)){
-                errors << error << "\n";
+    // errors past the limit are dropped, functions past the first ones reaching the limit are the only ones stopped,
+    // so the kept errors are the same whatever functions were checked first
+    size_t remaining{ cancellation && cancellation->getMaxErrors() != 0 ? cancellation->getMaxErrors() : SIZE_MAX };
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        for(const auto& error : semanticErrors[i].errors){
+            if(remaining == 0){
+                break;
             }
+            errors << error << "\n";
+            --remaining;
         }
     }
-    if(!semanticErrors.at(globalError).empty()){
-        for(const auto& error : semanticErrors.at(globalError)){
-            errors << error << "\n";
+    for(const auto& error : globalErrors){
+        if(remaining == 0){
+            break;
         }
+        errors << error << "\n";
+        --remaining;
     }
 
     std::string strErrors{ errors.str() }; 
@@ -2,13 +2,11 @@
 #define ANALYZER_HPP
 
 #include <format>
-#include <unordered_map>
 #include <string>
 #include <string_view>
 #include <vector>
-#include <mutex>
 
-#include "../common/visitor/ast_visitor.hpp"
+#include "../common/visitor/ast_static_visitor.hpp"
 #include "../common/abstract-syntax-tree/ast_program.hpp"
 #include "../common/abstract-syntax-tree/ast_include_dir.hpp"
 #include "../common/abstract-syntax-tree/ast_function.hpp"
@@ -31,8 +29,11 @@
 #include "../common/abstract-syntax-tree/ast_id_expr.hpp"
 #include "../common/abstract-syntax-tree/ast_literal_expr.hpp"
 #include "../symbol-handling/scope-manager/scope_manager.hpp"
+#include "../symbol-handling/function-table/function_table.hpp"
+#include "../common/symbol/string_interner.hpp"
 #include "ctx/analyzer_ctx.hpp"
 #include "../thread-pool/thread_pool.hpp"
+#include "../thread-pool/cancellation_token.hpp"
 
 /**
  * @namespace semantic
@@ -43,140 +44,166 @@ namespace semantic {
      * @class Analyzer
      * @brief performs semantic analysis of the ast
     */
-    class Analyzer : public syntax::ast::ASTVisitor {
+    class Analyzer : public syntax::ast::ASTStaticVisitor<Analyzer> {
     public:
         /**
          * @brief creates the instance of the analyzer
-         * @param scopeManager - reference to the scope manager
+         * @param functionTable - reference to the table the functions of the program are registered in
          * @param threadPool - reference to a thread pool
+         * @param cancellation - pointer to the token errors are reported to, analysis stops once it is set, nullptr for none
         */
-        Analyzer(ScopeManager& scopeManager, util::concurrency::ThreadPool& threadPool);
+        Analyzer(
+            FunctionTable& functionTable, util::concurrency::ThreadPool& threadPool,
+            util::concurrency::CancellationToken* cancellation = nullptr
+        );
 
         /**
          * @brief performs semantic analysis of the program
          * @param program - pointer to the program
         */
-        void visit(syntax::ast::ASTProgram* program) override;
+        void visit(syntax::ast::ASTProgram* program);
+
+        /**
+         * @brief checks the directives and the signatures of the functions, registering them in the function table
+         * @param program - pointer to the program
+         * @returns true if the bodies of the functions can be checked, false if the program already has errors
+         * @note function table is only read after it
+        */
+        bool declareFunctions(syntax::ast::ASTProgram* program);
+
+        /**
+         * @brief performs semantic analysis of the body of the function
+         * @param program - pointer to the program
+         * @param n - position of the function in the program
+         * @returns true if no errors were caught in the function, false otherwise
+         * @note functions at different positions may be checked concurrently once they are declared
+        */
+        bool checkFunctionAt(syntax::ast::ASTProgram* program, size_t n);
+
+        /**
+         * @brief checks if the program has the entry point
+        */
+        void checkEntryPoint();
 
         /**
          * @brief performs semantic analysis of the include directive
          * @param includeDir - pointer to the include directive
         */
-        void visit(syntax::ast::ASTIncludeDir* includeDir) override;
+        void visit(syntax::ast::ASTIncludeDir* includeDir);
 
         /**
          * @brief performs semantic analysis of the function
          * @param function - pointer to the function
         */
-        void visit(syntax::ast::ASTFunction* function) override;
+        void visit(syntax::ast::ASTFunction* function);
 
         /**
          * @brief performs semantic analysis of the parameter
          * @param parameter - pointer to the parameter
         */
-        void visit(syntax::ast::ASTParameter* parameter) override;
+        void visit(syntax::ast::ASTParameter* parameter);
 
         /**
          * @brief performs semantic analysis of the variable declaration
          * @param variableDecl - pointer to the variable declaration
         */
-        void visit(syntax::ast::ASTVariableDeclStmt* variableDecl) override;
+        void visit(syntax::ast::ASTVariableDeclStmt* variableDecl);
 
         /**
          * @brief performs semantic analysis of the assignment statement
          * @param assignStmt - pointer to the assignment statement
         */
-        void visit(syntax::ast::ASTAssignStmt* assignStmt) override;
+        void visit(syntax::ast::ASTAssignStmt* assignStmt);
 
         /**
          * @brief performs semantic analysis of the compound statement
          * @param compoundStmt - pointer to the compound statement
         */
-        void visit(syntax::ast::ASTCompoundStmt* compoundStmt) override;
+        void visit(syntax::ast::ASTCompoundStmt* compoundStmt);
 
         /**
          * @brief performs semantic analysis of the for statement
          * @param forStmt - pointer to the for statement
         */
-        void visit(syntax::ast::ASTForStmt* forStmt) override;
+        void visit(syntax::ast::ASTForStmt* forStmt);
 
         /**
          * @brief performs semantic analysis of the function call statement
          * @param callStmt - pointer to the function call statement
         */
-        void visit(syntax::ast::ASTFunctionCallStmt* callStmt) override;
+        void visit(syntax::ast::ASTFunctionCallStmt* callStmt);
 
         /**
          * @brief performs semantic analysis of the if statement
          * @param ifStmt - pointer to the if statement
         */
-        void visit(syntax::ast::ASTIfStmt* ifStmt) override;
+        void visit(syntax::ast::ASTIfStmt* ifStmt);
 
         /**
          * @brief performs semantic analysis of the return statement
          * @param returnStmt - pointer to the return statement
         */
-        void visit(syntax::ast::ASTReturnStmt* returnStmt) override;
+        void visit(syntax::ast::ASTReturnStmt* returnStmt);
 
         /**
          * @brief performs semantic analysis of the while statement
          * @param whileStmt - pointer to the while statement
         */
-        void visit(syntax::ast::ASTWhileStmt* whileStmt) override;
+        void visit(syntax::ast::ASTWhileStmt* whileStmt);
 
         /**
          * @brief performs semantic analysis of the do-while statement
          * @param dowhileStmt - pointer to the do-while statement
         */
-        void visit(syntax::ast::ASTDoWhileStmt* dowhileStmt) override;
+        void visit(syntax::ast::ASTDoWhileStmt* dowhileStmt);
         
         /**
          * @brief performs semantic analysis of the switch statement
          * @param switchStmt - pointer to the switch statement
         */
-        void visit(syntax::ast::ASTSwitchStmt* switchStmt) override;
+        void visit(syntax::ast::ASTSwitchStmt* switchStmt);
 
         /**
          * @brief performs semantic analysis of the case statement
          * @param caseStmt - pointer to the case statement
         */
-        void visit(syntax::ast::ASTCaseStmt* caseStmt) override;
+        void visit(syntax::ast::ASTCaseStmt* caseStmt);
 
         /**
          * @brief performs semantic analysis of the default statement
          * @param defaultStmt - pointer to the default statement
         */
-        void visit(syntax::ast::ASTDefaultStmt* defaultStmt) override;
+        void visit(syntax::ast::ASTDefaultStmt* defaultStmt);
         
         /**
          * @brief performs semantic analysis of the switch-block statement
          * @param switchBlockStmt - pointer to the switch-block statement
         */
-        void visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt) override;
+        void visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt);
 
         /**
          * @brief performs semantic analysis of the binary expression
          * @param binaryExpr - pointer to the binary expression
         */
-        void visit(syntax::ast::ASTBinaryExpr* binaryExpr) override;
+        void visit(syntax::ast::ASTBinaryExpr* binaryExpr);
 
         /**
          * @brief performs semantic analysis of the function call expression
          * @param callExpr - pointer to the function call expression
         */
-        void visit(syntax::ast::ASTFunctionCallExpr* callExpr) override;
+        void visit(syntax::ast::ASTFunctionCallExpr* callExpr);
 
         /**
          * @brief performs semantic analysis of the id expression
          * @param idExpr - pointer to the id expression
         */
-        void visit(syntax::ast::ASTIdExpr* idExpr) override;
+        void visit(syntax::ast::ASTIdExpr* idExpr);
 
         /**
          * @brief performs semantic analysis of the literal expression
          * @param literalExpr - pointer to the literal expression
         */
-        void visit(syntax::ast::ASTLiteralExpr* literalExpr) override;
+        void visit(syntax::ast::ASTLiteralExpr* literalExpr);
 
         /**
          * @brief checks if program has semantic errors or not
@@ -188,15 +215,24 @@ namespace semantic {
         /**
          * @brief merges semantic errors into a single message
          * @param program - const pointer to the program
-         * @returns formatted errors
+         * @returns formatted errors, at most the error limit of the cancellation token
         */
         std::string getSemanticErrors(const syntax::ast::ASTProgram* program) const noexcept;
 
         /**
          * @brief performs semantic analysis of the signature of the function
          * @param function - const pointer to the function
+         * @param errors - reference to the errors of the function
+        */
+        void checkFunctionSignature(const syntax::ast::ASTFunction* function, std::vector<std::string>& errors);
+
+        /**
+         * @brief performs semantic analysis of the function
+         * @param function - pointer to the function
+         * @param errors - reference to the errors of the function, replaced by the errors caught in the function
+         * @param n - position of the function in the program, SIZE_MAX for the function checked on its own
         */
-        void checkFunctionSignature(const syntax::ast::ASTFunction* function);
+        void checkFunction(syntax::ast::ASTFunction* function, std::vector<std::string>& errors, size_t n = SIZE_MAX);
 
         /**
          * @brief defines parameters in the function's scope
@@ -205,9 +241,6 @@ namespace semantic {
         void defineParameters(const syntax::ast::ASTFunction* function);
 
     private:
-        /// mutex for semantic errors
-        std::mutex errorMtx;
-
         /// thread pool for parallel function code analysis
         util::concurrency::ThreadPool& threadPool;
 
@@ -216,7 +249,7 @@ namespace semantic {
          * @param type - type of the literal
          * @param value - value of the literal
         */
-        bool isInvalidLiteral(types::Type type, const std::string& value) const;
+        bool isInvalidLiteral(types::Type type, std::string_view value) const;
 
         /**
          * @brief reports new semantic error
@@ -227,18 +260,48 @@ namespace semantic {
             analyzerContext.semanticErrors.emplace_back(
                 formattedError(token, message)
             );
+            reportErrorCount();
         }
 
         /**
          * @brief reports new semantic error
          * @param token - const reference to a token that caused error
          * @param message - error message
-         * @param errorIdentifier - global error or name of the function where error occured
+         * @param errors - reference to the global errors or to the errors of the function where error occured
         */
-        inline void reportError(const syntax::Token& token, std::string_view message, const std::string& errorIdentifier){
-            semanticErrors[errorIdentifier].emplace_back(
+        inline void reportError(const syntax::Token& token, std::string_view message, std::vector<std::string>& errors){
+            errors.emplace_back(
                 formattedError(token, message)
             );
+            reportErrorCount();
+        }
+
+        /**
+         * @brief reports the new error to the cancellation token, for the analyzed function if there is one
+        */
+        inline void reportErrorCount(){
+            if(!cancellation){
+                return;
+            }
+            if(analyzerContext.functionIndex != SIZE_MAX){
+                cancellation->reportErrors(analyzerContext.functionIndex, 1);
+            }
+            else{
+                cancellation->reportErrors(1);
+            }
+        }
+
+        /**
+         * @brief checks if the analysis should stop at the next statement
+         * @returns true if the cancellation token stops the analyzed function, false otherwise
+        */
+        inline bool isCancelled() const noexcept {
+            if(!cancellation){
+                return false;
+            }
+            return analyzerContext.functionIndex != SIZE_MAX
+                ? cancellation->isCancelled(analyzerContext.functionIndex)
+                : cancellation->isCancelled();
         }
 
         /**
@@ -249,7 +312,7 @@ namespace semantic {
         inline std::string formattedError(const syntax::Token& token, std::string_view message){
             return std::format(
                 "Line {}, Column {}: SEMANTIC ERROR -> {}",
-                token.line, token.column, message
+                token.line(), token.column(), message
             );
         }
 
@@ -257,14 +320,32 @@ namespace semantic {
         /// thread local context of the function
         static thread_local AnalyzerThreadContext analyzerContext;
 
-        /// scope manager containing function declarations
-        ScopeManager& globalScopeManager;
+        /// table of the functions of the program, only read while the functions are checked
+        FunctionTable& functionTable;
+
+        /// token the errors are reported to, null for none
+        util::concurrency::CancellationToken* cancellation;
+
+        /**
+         * @struct FunctionErrors
+         * @brief errors caught in the function
+        */
+        struct FunctionErrors {
+            /// interned name of the function
+            util::text::SymbolId functionId;
+
+            /// errors of the function
+            std::vector<std::string> errors;
+        };
+
+        /// errors of the functions, indexed by the position of the function in the program
+        std::vector<FunctionErrors> semanticErrors;
 
-        /// maps errors to the function or global scope
-        std::unordered_map<std::string, std::vector<std::string>> semanticErrors;
+        /// errors that don't belong to a single function
+        std::vector<std::string> globalErrors;
 
-        /// global error label
-        static constexpr const char* globalError{ "__global" };
+        /// global error label, functions are never unnamed so the empty name can't clash with them
+        static constexpr util::text::SymbolId globalError{ util::text::StringInterner::emptyId };
 
     };
 
@@ -1,9 +1,12 @@
 #ifndef ANALYZER_CTX_HPP
 #define ANALYZER_CTX_HPP
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "../../symbol-handling/scope-manager/scope_manager.hpp"
+#include "../../common/symbol/string_interner.hpp"
 
 namespace semantic {
     /** 
@@ -11,22 +14,31 @@ namespace semantic {
      * @brief context of the thread checking semantic of the function
     */
     struct AnalyzerThreadContext {
-        /// name of the function analyzed by the thread
-        std::string functionName{""};
+        /// interned name of the function analyzed by the thread
+        util::text::SymbolId functionId{ util::text::StringInterner::emptyId };
+
+        /// position of the analyzed function in the program, SIZE_MAX for the function checked on its own
+        size_t functionIndex{ SIZE_MAX };
 
         /// pointer to the function scope manager
         ScopeManager* scopeManager{nullptr};
+
+        /// symbols of the analyzed function, the table is reused by every function the thread analyzes
+        SymbolTable functionSymbolTable;
+
+        /// scope manager over the symbols of the analyzed function
+        ScopeManager functionScopeManager{ functionSymbolTable };
         
         /// vector for exception messages
         std::vector<std::string> semanticErrors;
 
         /** 
          * @brief initializes the context of the thread
-         * @param funcName - name of the function
+         * @param funcId - interned name of the function
          * @param scopeMng - pointer to the scope manager
         */
-        void init(std::string_view funcName, ScopeManager* scopeMng){
-            functionName = funcName;
+        void init(util::text::SymbolId funcId, ScopeManager* scopeMng){
+            functionId = funcId;
             scopeManager = scopeMng;
         }
 
@@ -34,9 +46,11 @@ namespace semantic {
          * @brief resets the context of the thread
         */
         void reset(){
-            functionName = "";
+            functionId = util::text::StringInterner::emptyId;
+            functionIndex = SIZE_MAX;
             scopeManager = nullptr;
             semanticErrors.clear();
+            functionScopeManager.clear();
         }
     };
 
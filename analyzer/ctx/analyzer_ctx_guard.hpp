@@ -1,8 +1,6 @@
 #ifndef ANALYZER_CTX_GUARD_HPP
 #define ANALYZER_CTX_GUARD_HPP
 
-#include <string_view>
-
 #include "analyzer_ctx.hpp"
 
 namespace semantic {
@@ -15,16 +13,16 @@ namespace semantic {
         /**
          * @brief creates the instance of the analyzer context guard
          * @param ctx - reference to a thread context
-         * @param functionName - name of the current function
+         * @param functionId - interned name of the current function
          * @param scopeManager - pointer to a scope manager
          * @details initializes the context
         */
         AnalyzerContextGuard(
             AnalyzerThreadContext& ctx,
-            std::string_view functionName,
+            util::text::SymbolId functionId,
             ScopeManager* scopeManager
         ) : ctx(ctx) {
-            ctx.init(functionName, scopeManager);
+            ctx.init(functionId, scopeManager);
         }
 
         /**
@@ -4,7 +4,7 @@ void semantic::ReturnChecker::visit(syntax::ast::ASTFunction* function){
     alwaysReturns = false;
 
     for(const auto& stmt : function->getBody()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             function->setAlwaysReturns(true);
             return;
@@ -15,7 +15,7 @@ void semantic::ReturnChecker::visit(syntax::ast::ASTFunction* function){
 void semantic::ReturnChecker::visit(syntax::ast::ASTCompoundStmt* compoundStmt){
     alwaysReturns = false;
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             return;
         }
@@ -27,7 +27,7 @@ void semantic::ReturnChecker::visit(syntax::ast::ASTIfStmt* ifStmt){
 
     for(const auto& stmt : ifStmt->getStmts()){
         alwaysReturns = false;
-        stmt->accept(*this);
+        visitNode(stmt);
         ifStmtAlwaysReturns = ifStmtAlwaysReturns && alwaysReturns;
     }
     alwaysReturns = ifStmtAlwaysReturns && ifStmt->hasElseStmt();
@@ -39,37 +39,37 @@ void semantic::ReturnChecker::visit([[maybe_unused]] syntax::ast::ASTReturnStmt*
 
 void semantic::ReturnChecker::visit(syntax::ast::ASTDoWhileStmt* dowhileStmt){
     alwaysReturns = false;
-    dowhileStmt->getStmt()->accept(*this);
+    visitNode(dowhileStmt->getStmt());
 }
 
 void semantic::ReturnChecker::visit(syntax::ast::ASTSwitchStmt* switchStmt){
     bool switchStmtAlwaysReturns{ true };
 
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this); 
+        visitNode(caseStmt); 
         switchStmtAlwaysReturns = switchStmtAlwaysReturns && 
             (alwaysReturns || (!alwaysReturns && !caseStmt->hasBreakStmt()));
     }
     switchStmtAlwaysReturns = switchStmtAlwaysReturns && switchStmt->hasDefaultStmt();
     
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
     alwaysReturns = switchStmtAlwaysReturns && alwaysReturns;
 }
 
 void semantic::ReturnChecker::visit(syntax::ast::ASTCaseStmt* caseStmt){
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getSwitchBlockStmt());
 }
 
 void semantic::ReturnChecker::visit(syntax::ast::ASTDefaultStmt* defaultStmt){
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void semantic::ReturnChecker::visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt){
     alwaysReturns = false;
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             return;
         }
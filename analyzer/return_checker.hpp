@@ -1,7 +1,7 @@
 #ifndef RETURN_CHECKER_HPP
 #define RETURN_CHECKER_HPP
 
-#include "../common/visitor/ast_visitor.hpp"
+#include "../common/visitor/ast_static_visitor.hpp"
 #include "../common/abstract-syntax-tree/ast_program.hpp"
 #include "../common/abstract-syntax-tree/ast_include_dir.hpp"
 #include "../common/abstract-syntax-tree/ast_function.hpp"
@@ -29,133 +29,133 @@ namespace semantic {
      * @class ReturnChecker
      * @brief checks if the node returns always or not
     */
-    class ReturnChecker final : public syntax::ast::ASTVisitor {
+    class ReturnChecker final : public syntax::ast::ASTStaticVisitor<ReturnChecker> {
     public:
         /**
          * @brief intentionally empty, cannot return
          * @param program - pointer to the program
         */
-        void visit([[maybe_unused]] syntax::ast::ASTProgram* program) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTProgram* program) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param includeDir - pointer to the include directive
         */
-        void visit([[maybe_unused]] syntax::ast::ASTIncludeDir* includeDir) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTIncludeDir* includeDir) { /*empty*/ };
 
         /**
          * @brief checks if the function always returns
          * @param function - pointer to the function
         */
-        void visit(syntax::ast::ASTFunction* function) override;
+        void visit(syntax::ast::ASTFunction* function);
 
         /**
          * @brief intentionally empty, cannot return
          * @param parameter - pointer to the parameter
         */
-        void visit([[maybe_unused]] syntax::ast::ASTParameter* parameter) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTParameter* parameter) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param variableDecl - pointer to the variable declaration
         */
-        void visit([[maybe_unused]] syntax::ast::ASTVariableDeclStmt* variableDecl) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTVariableDeclStmt* variableDecl) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param assignStmt - pointer to the assignment statement
         */
-        void visit([[maybe_unused]] syntax::ast::ASTAssignStmt* assignStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTAssignStmt* assignStmt) { /*empty*/ };
 
         /**
          * @brief checks if the compound statement always returns
          * @param compoundStmt - pointer to the compound statement
         */
-        void visit(syntax::ast::ASTCompoundStmt* compoundStmt) override;
+        void visit(syntax::ast::ASTCompoundStmt* compoundStmt);
 
         /**
          * @brief intentionally empty, cannot evaluate the condition at compile-time at the moment
          * @param forStmt - pointer to the for statement
         */
-        void visit([[maybe_unused]] syntax::ast::ASTForStmt* forStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTForStmt* forStmt) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param callStmt - pointer to the function call statement
         */
-        void visit([[maybe_unused]] syntax::ast::ASTFunctionCallStmt* callStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTFunctionCallStmt* callStmt) { /*empty*/ };
 
         /**
          * @brief checks if the if-statement always returns
          * @param ifStmt - pointer to the if statement
         */
-        void visit(syntax::ast::ASTIfStmt* ifStmt) override;
+        void visit(syntax::ast::ASTIfStmt* ifStmt);
 
         /**
          * @brief always returns
          * @param returnStmt - pointer to the return statement
         */
-        void visit([[maybe_unused]] syntax::ast::ASTReturnStmt* returnStmt) override;
+        void visit([[maybe_unused]] syntax::ast::ASTReturnStmt* returnStmt);
 
         /**
          * @brief intentionally empty, cannot evaluate the condition at compile-time at the moment
          * @param whileStmt - pointer to the while statement
         */
-        void visit([[maybe_unused]] syntax::ast::ASTWhileStmt* whileStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTWhileStmt* whileStmt) { /*empty*/ };
 
         /**
          * @brief checks if the do-while statement always returns
          * @param dowhileStmt - pointer to the do-while statement
         */
-        void visit(syntax::ast::ASTDoWhileStmt* dowhileStmt) override;
+        void visit(syntax::ast::ASTDoWhileStmt* dowhileStmt);
         
         /**
          * @brief checks if the switch statement always returns
          * @param switchStmt - pointer to the switch statement
         */
-        void visit(syntax::ast::ASTSwitchStmt* switchStmt) override;
+        void visit(syntax::ast::ASTSwitchStmt* switchStmt);
 
         /**
          * @brief checks if the case statement always returns
          * @param caseStmt - pointer to the case statement
         */
-        void visit(syntax::ast::ASTCaseStmt* caseStmt) override;
+        void visit(syntax::ast::ASTCaseStmt* caseStmt);
 
         /**
          * @brief checks if the default statement always returns
          * @param defaultStmt - pointer to the default statement
         */
-        void visit(syntax::ast::ASTDefaultStmt* defaultStmt) override;
+        void visit(syntax::ast::ASTDefaultStmt* defaultStmt);
         
         /**
          * @brief checks if the switch-block statement always returns
          * @param switchBlockStmt - pointer to the switch-block statement
         */
-        void visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt) override;
+        void visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt);
 
         /**
          * @brief intentionally empty, cannot return
          * @param binaryExpr - pointer to the binary expression
         */
-        void visit([[maybe_unused]] syntax::ast::ASTBinaryExpr* binaryExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTBinaryExpr* binaryExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param callExpr - pointer to the function call expression
         */
-        void visit([[maybe_unused]] syntax::ast::ASTFunctionCallExpr* callExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTFunctionCallExpr* callExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param idExpr - pointer to the id expression
         */
-        void visit([[maybe_unused]] syntax::ast::ASTIdExpr* idExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTIdExpr* idExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param literalExpr - pointer to the literal expression
         */
-        void visit([[maybe_unused]] syntax::ast::ASTLiteralExpr* literalExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] syntax::ast::ASTLiteralExpr* literalExpr) { /*empty*/ };
 
     private:
         /// flag if node returns or not
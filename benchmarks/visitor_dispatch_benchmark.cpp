@@ -0,0 +1,271 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "../lexer/lexer.hpp"
+#include "../parser/parser.hpp"
+#include "../parser/token_consumer.hpp"
+#include "../common/visitor/ast_visitor.hpp"
+#include "../common/visitor/ast_static_visitor.hpp"
+
+/**
+ * @brief microbenchmark comparing virtual accept with the switch dispatch of the static visitor
+ * @details both counters walk the same tree with the same traversal, they differ only in the dispatch
+*/
+namespace {
+    using namespace syntax::ast;
+
+    /// number of generated functions
+    constexpr size_t functionCount{ 2000 };
+
+    /// number of times the function body is repeated
+    constexpr size_t bodyRepeat{ 8 };
+
+    /// number of timed walks of the tree
+    constexpr size_t walkCount{ 20 };
+
+    /**
+     * @class NodeCounter
+     * @brief counts the nodes of the tree
+     * @tparam isStatic - true to dispatch through the static visitor, false to dispatch through accept
+    */
+    template<bool isStatic>
+    class NodeCounter final : public std::conditional_t<isStatic, ASTStaticVisitor<NodeCounter<isStatic>>, ASTVisitor> {
+    public:
+        /// number of visited nodes
+        size_t count{ 0 };
+
+        void visit(ASTProgram* program){
+            ++count;
+            for(const auto& dir : program->getDirs()){
+                descend(dir);
+            }
+            for(const auto& function : program->getFunctions()){
+                descend(function);
+            }
+        }
+
+        void visit([[maybe_unused]] ASTIncludeDir* includeDir){
+            ++count;
+        }
+
+        void visit(ASTFunction* function){
+            ++count;
+            for(const auto& parameter : function->getParameters()){
+                descend(parameter);
+            }
+            for(const auto& stmt : function->getBody()){
+                descend(stmt);
+            }
+        }
+
+        void visit([[maybe_unused]] ASTParameter* parameter){
+            ++count;
+        }
+
+        void visit(ASTVariableDeclStmt* variableDecl){
+            ++count;
+            if(variableDecl->hasAssignExpr()){
+                descend(variableDecl->getAssignExpr());
+            }
+        }
+
+        void visit(ASTAssignStmt* assignStmt){
+            ++count;
+            descend(assignStmt->getVariableIdExpr());
+            descend(assignStmt->getAssignedExpr());
+        }
+
+        void visit(ASTCompoundStmt* compoundStmt){
+            ++count;
+            for(const auto& stmt : compoundStmt->getStmts()){
+                descend(stmt);
+            }
+        }
+
+        void visit(ASTForStmt* forStmt){
+            ++count;
+            if(forStmt->hasInitializerStmt()){
+                descend(forStmt->getInitializerStmt());
+            }
+            if(forStmt->hasConditionExpr()){
+                descend(forStmt->getConditionExpr());
+            }
+            if(forStmt->hasIncrementerStmt()){
+                descend(forStmt->getIncrementerStmt());
+            }
+            descend(forStmt->getStmt());
+        }
+
+        void visit(ASTFunctionCallStmt* callStmt){
+            ++count;
+            descend(callStmt->getFunctionCallExpr());
+        }
+
+        void visit(ASTIfStmt* ifStmt){
+            ++count;
+            for(const auto& condition : ifStmt->getConditionExprs()){
+                descend(condition);
+            }
+            for(const auto& stmt : ifStmt->getStmts()){
+                descend(stmt);
+            }
+        }
+
+        void visit(ASTReturnStmt* returnStmt){
+            ++count;
+            if(returnStmt->hasReturnExpr()){
+                descend(returnStmt->getReturnExpr());
+            }
+        }
+
+        void visit(ASTWhileStmt* whileStmt){
+            ++count;
+            descend(whileStmt->getConditionExpr());
+            descend(whileStmt->getStmt());
+        }
+
+        void visit(ASTDoWhileStmt* dowhileStmt){
+            ++count;
+            descend(dowhileStmt->getConditionExpr());
+            descend(dowhileStmt->getStmt());
+        }
+
+        void visit(ASTSwitchStmt* switchStmt){
+            ++count;
+            descend(switchStmt->getVariableIdExpr());
+            for(const auto& caseStmt : switchStmt->getCaseStmts()){
+                descend(caseStmt);
+            }
+            if(switchStmt->hasDefaultStmt()){
+                descend(switchStmt->getDefaultStmt());
+            }
+        }
+
+        void visit(ASTCaseStmt* caseStmt){
+            ++count;
+            descend(caseStmt->getLiteralExpr());
+            descend(caseStmt->getSwitchBlockStmt());
+        }
+
+        void visit(ASTDefaultStmt* defaultStmt){
+            ++count;
+            descend(defaultStmt->getSwitchBlockStmt());
+        }
+
+        void visit(ASTSwitchBlockStmt* switchBlockStmt){
+            ++count;
+            for(const auto& stmt : switchBlockStmt->getStmts()){
+                descend(stmt);
+            }
+        }
+
+        void visit(ASTBinaryExpr* binaryExpr){
+            ++count;
+            descend(binaryExpr->getLeftOperandExpr());
+            descend(binaryExpr->getRightOperandExpr());
+        }
+
+        void visit(ASTFunctionCallExpr* callExpr){
+            ++count;
+            for(const auto& arg : callExpr->getArguments()){
+                descend(arg);
+            }
+        }
+
+        void visit([[maybe_unused]] ASTIdExpr* idExpr){
+            ++count;
+        }
+
+        void visit([[maybe_unused]] ASTLiteralExpr* literalExpr){
+            ++count;
+        }
+
+    private:
+        template<typename Node>
+        void descend(Node* node){
+            if constexpr(isStatic){
+                this->visitNode(node);
+            }
+            else {
+                node->accept(*this);
+            }
+        }
+
+        template<typename Node, typename Deleter>
+        void descend(const std::unique_ptr<Node, Deleter>& node){
+            descend(node.get());
+        }
+
+    };
+
+    /**
+     * @brief generates the source of the benchmarked program
+     * @returns source mixing all statement and expression kinds
+    */
+    std::string generateSource(){
+        std::string source;
+        for(size_t i{ 0 }; i < functionCount; ++i){
+            const std::string name{ "f" + std::to_string(i) };
+            source += "int " + name + "(int a, int b){ int x = a + b * 2; int i; ";
+            for(size_t j{ 0 }; j < bodyRepeat; ++j){
+                source +=
+                    "if(x > 3){ x = x - 1; } else if(x < 1){ x = " + name + "(x, 1); } else { x = x << 1; } "
+                    "while(x > 100){ x = x / 2; } "
+                    "for(i = 0; i < b; i = i + 1){ x = x + i; } "
+                    "do { x = x + 1; } while(x < 0); "
+                    "switch(x){ case 1: x = 2; break; default: x = 3; } ";
+            }
+            source += "return x; } ";
+        }
+        source += "int main(){ return f0(1, 2); }";
+        return source;
+    }
+
+    /**
+     * @brief walks the tree repeatedly with the counter
+     * @param program - pointer to the program
+     * @param label - name of the dispatch printed with the result
+    */
+    template<bool isStatic>
+    void measure(ASTProgram* program, std::string_view label){
+        size_t nodes{ 0 };
+        const auto start{ std::chrono::steady_clock::now() };
+        for(size_t i{ 0 }; i < walkCount; ++i){
+            NodeCounter<isStatic> counter;
+            if constexpr(isStatic){
+                counter.visitNode(program);
+            }
+            else {
+                program->accept(counter);
+            }
+            nodes += counter.count;
+        }
+        const std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+
+        std::cout << label << ": " << nodes / walkCount << " nodes, "
+            << elapsed.count() / static_cast<double>(nodes) << " ns/node\n";
+    }
+}
+
+int main(){
+    const std::string source{ generateSource() };
+    const std::vector<std::string_view> input{ source };
+
+    lex::Lexer lexer{ input };
+    lexer.tokenize();
+    syntax::TokenConsumer tokenConsumer{ lexer };
+    syntax::Parser parser{ tokenConsumer };
+    std::unique_ptr<ASTProgram> program{ parser.parseProgram() };
+
+    // warm up the caches, the tree is walked by both counters afterwards
+    measure<false>(program.get(), "warm-up");
+    measure<false>(program.get(), "virtual accept");
+    measure<true>(program.get(), "static dispatch");
+    return 0;
+}
@@ -1,10 +1,9 @@
 #ifndef CODE_GENERATOR_HPP
 #define CODE_GENERATOR_HPP
 
-#include <mutex>
 #include <string_view>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #include "../../common/intermediate-representation-tree/ir_program.hpp"
 #include "../../thread-pool/thread_pool.hpp"
@@ -33,6 +32,26 @@ namespace code_gen {
         */
         void generateProgram(const ir::IRProgram* program);
 
+        /**
+         * @brief prepares a slot for the code of every function of the program
+         * @param program - const pointer to the irt program
+        */
+        void beginProgram(const ir::IRProgram* program);
+
+        /**
+         * @brief generates the code of the function
+         * @param program - const pointer to the irt program
+         * @param n - position of the function in the program
+         * @note functions at different positions may be generated concurrently, after beginProgram
+        */
+        void generateFunctionAt(const ir::IRProgram* program, size_t n);
+
+        /** 
+         * @brief writes generated code into asm file
+         * @param program - const pointer to the root of the program
+        */
+        void writeCode(const ir::IRProgram* program);
+
         /** 
          * @brief checks if the code generation was successful
          * @returns true if asm is generated, false otherwise
@@ -40,11 +59,8 @@ namespace code_gen {
         bool successful() const noexcept;
 
     private:
-        /// maps the name of the function to its assembly code
-        std::unordered_map<std::string, std::vector<std::string>> asmCode;
-
-        /// mutex protecting the asmCode
-        std::mutex mtx;
+        /// assembly code of the functions, indexed by the position of the function in the program
+        std::vector<std::vector<std::string>> asmCode;
 
         /// thread pool for parallel function code generation
         util::concurrency::ThreadPool& threadPool;
@@ -52,12 +68,6 @@ namespace code_gen {
         /// output file path (.s)
         const std::string outputPath;
 
-        /** 
-         * @brief writes generated code into asm file
-         * @param program - const pointer to the root of the program
-        */
-        void writeCode(const ir::IRProgram* program);
-
     };
 
 }
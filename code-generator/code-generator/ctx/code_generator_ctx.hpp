@@ -2,18 +2,21 @@
 #define CODE_GENERATOR_CTX_HPP
 
 #include <string>
+#include <string_view>
 #include <cstddef>
 #include <unordered_map>
 #include <vector>
 
+#include "../../../common/symbol/string_interner.hpp"
+
 namespace code_gen {
     /** 
      * @struct CodeGeneratorFunctionContext
      * @brief context of the function
     */
     struct CodeGeneratorFunctionContext {
-        /// function being generated by the thread
-        std::string functionName{""};
+        /// function being generated by the thread, view of the interned name
+        std::string_view functionName{""};
 
         /// position of the first free general purpose register (if there is no free gp registers, stack is used) 
         size_t gpFreeRegPos{};
@@ -21,8 +24,8 @@ namespace code_gen {
         /// number for next variable (-variableNum*regSize(%rbp))
         size_t variableNum{1};
 
-        /// mapping variable name to its address (relative to rbp)
-        std::unordered_map<std::string, std::string> variableMap;
+        /// mapping interned variable name to its address (relative to rbp)
+        std::unordered_map<util::text::SymbolId, std::string> variableMap;
         
         /// generated asm code
         std::vector<std::string> asmCode;
@@ -36,6 +36,12 @@ namespace code_gen {
         */
         const CodeGeneratorFunctionContext& getContext() const noexcept;
 
+        /**
+         * @brief getter for the context of the function
+         * @returns reference to a context of the function, its code can be moved out
+        */
+        CodeGeneratorFunctionContext& getContext() noexcept;
+
     private:
         /// context of the function
         CodeGeneratorFunctionContext ctx{};
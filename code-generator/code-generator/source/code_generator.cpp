@@ -3,39 +3,38 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
-#include <latch>
 
 #include "../../asm-generator/asm_instruction_generator.hpp"
 #include "../function_code_generator.hpp"
+#include "../../../thread-pool/task_group.hpp"
 
 code_gen::CodeGenerator::CodeGenerator(std::string_view filePath, util::concurrency::ThreadPool& threadPool) 
     : threadPool{ threadPool}, 
       outputPath{ filePath } {}
 
 void code_gen::CodeGenerator::generateProgram(const ir::IRProgram* program){
-    std::latch doneLatch{ static_cast<ptrdiff_t>(program->getFunctionCount()) };
-
-    for(const auto& function : program->getFunctions()){
-        threadPool.enqueue(
-            [this, function=function.get(), &doneLatch] -> void {
-                code_gen::FunctionCodeGenerator funcGenerator;
-                funcGenerator.generateFunction(function);
-
-                {
-                    std::lock_guard<std::mutex> lock{mtx};
-                    asmCode[function->getFunctionName()] = funcGenerator.getContext().asmCode;
-                }
-
-                doneLatch.count_down();
-            }
-        );
-    }
-
-    doneLatch.wait();
+    beginProgram(program);
+    util::concurrency::parallelForByCost(threadPool, program->getFunctionCount(),
+        [program](size_t i) -> size_t { return program->getFunctionAtN(i)->getCost(); },
+        [this, program](size_t i) -> void {
+            generateFunctionAt(program, i);
+        }
+    );
 
     writeCode(program);
 }
 
+void code_gen::CodeGenerator::beginProgram(const ir::IRProgram* program){
+    // every function owns the slot at its position, tasks move their code into it without locking
+    asmCode.assign(program->getFunctionCount(), {});
+}
+
+void code_gen::CodeGenerator::generateFunctionAt(const ir::IRProgram* program, size_t n){
+    code_gen::FunctionCodeGenerator funcGenerator;
+    funcGenerator.generateFunction(program->getFunctionAtN(n));
+    asmCode[n] = std::move(funcGenerator.getContext().asmCode);
+}
+
 void code_gen::CodeGenerator::writeCode(const ir::IRProgram* program){
     std::ofstream file{ outputPath };
     if(!file.is_open()){
@@ -45,8 +44,8 @@ void code_gen::CodeGenerator::writeCode(const ir::IRProgram* program){
     // start of asm code
     file << code_gen::assembly::genStart();
 
-    for(const auto& function : program->getFunctions()){
-        for(const auto& instruction : asmCode[function->getFunctionName()]){
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        for(const auto& instruction : asmCode[i]){
             file << instruction;
         }
     }
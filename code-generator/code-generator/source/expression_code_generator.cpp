@@ -355,7 +355,7 @@ void code_gen::ExpressionCodeGenerator::generateIdExpr(const ir::IRIdExpr* idExp
 }
 
 std::string_view code_gen::ExpressionCodeGenerator::getIdExprAddress(const ir::IRIdExpr* idExpr) const {
-    return ctx.variableMap.at(idExpr->getIdName());
+    return ctx.variableMap.at(idExpr->getSymbolId());
 }
 
 void code_gen::ExpressionCodeGenerator::generateLiteralExpr(const ir::IRLiteralExpr* literalExpr){
@@ -460,7 +460,7 @@ void code_gen::ExpressionCodeGenerator::generateTemporaryExprs(const ir::IRTempo
         }
 
         ctx.variableMap.insert({
-            tempExprs->getTemporaryNameAtN(i), 
+            tempExprs->getTemporarySymbolIdAtN(i), 
             std::format("-{}(%rbp)", ctx.variableNum * code_gen::assembly::regSize)
         });
         ++ctx.variableNum;
@@ -470,7 +470,7 @@ void code_gen::ExpressionCodeGenerator::generateTemporaryExprs(const ir::IRTempo
         code_gen::assembly::genMov(
             ctx.asmCode, 
             gpRegisters.at(ctx.gpFreeRegPos), 
-            ctx.variableMap.at(tempExprs->getTemporaryNameAtN(i)), 
+            ctx.variableMap.at(tempExprs->getTemporarySymbolIdAtN(i)), 
             "q"
         );
     }
@@ -67,7 +67,7 @@ void code_gen::FunctionCodeGenerator::generateParameters(const ir::IRFunction* f
     for(const auto& parameter : function->getParameters()){
         // mapping parameter to address relative to %rbp (+n(%rbp))
         ctx.variableMap.insert({
-            parameter->getParameterName(), 
+            parameter->getSymbolId(), 
             std::format("{}(%rbp)", i * code_gen::assembly::regSize)
         });
         ++i;
@@ -77,4 +77,9 @@ void code_gen::FunctionCodeGenerator::generateParameters(const ir::IRFunction* f
 const code_gen::CodeGeneratorFunctionContext& 
 code_gen::FunctionCodeGenerator::getContext() const noexcept {
     return ctx;
+}
+
+code_gen::CodeGeneratorFunctionContext& 
+code_gen::FunctionCodeGenerator::getContext() noexcept {
+    return ctx;
 }
\ No newline at end of file
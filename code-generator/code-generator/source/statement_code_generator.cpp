@@ -63,7 +63,7 @@ void code_gen::StatementCodeGenerator::generateVariableDeclStmt(
     // so it overwrites it with new memory location
     auto [varPtr, success]{ 
         ctx.variableMap.insert({
-            variableDecl->getVarName(), 
+            variableDecl->getSymbolId(), 
             std::format(
                 "-{}(%rbp)", 
                 ctx.variableNum * code_gen::assembly::regSize
@@ -89,7 +89,7 @@ void code_gen::StatementCodeGenerator::generateVariableDeclStmt(
         code_gen::assembly::genMov(
             ctx.asmCode, 
             gpRegisters.at(ctx.gpFreeRegPos), 
-            ctx.variableMap.at(variableDecl->getVarName()), 
+            ctx.variableMap.at(variableDecl->getSymbolId()), 
             "q"
         );
     }
@@ -98,7 +98,7 @@ void code_gen::StatementCodeGenerator::generateVariableDeclStmt(
         code_gen::assembly::genMov(
             ctx.asmCode, 
             "$0", 
-            ctx.variableMap.at(variableDecl->getVarName()), 
+            ctx.variableMap.at(variableDecl->getSymbolId()), 
             "q"
         );
     }
@@ -367,7 +367,7 @@ void code_gen::StatementCodeGenerator::generateSwitchStmt(const ir::IRSwitchStmt
     );
 
     size_t size{ switchStmt->getCaseCount() };
-    std::string var{ switchStmt->getVariableIdExpr()->getIdName() };
+    const util::text::SymbolId var{ switchStmt->getVariableIdExpr()->getSymbolId() };
     
     // cases
     for(size_t i{0}; i < size; i++){
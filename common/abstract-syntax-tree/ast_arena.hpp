@@ -0,0 +1,85 @@
+#ifndef AST_ARENA_HPP
+#define AST_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace syntax::ast {
+    /**
+     * @struct ASTDeleter
+     * @brief deleter of the nodes placed into an arena
+     * @details does nothing, storage of the node is released together with the whole arena
+    */
+    struct ASTDeleter {
+        /**
+         * @brief leaves the node to its arena
+        */
+        template<typename T>
+        void operator()(T*) const noexcept {}
+
+    };
+
+    /// owning handle of a node placed into an arena
+    template<typename T>
+    using ASTPtr = std::unique_ptr<T, ASTDeleter>;
+
+    /**
+     * @class ASTArena
+     * @brief bump allocator the nodes of the abstract syntax tree are placed into
+     * @details nodes and their child lists are placed contiguously in the order they are parsed,
+     * destructors of the nodes are never run, the whole tree is released at once with the arena,
+     * nodes must not own memory outside of the arena
+    */
+    class ASTArena {
+    public:
+        /// allocator handed to the nodes that own child lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        /**
+         * @brief Creates empty arena
+        */
+        ASTArena();
+
+        /// deleted copy constructor
+        ASTArena(const ASTArena&) = delete;
+
+        /// deleted copy assignment operator
+        ASTArena& operator=(const ASTArena&) = delete;
+
+        /**
+         * @brief places new node into the arena
+         * @tparam T - type of the node
+         * @param args - arguments of the node constructor, arena allocator is appended for allocator aware nodes
+         * @returns handle of the node
+        */
+        template<typename T, typename... Args>
+        ASTPtr<T> make(Args&&... args) {
+            void* storage{ resource.allocate(sizeof(T), alignof(T)) };
+            return ASTPtr<T>{
+                std::uninitialized_construct_using_allocator(
+                    static_cast<T*>(storage), allocator_type{ &resource }, std::forward<Args>(args)...
+                )
+            };
+        }
+
+        /**
+         * @brief getter for the allocator of the arena
+         * @returns allocator placing memory into the arena
+        */
+        allocator_type getAllocator() noexcept;
+
+    private:
+        /// size of the first block, following blocks grow geometrically
+        static constexpr size_t initialBlockSize{ 16 * 1024 };
+
+        /// memory of the arena
+        std::pmr::monotonic_buffer_resource resource;
+
+    };
+
+}
+
+#endif
@@ -1,8 +1,7 @@
 #ifndef AST_ASSIGN_STMT_HPP
 #define AST_ASSIGN_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_id_expr.hpp"
 #include "../token/token.hpp"
@@ -42,13 +41,13 @@ namespace syntax::ast {
          * @brief initializes id sub-node
          * @param idExpr - pointer to an id node
         */
-        void setVariableIdExpr(std::unique_ptr<ASTIdExpr> idExpr);
+        void setVariableIdExpr(ASTPtr<ASTIdExpr> idExpr);
 
         /** 
          * @brief initializes expression sub-node
          * @param expr - pointer to an expression node
         */
-        void setAssignedExpr(std::unique_ptr<ASTExpr> expr);
+        void setAssignedExpr(ASTPtr<ASTExpr> expr);
 
         /**
          * @brief accepts the ast visitor
@@ -58,10 +57,10 @@ namespace syntax::ast {
 
     private:
         /// pointer to the id of the variable
-        std::unique_ptr<ASTIdExpr> variableIdExpr;
+        ASTPtr<ASTIdExpr> variableIdExpr;
 
         /// pointer to the assigned expression
-        std::unique_ptr<ASTExpr> assignedExpr;
+        ASTPtr<ASTExpr> assignedExpr;
 
     };
 
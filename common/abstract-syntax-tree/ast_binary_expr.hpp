@@ -1,8 +1,7 @@
 #ifndef AST_BINARY_EXPR_HPP
 #define AST_BINARY_EXPR_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
 #include "../visitor/ast_visitor.hpp"
@@ -63,7 +62,7 @@ namespace syntax::ast {
          * @param leftOperand - pointer to a left operand expression node
          * @param rightOperand - pointer to a right operand expression node
         */
-        void setOperandExprs(std::unique_ptr<ASTExpr> leftOperand, std::unique_ptr<ASTExpr> rightOperand);
+        void setOperandExprs(ASTPtr<ASTExpr> leftOperand, ASTPtr<ASTExpr> rightOperand);
 
         /** 
          * @brief checks if left and right operands are initialized
@@ -79,10 +78,10 @@ namespace syntax::ast {
 
     private:
         /// pointer to the left operand of the binary expression
-        std::unique_ptr<ASTExpr> leftOperandExpr;
+        ASTPtr<ASTExpr> leftOperandExpr;
 
         /// pointer to the right operand of the binary expression
-        std::unique_ptr<ASTExpr> rightOperandExpr;
+        ASTPtr<ASTExpr> rightOperandExpr;
 
         /// operator of the binary expression
         Operator exprOperator;
@@ -1,8 +1,7 @@
 #ifndef AST_CASE_STMT_HPP
 #define AST_CASE_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_literal_expr.hpp"
 #include "ast_switch_block_stmt.hpp"
@@ -47,8 +46,8 @@ namespace syntax::ast {
          * @param hasBreak - flag if case has break
         */
         void setCase(
-            std::unique_ptr<ASTLiteralExpr> litExpr, 
-            std::unique_ptr<ASTSwitchBlockStmt> swBlockStmt, 
+            ASTPtr<ASTLiteralExpr> litExpr, 
+            ASTPtr<ASTSwitchBlockStmt> swBlockStmt, 
             bool hasBreak
         );
 
@@ -66,10 +65,10 @@ namespace syntax::ast {
 
     private:
         /// pointer to the literal of the case
-        std::unique_ptr<ASTLiteralExpr> literalExpr;
+        ASTPtr<ASTLiteralExpr> literalExpr;
 
         /// pointer to the switch-block of the case
-        std::unique_ptr<ASTSwitchBlockStmt> switchBlockStmt;
+        ASTPtr<ASTSwitchBlockStmt> switchBlockStmt;
 
         /// flag if case breaks
         bool breaks;
@@ -1,8 +1,7 @@
 #ifndef AST_DEFAULT_STMT_HPP
 #define AST_DEFAULT_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_switch_block_stmt.hpp"
 #include "../token/token.hpp"
@@ -34,7 +33,7 @@ namespace syntax::ast {
          * @brief initializes switch block node
          * @param swBlockStmt - pointer to a switch block node
         */
-        void setDefaultStmt(std::unique_ptr<ASTSwitchBlockStmt> swBlockStmt);
+        void setDefaultStmt(ASTPtr<ASTSwitchBlockStmt> swBlockStmt);
 
         /**
          * @brief accepts the ast visitor
@@ -44,7 +43,7 @@ namespace syntax::ast {
 
     private:
         /// pointer to the switch-block of the default case
-        std::unique_ptr<ASTSwitchBlockStmt> switchBlockStmt;
+        ASTPtr<ASTSwitchBlockStmt> switchBlockStmt;
 
     };
 
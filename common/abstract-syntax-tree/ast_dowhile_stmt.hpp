@@ -1,8 +1,7 @@
 #ifndef AST_DOWHILE_STMT_HPP
 #define AST_DOWHILE_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
@@ -44,7 +43,7 @@ namespace syntax::ast {
          * @param condExpr - pointer to a condition node
          * @param statement - pointer to a statement node
         */
-        void setDoWhile(std::unique_ptr<ASTExpr> condExpr, std::unique_ptr<ASTStmt> statement);
+        void setDoWhile(ASTPtr<ASTExpr> condExpr, ASTPtr<ASTStmt> statement);
 
         /**
          * @brief accepts the ast visitor
@@ -54,10 +53,10 @@ namespace syntax::ast {
 
     private:
         /// pointer to the condition of the do-while statement
-        std::unique_ptr<ASTExpr> conditionExpr;
+        ASTPtr<ASTExpr> conditionExpr;
 
         /// pointer to the statement of the do-while statement
-        std::unique_ptr<ASTStmt> stmt;
+        ASTPtr<ASTStmt> stmt;
 
     };
 
@@ -1,8 +1,7 @@
 #ifndef AST_FOR_STMT_HPP
 #define AST_FOR_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_assign_stmt.hpp"
 #include "ast_expr.hpp"
@@ -69,10 +68,10 @@ namespace syntax::ast {
          * @param statement - pointer to a statement node
         */
         void setForStmt(
-            std::unique_ptr<ASTAssignStmt> initStmt, 
-            std::unique_ptr<ASTExpr> condExpr, 
-            std::unique_ptr<ASTAssignStmt> incStmt, 
-            std::unique_ptr<ASTStmt> statement
+            ASTPtr<ASTAssignStmt> initStmt, 
+            ASTPtr<ASTExpr> condExpr, 
+            ASTPtr<ASTAssignStmt> incStmt, 
+            ASTPtr<ASTStmt> statement
         );
 
         /** 
@@ -101,16 +100,16 @@ namespace syntax::ast {
 
     private:
         /// pointer to the assignment statement of the initializer
-        std::unique_ptr<ASTAssignStmt> initializerStmt;
+        ASTPtr<ASTAssignStmt> initializerStmt;
 
         /// pointer to the condition of the for-statement
-        std::unique_ptr<ASTExpr> conditionExpr;
+        ASTPtr<ASTExpr> conditionExpr;
 
         /// pointer to the assignment statement of the incrementer
-        std::unique_ptr<ASTAssignStmt> incrementerStmt;
+        ASTPtr<ASTAssignStmt> incrementerStmt;
 
         /// pointer to the statement of the for-statement
-        std::unique_ptr<ASTStmt> stmt;
+        ASTPtr<ASTStmt> stmt;
 
     };
 
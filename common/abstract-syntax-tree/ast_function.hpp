@@ -1,9 +1,9 @@
 #ifndef AST_FUNCTION_HPP
 #define AST_FUNCTION_HPP
 
-#include <memory>
 #include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_node.hpp"
 #include "ast_parameter.hpp"
 #include "ast_stmt.hpp"
@@ -18,39 +18,44 @@ namespace syntax::ast {
     */
     class ASTFunction final : public ASTNode {
     public:
+        /// allocator of the parameter and statement lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast function
          * @param token - const reference to the token
          * @param type - return type of the function
+         * @param alloc - allocator of the parameter and statement lists
         */
         ASTFunction(
             const syntax::Token& token, 
-            types::Type type = types::Type::NO_TYPE
+            types::Type type = types::Type::NO_TYPE,
+            const allocator_type& alloc = {}
         );
 
         /** 
          * @brief getter for the function parameters
          * @returns reference to a vector of pointers to parameters 
         */
-        const std::vector<std::unique_ptr<ASTParameter>>& getParameters() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTParameter>>& getParameters() const noexcept;
 
         /** 
          * @brief getter for the body of the function
          * @returns reference to a vector of pointers to statements of the body
         */
-        const std::vector<std::unique_ptr<ASTStmt>>& getBody() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTStmt>>& getBody() const noexcept;
 
         /** 
          * @brief adds new parameter to parameters
          * @param parameter - parameter that is being added
         */
-        void addParameter(std::unique_ptr<ASTParameter> parameter);
+        void addParameter(ASTPtr<ASTParameter> parameter);
 
         /** 
          * @brief adds new statement to body
          * @param statement - pointer to a statement that is being added to body
         */
-        void addStatement(std::unique_ptr<ASTStmt> statement);
+        void addStatement(ASTPtr<ASTStmt> statement);
 
         /** 
          * @brief sets predifined flag of a function
@@ -88,6 +93,18 @@ namespace syntax::ast {
         */
         bool alwaysReturnsValue() const noexcept;
 
+        /**
+         * @brief sets the estimated cost of compiling the function
+         * @param estimatedCost - number of tokens the function was parsed from
+        */
+        void setCost(size_t estimatedCost) noexcept;
+
+        /**
+         * @brief getter for the estimated cost of compiling the function
+         * @returns number of tokens the function was parsed from, 0 for a function that was not parsed
+        */
+        size_t getCost() const noexcept;
+
         /**
          * @brief accepts the ast visitor
          * @param visitor - reference to an ast visitor
@@ -104,11 +121,14 @@ namespace syntax::ast {
         /// flag if function always returns, only for functions that return value
         bool alwaysReturns;
 
+        /// estimated cost of compiling the function, used for scheduling the per function tasks
+        size_t cost;
+
         /// vector of pointers to parameters of the function
-        std::vector<std::unique_ptr<ASTParameter>> parameters;
+        std::pmr::vector<ASTPtr<ASTParameter>> parameters;
 
         /// vector of pointers to statements of the body
-        std::vector<std::unique_ptr<ASTStmt>> body;
+        std::pmr::vector<ASTPtr<ASTStmt>> body;
 
     };
 
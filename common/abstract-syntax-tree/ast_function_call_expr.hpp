@@ -1,9 +1,9 @@
 #ifndef AST_FUNCTION_CALL_EXPR_HPP
 #define AST_FUNCTION_CALL_EXPR_HPP
 
-#include <memory>
 #include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
 #include "../defs/types.hpp"
@@ -16,21 +16,26 @@ namespace syntax::ast {
     */
     class ASTFunctionCallExpr final : public ASTExpr {
     public:
+        /// allocator of the argument list
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast function call
          * @param token - const reference to the token
          * @param type - type of the function call
+         * @param alloc - allocator of the argument list
         */
         ASTFunctionCallExpr(
             const syntax::Token& token, 
-            types::Type type = types::Type::NO_TYPE
+            types::Type type = types::Type::NO_TYPE,
+            const allocator_type& alloc = {}
         );
 
         /** 
          * @brief getter for expressions passed to a function as arguments
          * @returns reference to a vector of expressions
         */
-        const std::vector<std::unique_ptr<ASTExpr>>& getArguments() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTExpr>>& getArguments() const noexcept;
 
         /** 
          * @brief getter for argument at a specific position
@@ -43,7 +48,7 @@ namespace syntax::ast {
          * @brief adds new argument
          * @param expr - pointer to the expression node
         */
-        void addArgument(std::unique_ptr<ASTExpr> expr);
+        void addArgument(ASTPtr<ASTExpr> expr);
 
         /** 
          * @brief gets the amount of arguments
@@ -59,7 +64,7 @@ namespace syntax::ast {
 
     private:
         /// vector of pointers to expressions that represent arguments
-        std::vector<std::unique_ptr<ASTExpr>> arguments;
+        std::pmr::vector<ASTPtr<ASTExpr>> arguments;
 
     };
 
@@ -1,8 +1,7 @@
 #ifndef AST_FUNCTION_CALL_STMT_HPP
 #define AST_FUNCTION_CALL_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_function_call_expr.hpp"
 #include "../token/token.hpp"
@@ -34,7 +33,7 @@ namespace syntax::ast {
          * @brief initializes the function call statement
          * @param callExpr - pointer to a function call expression
         */
-        void setFunctionCallStmt(std::unique_ptr<ASTFunctionCallExpr> callExpr);
+        void setFunctionCallStmt(ASTPtr<ASTFunctionCallExpr> callExpr);
 
         /**
          * @brief accepts the ast visitor
@@ -44,7 +43,7 @@ namespace syntax::ast {
 
     private:
         /// pointer to the function call expression
-        std::unique_ptr<ASTFunctionCallExpr> functionCallExpr;
+        ASTPtr<ASTFunctionCallExpr> functionCallExpr;
         
     };
 
@@ -1,9 +1,9 @@
 #ifndef AST_IF_STMT_HPP
 #define AST_IF_STMT_HPP
 
-#include <memory>
 #include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
@@ -16,36 +16,40 @@ namespace syntax::ast {
     */
     class ASTIfStmt final : public ASTStmt {
     public:
+        /// allocator of the condition and statement lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast if-statement
          * @param token - const reference to the token
+         * @param alloc - allocator of the condition and statement lists
         */
-        ASTIfStmt(const syntax::Token& token);
+        ASTIfStmt(const syntax::Token& token, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for conditions
          * @returns reference to a vector of pointers to conditions of the if statement
         */
-        const std::vector<std::unique_ptr<ASTExpr>>& getConditionExprs() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTExpr>>& getConditionExprs() const noexcept;
 
         /** 
          * @brief getter for statements
          * @returns reference to a vector of pointers to statement
         */
-        const std::vector<std::unique_ptr<ASTStmt>>& getStmts() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTStmt>>& getStmts() const noexcept;
 
         /** 
          * @brief adds new if/else-if statement
          * @param condExpr - pointer to a condition of the if statement
          * @param statement - pointer to a statement of if/else-if statement
         */
-        void addIfStmt(std::unique_ptr<ASTExpr> condExpr, std::unique_ptr<ASTStmt> statement);
+        void addIfStmt(ASTPtr<ASTExpr> condExpr, ASTPtr<ASTStmt> statement);
 
         /** 
          * @brief adds new else statement
          * @param statement - pointer to a statement of else statement
         */
-        void addElseStmt(std::unique_ptr<ASTStmt> statement);
+        void addElseStmt(ASTPtr<ASTStmt> statement);
 
         /** 
          * @brief checks if if-statement ends with else
@@ -61,10 +65,10 @@ namespace syntax::ast {
 
     private:
         /// vector of pointers to conditions of the if-statement
-        std::vector<std::unique_ptr<ASTExpr>> conditionExprs;
+        std::pmr::vector<ASTPtr<ASTExpr>> conditionExprs;
         
         /// vector of pointers to statements of the if-statement
-        std::vector<std::unique_ptr<ASTStmt>> stmts;
+        std::pmr::vector<ASTPtr<ASTStmt>> stmts;
 
     };
 
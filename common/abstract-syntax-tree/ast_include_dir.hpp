@@ -1,7 +1,9 @@
 #ifndef AST_INCLUDE_DIR_HPP
 #define AST_INCLUDE_DIR_HPP
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 #include "ast_dir.hpp"
 #include "../visitor/ast_visitor.hpp"
@@ -13,23 +15,27 @@ namespace syntax::ast {
     */
     class ASTIncludeDir final : public ASTDir {
     public:
+        /// allocator of the library name
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast include directive
          * @param token - const reference to the token
+         * @param alloc - allocator of the library name
         */
-        ASTIncludeDir(const syntax::Token& token);
+        ASTIncludeDir(const syntax::Token& token, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the name of the included library
-         * @returns const reference to a lib name
+         * @returns view of the lib name
         */
-        const std::string& getLibName() const noexcept;
+        std::string_view getLibName() const noexcept;
 
         /**
          * @brief initializes the name of the included library
          * @param includedLibName - name of the included library
         */
-        void setLibName(const std::string& includedLibName);
+        void setLibName(std::string_view includedLibName);
 
         /**
          * @brief accepts the ast visitor
@@ -39,7 +45,7 @@ namespace syntax::ast {
 
     private:
         /// name of the included library
-        std::string libName;
+        std::pmr::string libName;
 
     };
 
@@ -3,6 +3,7 @@
 
 #include "defs/ast_defs.hpp"
 #include "../token/token.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ast_visitor.hpp"
 
 /**
@@ -20,6 +21,7 @@ namespace syntax::ast {
          * @brief Creates the instance of the ast node
          * @param token - const reference to the token
          * @param ntype - type of the ast node
+         * @details name of the function, parameter, variable, call or id is interned once here
         */
         ASTNode(const syntax::Token& token, ASTNodeType ntype);
 
@@ -46,6 +48,12 @@ namespace syntax::ast {
         */
         const syntax::Token& getToken() const noexcept;
 
+        /** 
+        * @brief getter for the interned name of the node
+        * @returns id of the name for named nodes, emptyId otherwise
+        */
+        util::text::SymbolId getSymbolId() const noexcept;
+
         /** 
         * @brief getter for the node type
         * @returns type of the node
@@ -65,6 +73,9 @@ namespace syntax::ast {
         /// type of the ast node
         ASTNodeType nodeType;
 
+        /// interned name of the node
+        util::text::SymbolId symbolId;
+
     };
 
 }
@@ -1,8 +1,12 @@
 #ifndef AST_PROGRAM_HPP
 #define AST_PROGRAM_HPP
 
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_node.hpp"
 #include "ast_function.hpp"
 #include "ast_dir.hpp"
@@ -13,6 +17,7 @@ namespace syntax::ast {
     /** 
      * @class ASTProgram
      * @brief AST node representing the program 
+     * @details owns the arena the nodes of the whole tree are placed into
     */
     class ASTProgram final : public ASTNode {
     public:
@@ -22,11 +27,24 @@ namespace syntax::ast {
         */
         ASTProgram(const syntax::Token& token);
 
+        /**
+         * @brief getter for the arena of the program
+         * @returns reference to the arena the nodes of the program are placed into
+        */
+        ASTArena& getArena() noexcept;
+
+        /**
+         * @brief adds new arena owned by the program
+         * @returns reference to the arena, stays valid for the lifetime of the program
+         * @details functions parsed concurrently are placed into arenas of their own
+        */
+        ASTArena& addArena();
+
         /** 
          * @brief getter for functions of the program
          * @returns reference to a vector of the pointers to functions
         */
-        const std::vector<std::unique_ptr<ASTFunction>>& getFunctions() const noexcept;
+        const std::vector<ASTPtr<ASTFunction>>& getFunctions() const noexcept;
 
         /** 
          * @brief getter for the amount of the functions
@@ -45,7 +63,7 @@ namespace syntax::ast {
          * @brief getter for directives of the program
          * @returns reference to a vector of the pointers to directives
         */
-        const std::vector<std::unique_ptr<ASTDir>>& getDirs() const noexcept;
+        const std::vector<ASTPtr<ASTDir>>& getDirs() const noexcept;
 
         /** 
          * @brief getter for a directive at a specified index
@@ -58,13 +76,25 @@ namespace syntax::ast {
          * @brief adds new function
          * @param function - pointer to a function that is being added
         */
-        void addFunction(std::unique_ptr<ASTFunction> function);
+        void addFunction(ASTPtr<ASTFunction> function);
+
+        /**
+         * @brief adds functions declared by the library interfaces
+         * @param declarations - pointers to the declared functions, placed in front of the parsed functions
+        */
+        void addDeclarations(std::vector<ASTPtr<ASTFunction>> declarations);
 
         /**
          * @brief adds new directive
          * @param directive - pointer to a directive that is being added
         */
-        void addDir(std::unique_ptr<ASTDir> directive);
+        void addDir(ASTPtr<ASTDir> directive);
+
+        /**
+         * @brief orders the functions and directives by the files they were parsed from, stable within a file
+         * @param sourceOrder - source ids of the files in the requested order
+        */
+        void orderBySource(std::span<const uint16_t> sourceOrder);
 
         /**
          * @brief accepts the ast visitor
@@ -73,11 +103,17 @@ namespace syntax::ast {
         void accept(ASTVisitor& visitor) override;
 
     private:
+        /// arena owning the nodes of the program, declared first so it is released last
+        ASTArena arena;
+
+        /// additional arenas owning the nodes parsed concurrently
+        std::vector<std::unique_ptr<ASTArena>> arenas;
+
         /// vector of pointers to functions of the program
-        std::vector<std::unique_ptr<ASTFunction>> functions;
+        std::vector<ASTPtr<ASTFunction>> functions;
         
         /// vector of pointers to directives of the program
-        std::vector<std::unique_ptr<ASTDir>> dirs;
+        std::vector<ASTPtr<ASTDir>> dirs;
 
     };
 
@@ -1,8 +1,7 @@
 #ifndef AST_RETURN_STMT_HPP
 #define AST_RETURN_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
@@ -35,7 +34,7 @@ namespace syntax::ast {
          * @brief initializes the expression
          * @param expr - pointer to the expression
         */
-        void setReturnExpr(std::unique_ptr<ASTExpr> expr);
+        void setReturnExpr(ASTPtr<ASTExpr> expr);
 
         /** 
          * @brief checks if return statement returns anything
@@ -51,7 +50,7 @@ namespace syntax::ast {
 
     private:
         /// pointer to the expression of the return statement
-        std::unique_ptr<ASTExpr> returnExpr;
+        ASTPtr<ASTExpr> returnExpr;
 
     };
 
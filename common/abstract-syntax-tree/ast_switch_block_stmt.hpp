@@ -1,9 +1,9 @@
 #ifndef AST_SWITCH_BLOCK_STMT_HPP
 #define AST_SWITCH_BLOCK_STMT_HPP
 
-#include <memory>
 #include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "../token/token.hpp"
 #include "../visitor/ast_visitor.hpp"
@@ -15,23 +15,27 @@ namespace syntax::ast {
     */
     class ASTSwitchBlockStmt final : public ASTStmt {
     public:
+        /// allocator of the statement list
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast switch-block
          * @param token - const reference to the token
+         * @param alloc - allocator of the statement list
         */
-        ASTSwitchBlockStmt(const syntax::Token& token);
+        ASTSwitchBlockStmt(const syntax::Token& token, const allocator_type& alloc = {});
         
         /** 
          * @brief getter for the statements of the switch block
          * @returns reference to a vector of the pointers to statements
         */
-        const std::vector<std::unique_ptr<ASTStmt>>& getStmts() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTStmt>>& getStmts() const noexcept;
 
         /** 
          * @brief adds new statement
          * @param stmt - pointer to a statement that is being added
         */
-        void addStmt(std::unique_ptr<ASTStmt> stmt);
+        void addStmt(ASTPtr<ASTStmt> stmt);
 
         /**
          * @brief accepts the ast visitor
@@ -41,7 +45,7 @@ namespace syntax::ast {
 
     private:
         /// vector of pointers to statements of the switch-block
-        std::vector<std::unique_ptr<ASTStmt>> stmts;
+        std::pmr::vector<ASTPtr<ASTStmt>> stmts;
         
     };
 
@@ -1,9 +1,9 @@
 #ifndef AST_SWITCH_STMT_HPP
 #define AST_SWITCH_STMT_HPP
 
-#include <memory>
 #include <vector>
 
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_id_expr.hpp"
 #include "ast_case_stmt.hpp"
@@ -18,11 +18,15 @@ namespace syntax::ast {
     */
     class ASTSwitchStmt final : public ASTStmt {
     public:
+        /// allocator of the case list
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the ast switch-statement
          * @param token - const reference to the token
+         * @param alloc - allocator of the case list
         */
-        ASTSwitchStmt(const syntax::Token& token);
+        ASTSwitchStmt(const syntax::Token& token, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for a variable (id of a variable)
@@ -37,13 +41,13 @@ namespace syntax::ast {
          * @brief initializes id of a variable
          * @param idExpr - pointer to id of a variable
         */
-        void setVariableIdExpr(std::unique_ptr<ASTIdExpr> idExpr);
+        void setVariableIdExpr(ASTPtr<ASTIdExpr> idExpr);
 
         /** 
          * @brief getter for the cases of the switch statement
          * @returns reference to a vector of pointers to cases
         */
-        const std::vector<std::unique_ptr<ASTCaseStmt>>& getCaseStmts() const noexcept;
+        const std::pmr::vector<ASTPtr<ASTCaseStmt>>& getCaseStmts() const noexcept;
 
         /** 
          * @brief getter for the default statement of the switch statement
@@ -58,13 +62,13 @@ namespace syntax::ast {
          * @brief adds new case
          * @param caseStmt - pointer to a case that is being added
         */
-        void addCaseStmt(std::unique_ptr<ASTCaseStmt> caseStmt);
+        void addCaseStmt(ASTPtr<ASTCaseStmt> caseStmt);
 
         /** 
          * @brief adds default statement
          * @param swDefaultStmt - pointer to a default statement
         */
-        void setDefaultStmt(std::unique_ptr<ASTDefaultStmt> swDefaultStmt);
+        void setDefaultStmt(ASTPtr<ASTDefaultStmt> swDefaultStmt);
 
         /** 
          * @brief checks if default statement exists
@@ -80,13 +84,13 @@ namespace syntax::ast {
 
     private:
         /// pointer to id of the variable of the switch-statement
-        std::unique_ptr<ASTIdExpr> variableIdExpr;
+        ASTPtr<ASTIdExpr> variableIdExpr;
 
         /// vector of pointer to cases of the switch-statement
-        std::vector<std::unique_ptr<ASTCaseStmt>> caseStmts;
+        std::pmr::vector<ASTPtr<ASTCaseStmt>> caseStmts;
         
         /// pointer to the default case of the switch-statement
-        std::unique_ptr<ASTDefaultStmt> defaultStmt;
+        ASTPtr<ASTDefaultStmt> defaultStmt;
 
     };
 
@@ -1,8 +1,7 @@
 #ifndef AST_VARIABLE_DECL_STMT_HPP
 #define AST_VARIABLE_DECL_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
@@ -49,7 +48,7 @@ namespace syntax::ast {
          * @brief initializes expression of the variable
          * @param expr - expression being assigned to the variable
         */
-        void setAssignExpr(std::unique_ptr<ASTExpr> expr);
+        void setAssignExpr(ASTPtr<ASTExpr> expr);
 
         /** 
          * @brief checks if the variable has assignment
@@ -68,7 +67,7 @@ namespace syntax::ast {
         types::Type type;
         
         /// pointer to the expression assigned to the variable
-        std::unique_ptr<ASTExpr> assignExpr;
+        ASTPtr<ASTExpr> assignExpr;
 
     };
 
@@ -1,8 +1,7 @@
 #ifndef AST_WHILE_STMT_HPP
 #define AST_WHILE_STMT_HPP
 
-#include <memory>
-
+#include "ast_arena.hpp"
 #include "ast_stmt.hpp"
 #include "ast_expr.hpp"
 #include "../token/token.hpp"
@@ -44,7 +43,7 @@ namespace syntax::ast {
          * @param condExpr - pointer to the conditions of the while statement
          * @param statement - pointer to the statement
         */
-        void setWhileStmt(std::unique_ptr<ASTExpr> condExpr, std::unique_ptr<ASTStmt> statement);
+        void setWhileStmt(ASTPtr<ASTExpr> condExpr, ASTPtr<ASTStmt> statement);
 
         /**
          * @brief accepts the ast visitor
@@ -54,10 +53,10 @@ namespace syntax::ast {
 
     private:
         /// pointer to the condition of the while-statement
-        std::unique_ptr<ASTExpr> conditionExpr;
+        ASTPtr<ASTExpr> conditionExpr;
         
         /// pointer to the statement of the while-statement
-        std::unique_ptr<ASTStmt> stmt;
+        ASTPtr<ASTStmt> stmt;
 
     };
 
@@ -0,0 +1,8 @@
+#include "../ast_arena.hpp"
+
+syntax::ast::ASTArena::ASTArena()
+    : resource{ initialBlockSize } {}
+
+syntax::ast::ASTArena::allocator_type syntax::ast::ASTArena::getAllocator() noexcept {
+    return allocator_type{ &resource };
+}
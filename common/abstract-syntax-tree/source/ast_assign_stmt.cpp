@@ -5,11 +5,11 @@
 syntax::ast::ASTAssignStmt::ASTAssignStmt(const syntax::Token& token) 
     : ASTStmt(token, syntax::ast::ASTNodeType::ASSIGN_STMT) {}
 
-void syntax::ast::ASTAssignStmt::setVariableIdExpr(std::unique_ptr<syntax::ast::ASTIdExpr> idExpr){
+void syntax::ast::ASTAssignStmt::setVariableIdExpr(syntax::ast::ASTPtr<syntax::ast::ASTIdExpr> idExpr){
     variableIdExpr = std::move(idExpr);
 }
 
-void syntax::ast::ASTAssignStmt::setAssignedExpr(std::unique_ptr<syntax::ast::ASTExpr> expr){
+void syntax::ast::ASTAssignStmt::setAssignedExpr(syntax::ast::ASTPtr<syntax::ast::ASTExpr> expr){
     assignedExpr = std::move(expr);
 }
 
@@ -14,8 +14,8 @@ void syntax::ast::ASTBinaryExpr::setOperator(syntax::Operator op) noexcept {
 }
 
 void syntax::ast::ASTBinaryExpr::setOperandExprs(
-    std::unique_ptr<syntax::ast::ASTExpr> leftOperand, 
-    std::unique_ptr<syntax::ast::ASTExpr> rightOperand
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> leftOperand, 
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> rightOperand
 ){
     leftOperandExpr = std::move(leftOperand);
     rightOperandExpr = std::move(rightOperand);
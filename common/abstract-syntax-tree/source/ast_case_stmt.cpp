@@ -6,8 +6,8 @@ syntax::ast::ASTCaseStmt::ASTCaseStmt(const syntax::Token& token)
     : ASTStmt(token, syntax::ast::ASTNodeType::CASE_STMT) {}
 
 void syntax::ast::ASTCaseStmt::setCase(
-    std::unique_ptr<syntax::ast::ASTLiteralExpr> litExpr, 
-    std::unique_ptr<syntax::ast::ASTSwitchBlockStmt> swBlockStmt, 
+    syntax::ast::ASTPtr<syntax::ast::ASTLiteralExpr> litExpr, 
+    syntax::ast::ASTPtr<syntax::ast::ASTSwitchBlockStmt> swBlockStmt, 
     bool hasBreak
 ){
     literalExpr = std::move(litExpr);
@@ -2,14 +2,15 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTCompoundStmt::ASTCompoundStmt(const syntax::Token& token) 
-    : ASTStmt(token, syntax::ast::ASTNodeType::COMPOUND_STMT) {}
+syntax::ast::ASTCompoundStmt::ASTCompoundStmt(const syntax::Token& token, const allocator_type& alloc) 
+    : ASTStmt(token, syntax::ast::ASTNodeType::COMPOUND_STMT), 
+      stmts{ alloc } {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTStmt>>& syntax::ast::ASTCompoundStmt::getStmts() const noexcept {
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTStmt>>& syntax::ast::ASTCompoundStmt::getStmts() const noexcept {
     return stmts;
 }
 
-void syntax::ast::ASTCompoundStmt::addStmt(std::unique_ptr<syntax::ast::ASTStmt> stmt){
+void syntax::ast::ASTCompoundStmt::addStmt(syntax::ast::ASTPtr<syntax::ast::ASTStmt> stmt){
     stmts.push_back(std::move(stmt));
 }
 
@@ -5,7 +5,7 @@
 syntax::ast::ASTDefaultStmt::ASTDefaultStmt(const syntax::Token& token) 
     : ASTStmt(token, syntax::ast::ASTNodeType::DEFAULT_STMT) {}
 
-void syntax::ast::ASTDefaultStmt::setDefaultStmt(std::unique_ptr<syntax::ast::ASTSwitchBlockStmt> swBlockStmt){
+void syntax::ast::ASTDefaultStmt::setDefaultStmt(syntax::ast::ASTPtr<syntax::ast::ASTSwitchBlockStmt> swBlockStmt){
     switchBlockStmt = std::move(swBlockStmt);
 }
 
@@ -6,8 +6,8 @@ syntax::ast::ASTDoWhileStmt::ASTDoWhileStmt(const syntax::Token& token)
     : ASTStmt(token, syntax::ast::ASTNodeType::DOWHILE_STMT) {}
 
 void syntax::ast::ASTDoWhileStmt::setDoWhile(
-    std::unique_ptr<syntax::ast::ASTExpr> condExpr, 
-    std::unique_ptr<syntax::ast::ASTStmt> statement
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> condExpr, 
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement
 ){
     conditionExpr = std::move(condExpr);
     stmt = std::move(statement);
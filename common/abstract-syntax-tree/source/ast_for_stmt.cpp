@@ -6,10 +6,10 @@ syntax::ast::ASTForStmt::ASTForStmt(const syntax::Token& token)
     : ASTStmt(token, syntax::ast::ASTNodeType::FOR_STMT) {}
 
 void syntax::ast::ASTForStmt::setForStmt(
-    std::unique_ptr<syntax::ast::ASTAssignStmt> initStmt, 
-    std::unique_ptr<syntax::ast::ASTExpr> condExpr, 
-    std::unique_ptr<syntax::ast::ASTAssignStmt> incStmt, 
-    std::unique_ptr<syntax::ast::ASTStmt> statement
+    syntax::ast::ASTPtr<syntax::ast::ASTAssignStmt> initStmt, 
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> condExpr, 
+    syntax::ast::ASTPtr<syntax::ast::ASTAssignStmt> incStmt, 
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement
 ){
     initializerStmt = std::move(initStmt);
     conditionExpr = std::move(condExpr);
@@ -2,27 +2,30 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTFunction::ASTFunction(const syntax::Token& token, types::Type type) 
+syntax::ast::ASTFunction::ASTFunction(const syntax::Token& token, types::Type type, const allocator_type& alloc) 
     : ASTNode(token, syntax::ast::ASTNodeType::FUNCTION), 
       type{ type }, 
       predefined{ false }, 
-      alwaysReturns{ false } {}
+      alwaysReturns{ false }, 
+      cost{ 0 }, 
+      parameters{ alloc }, 
+      body{ alloc } {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>& 
 syntax::ast::ASTFunction::getParameters() const noexcept {
     return parameters;
 }
 
-const std::vector<std::unique_ptr<syntax::ast::ASTStmt>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTStmt>>& 
 syntax::ast::ASTFunction::getBody() const noexcept {
     return body;
 }
 
-void syntax::ast::ASTFunction::addParameter(std::unique_ptr<syntax::ast::ASTParameter> parameter){
+void syntax::ast::ASTFunction::addParameter(syntax::ast::ASTPtr<syntax::ast::ASTParameter> parameter){
     parameters.push_back(std::move(parameter));
 }
 
-void syntax::ast::ASTFunction::addStatement(std::unique_ptr<syntax::ast::ASTStmt> statement){
+void syntax::ast::ASTFunction::addStatement(syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement){
     body.push_back(std::move(statement));
 }
 
@@ -50,6 +53,14 @@ bool syntax::ast::ASTFunction::alwaysReturnsValue() const noexcept {
     return alwaysReturns;
 }
 
+void syntax::ast::ASTFunction::setCost(size_t estimatedCost) noexcept {
+    cost = estimatedCost;
+}
+
+size_t syntax::ast::ASTFunction::getCost() const noexcept {
+    return cost;
+}
+
 void syntax::ast::ASTFunction::accept(syntax::ast::ASTVisitor& visitor) {
     visitor.visit(this);
 }
\ No newline at end of file
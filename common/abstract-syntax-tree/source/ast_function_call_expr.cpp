@@ -2,10 +2,11 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTFunctionCallExpr::ASTFunctionCallExpr(const syntax::Token& token, types::Type type) 
-    : ASTExpr(token, syntax::ast::ASTNodeType::FUNCTION_CALL_EXPR, type) {}
+syntax::ast::ASTFunctionCallExpr::ASTFunctionCallExpr(const syntax::Token& token, types::Type type, const allocator_type& alloc) 
+    : ASTExpr(token, syntax::ast::ASTNodeType::FUNCTION_CALL_EXPR, type), 
+      arguments{ alloc } {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTExpr>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTExpr>>& 
 syntax::ast::ASTFunctionCallExpr::getArguments() const noexcept {
     return arguments;
 }
@@ -14,7 +15,7 @@ const syntax::ast::ASTExpr* syntax::ast::ASTFunctionCallExpr::getArgumentAtN(siz
     return arguments[n].get();
 }
 
-void syntax::ast::ASTFunctionCallExpr::addArgument(std::unique_ptr<syntax::ast::ASTExpr> expr){
+void syntax::ast::ASTFunctionCallExpr::addArgument(syntax::ast::ASTPtr<syntax::ast::ASTExpr> expr){
     arguments.push_back(std::move(expr));
 }
 
@@ -6,7 +6,7 @@ syntax::ast::ASTFunctionCallStmt::ASTFunctionCallStmt(const syntax::Token& token
     : ASTStmt(token, syntax::ast::ASTNodeType::FUNCTION_CALL_STMT) {}
 
 void syntax::ast::ASTFunctionCallStmt::setFunctionCallStmt(
-    std::unique_ptr<syntax::ast::ASTFunctionCallExpr> callExpr
+    syntax::ast::ASTPtr<syntax::ast::ASTFunctionCallExpr> callExpr
 ){
     functionCallExpr = std::move(callExpr);
 }
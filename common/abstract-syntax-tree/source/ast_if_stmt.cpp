@@ -2,27 +2,29 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTIfStmt::ASTIfStmt(const syntax::Token& token) 
-    : ASTStmt(token, syntax::ast::ASTNodeType::IF_STMT) {}
+syntax::ast::ASTIfStmt::ASTIfStmt(const syntax::Token& token, const allocator_type& alloc) 
+    : ASTStmt(token, syntax::ast::ASTNodeType::IF_STMT), 
+      conditionExprs{ alloc }, 
+      stmts{ alloc } {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTExpr>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTExpr>>& 
 syntax::ast::ASTIfStmt::getConditionExprs() const noexcept {
     return conditionExprs;
 }
-const std::vector<std::unique_ptr<syntax::ast::ASTStmt>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTStmt>>& 
 syntax::ast::ASTIfStmt::getStmts() const noexcept {
     return stmts;
 }
 
 void syntax::ast::ASTIfStmt::addIfStmt(
-    std::unique_ptr<syntax::ast::ASTExpr> condition, 
-    std::unique_ptr<syntax::ast::ASTStmt> statement
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> condition, 
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement
 ){
     conditionExprs.push_back(std::move(condition));
     stmts.push_back(std::move(statement));
 }
 
-void syntax::ast::ASTIfStmt::addElseStmt(std::unique_ptr<syntax::ast::ASTStmt> statement){
+void syntax::ast::ASTIfStmt::addElseStmt(syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement){
     stmts.push_back(std::move(statement));
 }
 
@@ -2,14 +2,15 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTIncludeDir::ASTIncludeDir(const syntax::Token& token) 
-    : ASTDir(token, syntax::ast::ASTNodeType::INCLUDE_DIR) {}
+syntax::ast::ASTIncludeDir::ASTIncludeDir(const syntax::Token& token, const allocator_type& alloc) 
+    : ASTDir(token, syntax::ast::ASTNodeType::INCLUDE_DIR), 
+      libName{ alloc } {}
 
-const std::string& syntax::ast::ASTIncludeDir::getLibName() const noexcept {
+std::string_view syntax::ast::ASTIncludeDir::getLibName() const noexcept {
     return libName;
 }
 
-void syntax::ast::ASTIncludeDir::setLibName(const std::string& includedLibName) {
+void syntax::ast::ASTIncludeDir::setLibName(std::string_view includedLibName) {
     libName = includedLibName;
 }
 
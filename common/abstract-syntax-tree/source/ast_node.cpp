@@ -1,12 +1,48 @@
 #include "../ast_node.hpp"
 
+namespace {
+    /**
+     * @brief checks if the node is named by its token
+     * @param token - const reference to the token of the node
+     * @param ntype - type of the ast node
+     * @returns true if token is an identifier naming the node, false otherwise
+    */
+    bool isNamedNode(const syntax::Token& token, syntax::ast::ASTNodeType ntype) noexcept {
+        if(token.type != syntax::TokenType::ID){
+            return false;
+        }
+
+        switch(ntype){
+            case syntax::ast::ASTNodeType::FUNCTION:
+            case syntax::ast::ASTNodeType::PARAMETER:
+            case syntax::ast::ASTNodeType::VARIABLE_DECL_STMT:
+            case syntax::ast::ASTNodeType::FUNCTION_CALL_EXPR:
+            case syntax::ast::ASTNodeType::ID_EXPR:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+}
+
 syntax::ast::ASTNode::ASTNode(const syntax::Token& token, syntax::ast::ASTNodeType ntype) 
-    : token(token), nodeType(ntype) {}
+    : token(token), 
+      nodeType(ntype), 
+      symbolId(
+          isNamedNode(token, ntype) 
+              ? util::text::StringInterner::intern(token.value()) 
+              : util::text::StringInterner::emptyId
+      ) {}
 
 const syntax::Token& syntax::ast::ASTNode::getToken() const noexcept {
     return token;
 }
 
+util::text::SymbolId syntax::ast::ASTNode::getSymbolId() const noexcept {
+    return symbolId;
+}
+
 syntax::ast::ASTNodeType syntax::ast::ASTNode::getNodeType() const noexcept {
     return nodeType;
-}
\ No newline at end of file
+}
@@ -1,11 +1,23 @@
 #include "../ast_program.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "../defs/ast_defs.hpp"
 
 syntax::ast::ASTProgram::ASTProgram(const syntax::Token& token) 
     : ASTNode(token, syntax::ast::ASTNodeType::PROGRAM) {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTFunction>>& 
+syntax::ast::ASTArena& syntax::ast::ASTProgram::getArena() noexcept {
+    return arena;
+}
+
+syntax::ast::ASTArena& syntax::ast::ASTProgram::addArena(){
+    return *arenas.emplace_back(std::make_unique<syntax::ast::ASTArena>());
+}
+
+const std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>>& 
 syntax::ast::ASTProgram::getFunctions() const noexcept {
     return functions;
 }
@@ -18,7 +30,7 @@ const syntax::ast::ASTFunction* syntax::ast::ASTProgram::getFunctionAtN(size_t n
     return functions[n].get();
 }
 
-const std::vector<std::unique_ptr<syntax::ast::ASTDir>>& 
+const std::vector<syntax::ast::ASTPtr<syntax::ast::ASTDir>>& 
 syntax::ast::ASTProgram::getDirs() const noexcept {
     return dirs;
 }
@@ -27,14 +39,43 @@ const syntax::ast::ASTDir* syntax::ast::ASTProgram::getDirAtN(size_t n) const no
     return dirs[n].get();
 }
 
-void syntax::ast::ASTProgram::addFunction(std::unique_ptr<syntax::ast::ASTFunction> function){
+void syntax::ast::ASTProgram::addFunction(syntax::ast::ASTPtr<syntax::ast::ASTFunction> function){
     functions.push_back(std::move(function));
 }
 
-void syntax::ast::ASTProgram::addDir(std::unique_ptr<syntax::ast::ASTDir> directive) {
+void syntax::ast::ASTProgram::addDeclarations(std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>> declarations){
+    // libraries are declared before the source that includes them, same as when their source is spliced in
+    functions.insert(
+        functions.begin(), 
+        std::make_move_iterator(declarations.begin()), 
+        std::make_move_iterator(declarations.end())
+    );
+}
+
+void syntax::ast::ASTProgram::addDir(syntax::ast::ASTPtr<syntax::ast::ASTDir> directive) {
     dirs.push_back(std::move(directive));
 }
 
+void syntax::ast::ASTProgram::orderBySource(std::span<const uint16_t> sourceOrder){
+    // nodes of the files that are not listed keep their place after the listed ones
+    std::vector<size_t> ranks;
+    for(size_t i{ 0 }; i < sourceOrder.size(); ++i){
+        if(sourceOrder[i] >= ranks.size()){
+            ranks.resize(sourceOrder[i] + 1, sourceOrder.size());
+        }
+        ranks[sourceOrder[i]] = i;
+    }
+
+    auto rankOf{
+        [&ranks, unlisted=sourceOrder.size()](const auto& node) -> size_t {
+            const uint16_t sourceId{ node->getToken().sourceId };
+            return sourceId < ranks.size() ? ranks[sourceId] : unlisted;
+        }
+    };
+    std::ranges::stable_sort(functions, {}, rankOf);
+    std::ranges::stable_sort(dirs, {}, rankOf);
+}
+
 void syntax::ast::ASTProgram::accept(syntax::ast::ASTVisitor& visitor) {
     visitor.visit(this);
 }
\ No newline at end of file
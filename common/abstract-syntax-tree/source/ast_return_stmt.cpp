@@ -5,7 +5,7 @@
 syntax::ast::ASTReturnStmt::ASTReturnStmt(const syntax::Token& token) 
     : ASTStmt(token, syntax::ast::ASTNodeType::RETURN_STMT) {}
 
-void syntax::ast::ASTReturnStmt::setReturnExpr(std::unique_ptr<syntax::ast::ASTExpr> expr){
+void syntax::ast::ASTReturnStmt::setReturnExpr(syntax::ast::ASTPtr<syntax::ast::ASTExpr> expr){
     returnExpr = std::move(expr);
 }
 
@@ -2,15 +2,16 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTSwitchBlockStmt::ASTSwitchBlockStmt(const syntax::Token& token) 
-    : ASTStmt(token, syntax::ast::ASTNodeType::SWITCH_BLOCK_STMT) {}
+syntax::ast::ASTSwitchBlockStmt::ASTSwitchBlockStmt(const syntax::Token& token, const allocator_type& alloc) 
+    : ASTStmt(token, syntax::ast::ASTNodeType::SWITCH_BLOCK_STMT), 
+      stmts{ alloc } {}
 
-const std::vector<std::unique_ptr<syntax::ast::ASTStmt>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTStmt>>& 
 syntax::ast::ASTSwitchBlockStmt::getStmts() const noexcept {
     return stmts;
 }
 
-void syntax::ast::ASTSwitchBlockStmt::addStmt(std::unique_ptr<syntax::ast::ASTStmt> stmt){
+void syntax::ast::ASTSwitchBlockStmt::addStmt(syntax::ast::ASTPtr<syntax::ast::ASTStmt> stmt){
     stmts.push_back(std::move(stmt));
 }
 
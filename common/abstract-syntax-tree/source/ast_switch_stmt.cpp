@@ -2,23 +2,24 @@
 
 #include "../defs/ast_defs.hpp"
 
-syntax::ast::ASTSwitchStmt::ASTSwitchStmt(const syntax::Token& token) 
-    : ASTStmt(token, syntax::ast::ASTNodeType::SWITCH_STMT) {}
+syntax::ast::ASTSwitchStmt::ASTSwitchStmt(const syntax::Token& token, const allocator_type& alloc) 
+    : ASTStmt(token, syntax::ast::ASTNodeType::SWITCH_STMT), 
+      caseStmts{ alloc } {}
 
-void syntax::ast::ASTSwitchStmt::setVariableIdExpr(std::unique_ptr<syntax::ast::ASTIdExpr> idExpr){
+void syntax::ast::ASTSwitchStmt::setVariableIdExpr(syntax::ast::ASTPtr<syntax::ast::ASTIdExpr> idExpr){
     variableIdExpr = std::move(idExpr);
 }
 
-const std::vector<std::unique_ptr<syntax::ast::ASTCaseStmt>>& 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTCaseStmt>>& 
 syntax::ast::ASTSwitchStmt::getCaseStmts() const noexcept {
     return caseStmts;
 }
 
-void syntax::ast::ASTSwitchStmt::addCaseStmt(std::unique_ptr<syntax::ast::ASTCaseStmt> caseStmt){
+void syntax::ast::ASTSwitchStmt::addCaseStmt(syntax::ast::ASTPtr<syntax::ast::ASTCaseStmt> caseStmt){
     caseStmts.push_back(std::move(caseStmt));
 }
 
-void syntax::ast::ASTSwitchStmt::setDefaultStmt(std::unique_ptr<syntax::ast::ASTDefaultStmt> swDefaultStmt){
+void syntax::ast::ASTSwitchStmt::setDefaultStmt(syntax::ast::ASTPtr<syntax::ast::ASTDefaultStmt> swDefaultStmt){
     defaultStmt = std::move(swDefaultStmt);
 }
 
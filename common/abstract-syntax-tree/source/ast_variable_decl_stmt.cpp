@@ -13,7 +13,7 @@ void syntax::ast::ASTVariableDeclStmt::setType(types::Type variableType) noexcep
     type = variableType;
 }
 
-void syntax::ast::ASTVariableDeclStmt::setAssignExpr(std::unique_ptr<syntax::ast::ASTExpr> expr){
+void syntax::ast::ASTVariableDeclStmt::setAssignExpr(syntax::ast::ASTPtr<syntax::ast::ASTExpr> expr){
     assignExpr = std::move(expr);
 }
 
@@ -6,8 +6,8 @@ syntax::ast::ASTWhileStmt::ASTWhileStmt(const syntax::Token& token)
     : ASTStmt(token, syntax::ast::ASTNodeType::WHILE_STMT) {}
 
 void syntax::ast::ASTWhileStmt::setWhileStmt(
-    std::unique_ptr<syntax::ast::ASTExpr> cond, 
-    std::unique_ptr<syntax::ast::ASTStmt> statement
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> cond, 
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> statement
 ){
     conditionExpr = std::move(cond);
     stmt = std::move(statement);
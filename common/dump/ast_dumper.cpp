@@ -13,7 +13,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTProgram* program){
     {
         util::format::IndentGuard dirGuard{indent};
         for(const auto& dir : program->getDirs()){
-            dir->accept(*this);
+            visitNode(dir);
         }
     }
 
@@ -21,7 +21,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTProgram* program){
     {
         util::format::IndentGuard functionsGuard{indent};
         for(const auto& func : program->getFunctions()){
-            func->accept(*this);
+            visitNode(func);
         }
     }
 }
@@ -39,7 +39,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTFunction* function){
     {
         util::format::IndentGuard paramGuard{indent};
         for(const auto& param : function->getParameters()){
-            param->accept(*this);
+            visitNode(param);
         }
     }
 
@@ -47,7 +47,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTFunction* function){
         dumpNode("BODY");
         util::format::IndentGuard bodyGuard{indent};
         for(const auto& stmt : function->getBody()){
-            stmt->accept(*this);
+            visitNode(stmt);
         }
     }
 }
@@ -61,7 +61,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTVariableDeclStmt* variableDec
 
     if(variableDecl->hasAssignExpr()){
         util::format::IndentGuard variableGuard{indent};
-        variableDecl->getAssignExpr()->accept(*this);
+        visitNode(variableDecl->getAssignExpr());
     }
 }
 
@@ -69,8 +69,8 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTAssignStmt* assignStmt){
     dumpNode(assignStmt);
     
     util::format::IndentGuard assignGuard{indent};
-    assignStmt->getVariableIdExpr()->accept(*this);
-    assignStmt->getAssignedExpr()->accept(*this);
+    visitNode(assignStmt->getVariableIdExpr());
+    visitNode(assignStmt->getAssignedExpr());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTCompoundStmt* compoundStmt){
@@ -78,7 +78,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTCompoundStmt* compoundStmt){
 
     util::format::IndentGuard compoundGuard{indent};
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
@@ -87,22 +87,22 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTForStmt* forStmt){
 
     util::format::IndentGuard forGuard{indent};
     if(forStmt->hasInitializerStmt()){
-        forStmt->getInitializerStmt()->accept(*this);
+        visitNode(forStmt->getInitializerStmt());
     }
     if(forStmt->hasConditionExpr()){
-        forStmt->getConditionExpr()->accept(*this);
+        visitNode(forStmt->getConditionExpr());
     }
     if(forStmt->hasIncrementerStmt()){
-        forStmt->getIncrementerStmt()->accept(*this);
+        visitNode(forStmt->getIncrementerStmt());
     }
-    forStmt->getStmt()->accept(*this);
+    visitNode(forStmt->getStmt());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTFunctionCallStmt* callStmt){
     dumpNode(callStmt);
 
     util::format::IndentGuard callGuard{indent};
-    callStmt->getFunctionCallExpr()->accept(*this);
+    visitNode(callStmt->getFunctionCallExpr());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTIfStmt* ifStmt){
@@ -113,11 +113,11 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTIfStmt* ifStmt){
     const auto& statements{ ifStmt->getStmts() };
 
     for(size_t i{0}; i < conditions.size(); ++i){
-        conditions[i]->accept(*this);
-        statements[i]->accept(*this);
+        visitNode(conditions[i]);
+        visitNode(statements[i]);
     }
     if(ifStmt->hasElseStmt()){
-        statements.back()->accept(*this);
+        visitNode(statements.back());
     }
 }
 
@@ -126,7 +126,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTReturnStmt* returnStmt){
 
     if(returnStmt->hasReturnExpr()){
         util::format::IndentGuard returnGuard{indent};
-        returnStmt->getReturnExpr()->accept(*this);
+        visitNode(returnStmt->getReturnExpr());
     }
 }
 
@@ -134,28 +134,28 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTWhileStmt* whileStmt){
     dumpNode(whileStmt);
 
     util::format::IndentGuard whileGuard{indent};
-    whileStmt->getConditionExpr()->accept(*this);
-    whileStmt->getStmt()->accept(*this);
+    visitNode(whileStmt->getConditionExpr());
+    visitNode(whileStmt->getStmt());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTDoWhileStmt* dowhileStmt){
     dumpNode(dowhileStmt);
 
     util::format::IndentGuard dowhileGuard{indent};
-    dowhileStmt->getConditionExpr()->accept(*this);
-    dowhileStmt->getStmt()->accept(*this);
+    visitNode(dowhileStmt->getConditionExpr());
+    visitNode(dowhileStmt->getStmt());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTSwitchStmt* switchStmt){
     dumpNode(switchStmt);
 
     util::format::IndentGuard switchGuard{indent};
-    switchStmt->getVariableIdExpr()->accept(*this);
+    visitNode(switchStmt->getVariableIdExpr());
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this);
+        visitNode(caseStmt);
     }
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
 }
 
@@ -163,8 +163,8 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTCaseStmt* caseStmt){
     dumpNode(caseStmt);
 
     util::format::IndentGuard caseGuard{indent};
-    caseStmt->getLiteralExpr()->accept(*this);
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getLiteralExpr());
+    visitNode(caseStmt->getSwitchBlockStmt());
     if(caseStmt->hasBreakStmt()){
         dumpNode("BREAK");
     }
@@ -174,7 +174,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTDefaultStmt* defaultStmt){
     dumpNode(defaultStmt);
 
     util::format::IndentGuard defaultGuard{indent};
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTSwitchBlockStmt* switchBlockStmt){
@@ -182,7 +182,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTSwitchBlockStmt* switchBlockS
 
     util::format::IndentGuard switchBlockGuard{indent};
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
@@ -190,8 +190,8 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTBinaryExpr* binaryExpr){
     dumpNode(binaryExpr);
 
     util::format::IndentGuard binaryExprGuard{indent};
-    binaryExpr->getLeftOperandExpr()->accept(*this);
-    binaryExpr->getRightOperandExpr()->accept(*this);
+    visitNode(binaryExpr->getLeftOperandExpr());
+    visitNode(binaryExpr->getRightOperandExpr());
 }
 
 void syntax::ast::ASTDumper::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
@@ -199,7 +199,7 @@ void syntax::ast::ASTDumper::visit(syntax::ast::ASTFunctionCallExpr* callExpr){
 
     util::format::IndentGuard callGuard{indent};
     for(const auto& arg : callExpr->getArguments()){
-        arg->accept(*this);
+        visitNode(arg);
     }
 }
 
@@ -219,7 +219,7 @@ void syntax::ast::ASTDumper::dumpNode(const syntax::ast::ASTNode* node){
     dumpIndent();
     out << "|-> " 
         << syntax::ast::astNodeTypeToStr(node->getNodeType()) 
-        << " | '" << node->getToken().value 
+        << " | '" << node->getToken().value() 
         << "'\n";
 }
 
@@ -4,7 +4,7 @@
 #include <ostream>
 #include <string_view>
 
-#include "../visitor/ast_visitor.hpp"
+#include "../visitor/ast_static_visitor.hpp"
 #include "../abstract-syntax-tree/ast_node.hpp"
 #include "../abstract-syntax-tree/ast_program.hpp"
 #include "../abstract-syntax-tree/ast_include_dir.hpp"
@@ -34,7 +34,7 @@ namespace syntax::ast {
     * @brief dumps the structure of the abstract syntax tree
     * @details inherits ASTVisitor
     */
-    class ASTDumper final : public ASTVisitor {
+    class ASTDumper final : public ASTStaticVisitor<ASTDumper> {
     public:
         /**
         * @brief creates the ast dumper instance
@@ -46,127 +46,127 @@ namespace syntax::ast {
         * @brief dumps the ast program
         * @param program - pointer to the ast program
         */
-        void visit(ASTProgram* program) final override;
+        void visit(ASTProgram* program);
 
         /**
         * @brief dumps the ast include directive
         * @param lib - pointer to the ast include directive
         */
-        void visit(ASTIncludeDir* lib) final override;
+        void visit(ASTIncludeDir* lib);
 
         /**
         * @brief dumps the ast function
         * @param function - pointer to the ast function
         */
-        void visit(ASTFunction* function) final override;
+        void visit(ASTFunction* function);
 
         /**
         * @brief dumps the ast parameter
         * @param parameter - pointer to the ast parameter
         */
-        void visit(ASTParameter* parameter) final override;
+        void visit(ASTParameter* parameter);
 
         /**
         * @brief dumps the ast variable declaration
         * @param variableDecl - pointer to the ast variable declaration
         */
-        void visit(ASTVariableDeclStmt* variableDecl) final override;
+        void visit(ASTVariableDeclStmt* variableDecl);
 
         /**
         * @brief dumps the ast assign statement
         * @param assignStmt - pointer to the ast assign statement
         */
-        void visit(ASTAssignStmt* assignStmt) final override;
+        void visit(ASTAssignStmt* assignStmt);
 
         /**
         * @brief dumps the ast compound statement
         * @param compoundStmt - pointer to the ast compound statement
         */
-        void visit(ASTCompoundStmt* compoundStmt) final override;
+        void visit(ASTCompoundStmt* compoundStmt);
 
         /**
         * @brief dumps the ast for statement
         * @param forStmt - pointer to the ast for statement
         */
-        void visit(ASTForStmt* forStmt) final override;
+        void visit(ASTForStmt* forStmt);
 
         /**
         * @brief dumps the ast function-call statement
         * @param callStmt - pointer to the ast function-call statement
         */
-        void visit(ASTFunctionCallStmt* callStmt) final override;
+        void visit(ASTFunctionCallStmt* callStmt);
 
         /**
         * @brief dumps the ast if statement
         * @param ifStmt - pointer to the ast if statement
         */
-        void visit(ASTIfStmt* ifStmt) final override;
+        void visit(ASTIfStmt* ifStmt);
 
         /**
         * @brief dumps the ast return statement
         * @param returnStmt - pointer to the ast return statement
         */
-        void visit(ASTReturnStmt* returnStmt) final override;
+        void visit(ASTReturnStmt* returnStmt);
 
         /**
         * @brief dumps the ast while statement
         * @param whileStmt - pointer to the ast while statement
         */
-        void visit(ASTWhileStmt* whileStmt) final override;
+        void visit(ASTWhileStmt* whileStmt);
 
         /**
         * @brief dumps the ast dowhile statement
         * @param dowhileStmt - pointer to the ast dowhile statement
         */
-        void visit(ASTDoWhileStmt* dowhileStmt) final override;
+        void visit(ASTDoWhileStmt* dowhileStmt);
         
         /**
         * @brief dumps the ast switch statement
         * @param switchStmt - pointer to the ast switch statement
         */
-        void visit(ASTSwitchStmt* switchStmt) final override;
+        void visit(ASTSwitchStmt* switchStmt);
 
         /**
         * @brief dumps the ast case statement
         * @param caseStmt - pointer to the ast case statement
         */
-        void visit(ASTCaseStmt* caseStmt) final override;
+        void visit(ASTCaseStmt* caseStmt);
 
         /**
         * @brief dumps the ast default statement
         * @param defaultStmt - pointer to the ast default statement
         */
-        void visit(ASTDefaultStmt* defaultStmt) final override;
+        void visit(ASTDefaultStmt* defaultStmt);
         
         /**
         * @brief dumps the ast switch block statement
         * @param switchBlockStmt - pointer to the ast switch block statement
         */
-        void visit(ASTSwitchBlockStmt* switchBlockStmt) final override;
+        void visit(ASTSwitchBlockStmt* switchBlockStmt);
 
         /**
         * @brief dumps the ast binary expression
         * @param binaryExpr - pointer to the ast binary expression
         */
-        void visit(ASTBinaryExpr* binaryExpr) final override;
+        void visit(ASTBinaryExpr* binaryExpr);
 
         /**
         * @brief dumps the ast function-call expression
         * @param callExpr - pointer to the ast function-call expression
         */
-        void visit(ASTFunctionCallExpr* callExpr) final override;
+        void visit(ASTFunctionCallExpr* callExpr);
 
         /**
         * @brief dumps the ast id expression
         * @param idExpr - pointer to the ast id expression
         */
-        void visit(ASTIdExpr* idExpr) final override;
+        void visit(ASTIdExpr* idExpr);
 
         /**
         * @brief dumps the ast literal expression
         * @param literalExpr - pointer to the ast literal expression
         */
-        void visit(ASTLiteralExpr* literalExpr) final override;
+        void visit(ASTLiteralExpr* literalExpr);
 
     private:
         /// output stream
@@ -14,7 +14,7 @@ void ir::IRDumper::visit(ir::IRProgram* program){
 
     util::format::IndentGuard programGuard{indent};
     for(const auto& function : program->getFunctions()){
-        function->accept(*this);
+        visitNode(function);
     }
 }
 
@@ -32,7 +32,7 @@ void ir::IRDumper::visit(ir::IRFunction* function){
     {
         util::format::IndentGuard paramGuard{indent};
         for(const auto& param : function->getParameters()){
-            param->accept(*this);
+            visitNode(param);
         }
     }
 
@@ -40,7 +40,7 @@ void ir::IRDumper::visit(ir::IRFunction* function){
         dumpNode("BODY");
         util::format::IndentGuard bodyGuard{indent};
         for(const auto& stmt : function->getBody()){
-            stmt->accept(*this);
+            visitNode(stmt);
         }
     }
 }
@@ -63,10 +63,10 @@ void ir::IRDumper::visit(ir::IRVariableDeclStmt* variableDecl){
 
     util::format::IndentGuard variableGuard{indent};
     if(variableDecl->hasTemporaryExpr()){
-        variableDecl->getTemporaryExpr()->accept(*this);
+        visitNode(variableDecl->getTemporaryExpr());
     }
     if(variableDecl->hasAssignExpr()){
-        variableDecl->getAssignExpr()->accept(*this);
+        visitNode(variableDecl->getAssignExpr());
     }
 }
 
@@ -74,11 +74,11 @@ void ir::IRDumper::visit(ir::IRAssignStmt* assignStmt){
     dumpNode(assignStmt);
 
     util::format::IndentGuard assignGuard{indent};
-    assignStmt->getVariableIdExpr()->accept(*this);
+    visitNode(assignStmt->getVariableIdExpr());
     if(assignStmt->hasTemporaryExpr()){
-        assignStmt->getTemporaryExpr()->accept(*this);
+        visitNode(assignStmt->getTemporaryExpr());
     }
-    assignStmt->getAssignedExpr()->accept(*this);
+    visitNode(assignStmt->getAssignedExpr());
 }
 
 void ir::IRDumper::visit(ir::IRCompoundStmt* compoundStmt){
@@ -86,7 +86,7 @@ void ir::IRDumper::visit(ir::IRCompoundStmt* compoundStmt){
 
     util::format::IndentGuard compoundGuard{indent};
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
@@ -95,25 +95,25 @@ void ir::IRDumper::visit(ir::IRForStmt* forStmt){
 
     util::format::IndentGuard forGuard{indent};
     if(forStmt->hasTemporaryExpr()){
-        forStmt->getTemporaryExpr()->accept(*this);
+        visitNode(forStmt->getTemporaryExpr());
     }
     if(forStmt->hasInitializerStmt()){
-        forStmt->getInitializerStmt()->accept(*this);
+        visitNode(forStmt->getInitializerStmt());
     }
     if(forStmt->hasConditionExpr()){
-        forStmt->getConditionExpr()->accept(*this);
+        visitNode(forStmt->getConditionExpr());
     }
     if(forStmt->hasIncrementerStmt()){
-        forStmt->getIncrementerStmt()->accept(*this);
+        visitNode(forStmt->getIncrementerStmt());
     }
-    forStmt->getStmt()->accept(*this);
+    visitNode(forStmt->getStmt());
 }
 
 void ir::IRDumper::visit(ir::IRFunctionCallStmt* callStmt){
     dumpNode(callStmt);
 
     util::format::IndentGuard callGuard{indent};
-    callStmt->getFunctionCallExpr()->accept(*this);
+    visitNode(callStmt->getFunctionCallExpr());
 }
 
 void ir::IRDumper::visit(ir::IRIfStmt* ifStmt){
@@ -126,13 +126,13 @@ void ir::IRDumper::visit(ir::IRIfStmt* ifStmt){
     util::format::IndentGuard ifGuard{indent};
     for(size_t i{0}; i < conditions.size(); ++i){
         if(temporaries[i]){
-            temporaries[i]->accept(*this);
+            visitNode(temporaries[i]);
         }
-        conditions[i]->accept(*this);
-        statements[i]->accept(*this);
+        visitNode(conditions[i]);
+        visitNode(statements[i]);
     }
     if(ifStmt->hasElseStmt()){
-        statements.back()->accept(*this);
+        visitNode(statements.back());
     }
 }
 
@@ -141,10 +141,10 @@ void ir::IRDumper::visit(ir::IRReturnStmt* returnStmt){
 
     util::format::IndentGuard returnGuard{indent};
     if(returnStmt->hasTemporaryExpr()){
-        returnStmt->getTemporaryExpr()->accept(*this);
+        visitNode(returnStmt->getTemporaryExpr());
     }
     if(returnStmt->hasReturnValue()){
-        returnStmt->getReturnExpr()->accept(*this);
+        visitNode(returnStmt->getReturnExpr());
     }
 }
 
@@ -153,10 +153,10 @@ void ir::IRDumper::visit(ir::IRWhileStmt* whileStmt){
 
     util::format::IndentGuard whileGuard{indent};
     if(whileStmt->hasTemporaryExpr()){
-        whileStmt->getTemporaryExpr()->accept(*this);
+        visitNode(whileStmt->getTemporaryExpr());
     }
-    whileStmt->getConditionExpr()->accept(*this);
-    whileStmt->getStmt()->accept(*this);
+    visitNode(whileStmt->getConditionExpr());
+    visitNode(whileStmt->getStmt());
 }
 
 void ir::IRDumper::visit(ir::IRDoWhileStmt* dowhileStmt){
@@ -164,22 +164,22 @@ void ir::IRDumper::visit(ir::IRDoWhileStmt* dowhileStmt){
 
     util::format::IndentGuard dowhileGuard{indent};
     if(dowhileStmt->hasTemporaryExpr()){
-        dowhileStmt->getTemporaryExpr()->accept(*this);
+        visitNode(dowhileStmt->getTemporaryExpr());
     }
-    dowhileStmt->getConditionExpr()->accept(*this);
-    dowhileStmt->getStmt()->accept(*this);
+    visitNode(dowhileStmt->getConditionExpr());
+    visitNode(dowhileStmt->getStmt());
 }
 
 void ir::IRDumper::visit(ir::IRSwitchStmt* switchStmt){
     dumpNode(switchStmt);
 
     util::format::IndentGuard switchGuard{indent};
-    switchStmt->getVariableIdExpr()->accept(*this);
+    visitNode(switchStmt->getVariableIdExpr());
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this);
+        visitNode(caseStmt);
     }
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
 }
 
@@ -187,8 +187,8 @@ void ir::IRDumper::visit(ir::IRCaseStmt* caseStmt){
     dumpNode(caseStmt);
 
     util::format::IndentGuard caseGuard{indent};
-    caseStmt->getLiteralExpr()->accept(*this);
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getLiteralExpr());
+    visitNode(caseStmt->getSwitchBlockStmt());
     if(caseStmt->hasBreakStmt()){
         dumpNode("BREAK");
     }
@@ -198,7 +198,7 @@ void ir::IRDumper::visit(ir::IRDefaultStmt* defaultStmt){
     dumpNode(defaultStmt);
 
     util::format::IndentGuard defaultGuard{indent};
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void ir::IRDumper::visit(ir::IRSwitchBlockStmt* switchBlockStmt){
@@ -206,7 +206,7 @@ void ir::IRDumper::visit(ir::IRSwitchBlockStmt* switchBlockStmt){
 
     util::format::IndentGuard switchBlockGuard{indent};
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
@@ -217,8 +217,8 @@ void ir::IRDumper::visit(ir::IRBinaryExpr* binaryExpr){
     );
 
     util::format::IndentGuard binaryExprGuard{indent};
-    binaryExpr->getLeftOperandExpr()->accept(*this);
-    binaryExpr->getRightOperandExpr()->accept(*this);
+    visitNode(binaryExpr->getLeftOperandExpr());
+    visitNode(binaryExpr->getRightOperandExpr());
 }
 
 void ir::IRDumper::visit(ir::IRFunctionCallExpr* callExpr){
@@ -230,9 +230,9 @@ void ir::IRDumper::visit(ir::IRFunctionCallExpr* callExpr){
     util::format::IndentGuard callGuard{indent};
     for(size_t i{0}; i < arguments.size(); ++i){
         if(temporaries[i]){
-            temporaries[i]->accept(*this);
+            visitNode(temporaries[i]);
         }
-        arguments[i]->accept(*this);
+        visitNode(arguments[i]);
     }
 }
 
@@ -255,14 +255,13 @@ void ir::IRDumper::visit(ir::IRLiteralExpr* literalExpr){
 void ir::IRDumper::visit(ir::IRTemporaryExpr* tempExpr){
     dumpNode(tempExpr);
 
-    const auto& names{ tempExpr->getTemporaryNames() };
     const auto& exprs{ tempExpr->getTemporaryExprs() };
 
     util::format::IndentGuard tempGuard{indent};
     for(size_t i{0}; i < exprs.size(); ++i){
-        dumpNode(names[i]);
+        dumpNode(tempExpr->getTemporaryNameAtN(i));
         util::format::IndentGuard exprGuard{indent};
-        exprs[i]->accept(*this);
+        visitNode(exprs[i]);
     }
 }
 
@@ -4,7 +4,7 @@
 #include <ostream>
 #include <string_view>
 
-#include "../visitor/ir_visitor.hpp"
+#include "../visitor/ir_static_visitor.hpp"
 #include "../intermediate-representation-tree/ir_node.hpp"
 #include "../intermediate-representation-tree/ir_program.hpp"
 #include "../intermediate-representation-tree/ir_function.hpp"
@@ -34,7 +34,7 @@ namespace ir {
      * @brief dumps the structure of the intermediate representation
      * @details inherits IRVisitor
     */
-    class IRDumper final : public IRVisitor {
+    class IRDumper final : public IRStaticVisitor<IRDumper> {
     public:
         /**
          * @brief creates the instance of the ir dumper
@@ -46,127 +46,127 @@ namespace ir {
          * @brief dumps the ir program
          * @param program - pointer to the ir program
         */
-        void visit(IRProgram* program) final override;
+        void visit(IRProgram* program);
 
         /**
          * @brief dumps the ir function
          * @param function - pointer to the ir function
         */
-        void visit(IRFunction* function) final override;
+        void visit(IRFunction* function);
 
         /**
          * @brief dumps the ir parameter
          * @param parameter - pointer to the ir parameter
         */
-        void visit(IRParameter* parameter) final override;
+        void visit(IRParameter* parameter);
 
         /**
          * @brief dumps the ir variable declaration
          * @param variableDecl - pointer to the ir variable declaration
         */
-        void visit(IRVariableDeclStmt* variableDecl) final override;
+        void visit(IRVariableDeclStmt* variableDecl);
 
         /**
          * @brief dumps the ir assign statement
          * @param assignStmt - pointer to the ir assign statement
         */
-        void visit(IRAssignStmt* assignStmt) final override;
+        void visit(IRAssignStmt* assignStmt);
 
         /**
          * @brief dumps the ir compound statement
          * @param compoundStmt - pointer to the ir compound statement
         */
-        void visit(IRCompoundStmt* compoundStmt) final override;
+        void visit(IRCompoundStmt* compoundStmt);
 
         /**
          * @brief dumps the ir for statement
          * @param forStmt - pointer to the ir for statement
         */
-        void visit(IRForStmt* forStmt) final override;
+        void visit(IRForStmt* forStmt);
 
         /**
          * @brief dumps the ir function-call statement
          * @param callStmt - pointer to the ir function-call statement
         */
-        void visit(IRFunctionCallStmt* callStmt) final override;
+        void visit(IRFunctionCallStmt* callStmt);
 
         /**
          * @brief dumps the ir if statement
          * @param ifStmt - pointer to the ir if statement
         */
-        void visit(IRIfStmt* ifStmt) final override;
+        void visit(IRIfStmt* ifStmt);
 
         /**
          * @brief dumps the ir return statement
          * @param returnStmt - pointer to the ir return statement
         */
-        void visit(IRReturnStmt* returnStmt) final override;
+        void visit(IRReturnStmt* returnStmt);
 
         /**
          * @brief dumps the ir while statement
          * @param whileStmt - pointer to the ir while statement
         */
-        void visit(IRWhileStmt* whileStmt) final override;
+        void visit(IRWhileStmt* whileStmt);
 
         /**
          * @brief dumps the ir dowhile statement
          * @param dowhileStmt - pointer to the ir dowhile statement
         */
-        void visit(IRDoWhileStmt* dowhileStmt) final override;
+        void visit(IRDoWhileStmt* dowhileStmt);
 
         /**
          * @brief dumps the ir switch statement
          * @param switchStmt - pointer to the ir switch statement
         */
-        void visit(IRSwitchStmt* switchStmt) final override;
+        void visit(IRSwitchStmt* switchStmt);
 
         /**
          * @brief dumps the ir case statement
          * @param caseStmt - pointer to the ir case statement
         */
-        void visit(IRCaseStmt* caseStmt) final override;
+        void visit(IRCaseStmt* caseStmt);
 
         /**
          * @brief dumps the ir default statement
          * @param defaultStmt - pointer to the ir default statement
         */
-        void visit(IRDefaultStmt* defaultStmt) final override;
+        void visit(IRDefaultStmt* defaultStmt);
 
         /**
          * @brief dumps the ir switch block statement
          * @param switchBlockStmt - pointer to the ir switch block statement
         */
-        void visit(IRSwitchBlockStmt* switchBlockStmt) final override;
+        void visit(IRSwitchBlockStmt* switchBlockStmt);
 
         /**
          * @brief dumps the ir binary expression
          * @param binaryExpr - pointer to the ir binary expression
         */
-        void visit(IRBinaryExpr* binaryExpr) final override;
+        void visit(IRBinaryExpr* binaryExpr);
 
         /**
          * @brief dumps the ir function-call expression
          * @param callExpr - pointer to the ir function-call expression
         */
-        void visit(IRFunctionCallExpr* callExpr) final override;
+        void visit(IRFunctionCallExpr* callExpr);
 
         /**
          * @brief dumps the ir id expression
          * @param idExpr - pointer to the ir id expression
         */
-        void visit(IRIdExpr* idExpr) final override;
+        void visit(IRIdExpr* idExpr);
 
         /**
          * @brief dumps the ir literal expression
          * @param literalExpr - pointer to the ir literal expression
         */
-        void visit(IRLiteralExpr* literalExpr) final override;
+        void visit(IRLiteralExpr* literalExpr);
         
         /**
          * @brief dumps the ir temporary expression
          * @param tempExpr - pointer to the ir temporary expression
         */
-        void visit(IRTemporaryExpr* tempExpr) final override;
+        void visit(IRTemporaryExpr* tempExpr);
 
     private:
         /// reference to output stream
@@ -0,0 +1,85 @@
+#ifndef IR_ARENA_HPP
+#define IR_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace ir {
+    /**
+     * @struct IRDeleter
+     * @brief deleter of the nodes placed into an arena
+     * @details does nothing, storage of the node is released together with the whole arena
+    */
+    struct IRDeleter {
+        /**
+         * @brief leaves the node to its arena
+        */
+        template<typename T>
+        void operator()(T*) const noexcept {}
+
+    };
+
+    /// owning handle of a node placed into an arena
+    template<typename T>
+    using IRPtr = std::unique_ptr<T, IRDeleter>;
+
+    /**
+     * @class IRArena
+     * @brief bump allocator the irt nodes of a single function are placed into
+     * @details arena is owned by its function and filled by the worker that lowers it,
+     * nodes dropped by folding or dead code elimination stay in the arena until the function is destroyed,
+     * destructors of the nodes are never run, nodes must not own memory outside of the arena
+    */
+    class IRArena {
+    public:
+        /// allocator handed to the nodes that own lists or strings
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        /**
+         * @brief Creates empty arena
+        */
+        IRArena();
+
+        /// deleted copy constructor
+        IRArena(const IRArena&) = delete;
+
+        /// deleted copy assignment operator
+        IRArena& operator=(const IRArena&) = delete;
+
+        /**
+         * @brief places new node into the arena
+         * @tparam T - type of the node
+         * @param args - arguments of the node constructor, arena allocator is appended for allocator aware nodes
+         * @returns handle of the node
+        */
+        template<typename T, typename... Args>
+        IRPtr<T> make(Args&&... args) {
+            void* storage{ resource.allocate(sizeof(T), alignof(T)) };
+            return IRPtr<T>{
+                std::uninitialized_construct_using_allocator(
+                    static_cast<T*>(storage), allocator_type{ &resource }, std::forward<Args>(args)...
+                )
+            };
+        }
+
+        /**
+         * @brief getter for the allocator of the arena
+         * @returns allocator placing memory into the arena
+        */
+        allocator_type getAllocator() noexcept;
+
+    private:
+        /// size of the first block, following blocks grow geometrically
+        static constexpr size_t initialBlockSize{ 4 * 1024 };
+
+        /// memory of the arena
+        std::pmr::monotonic_buffer_resource resource;
+
+    };
+
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
@@ -56,9 +57,9 @@ namespace ir {
          * @param tempExpr - pointer to the temporary (default nullptr)
         */
         void setAssignStmt(
-            std::unique_ptr<IRIdExpr> idExpr, 
-            std::unique_ptr<IRExpr> expr, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRIdExpr> idExpr, 
+            IRPtr<IRExpr> expr, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /**
@@ -75,13 +76,13 @@ namespace ir {
 
     private:
         /// pointer to the id of the variable
-        std::unique_ptr<IRIdExpr> variableIdExpr;
+        IRPtr<IRIdExpr> variableIdExpr;
 
         /// pointer to the expression assigned to the variable
-        std::unique_ptr<IRExpr> assignedExpr;
+        IRPtr<IRExpr> assignedExpr;
 
         /// pointer to the temporaries of the assignment statement
-        std::unique_ptr<IRTemporaryExpr> temporaryExpr;
+        IRPtr<IRTemporaryExpr> temporaryExpr;
 
     };
 
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_expr.hpp"
 #include "../defs/types.hpp"
 #include "../visitor/ir_visitor.hpp"
@@ -52,8 +53,8 @@ namespace ir {
          * @param op - operator of the binary expression
         */
         void setBinaryExpr(
-            std::unique_ptr<IRExpr> leftOperand, 
-            std::unique_ptr<IRExpr> rightOperand, 
+            IRPtr<IRExpr> leftOperand, 
+            IRPtr<IRExpr> rightOperand, 
             syntax::Operator op
         );
 
@@ -65,10 +66,10 @@ namespace ir {
 
     private:
         /// pointer to the left operand of the binary expression
-        std::unique_ptr<IRExpr> leftOperandExpr;
+        IRPtr<IRExpr> leftOperandExpr;
 
         /// pointer to the right operand of the binary expression
-        std::unique_ptr<IRExpr> rightOperandExpr;
+        IRPtr<IRExpr> rightOperandExpr;
         
         /// operator of the binary expression
         syntax::Operator exprOperator;
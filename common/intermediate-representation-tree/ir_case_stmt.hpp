@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_literal_expr.hpp"
 #include "ir_switch_block_stmt.hpp"
@@ -45,8 +46,8 @@ namespace ir {
          * @param hasBreak - flag whether or not case statement has break
         */
         void setCase(
-            std::unique_ptr<IRLiteralExpr> litExpr, 
-            std::unique_ptr<IRSwitchBlockStmt> swBlockStmt, 
+            IRPtr<IRLiteralExpr> litExpr, 
+            IRPtr<IRSwitchBlockStmt> swBlockStmt, 
             bool hasBreak
         );
 
@@ -64,10 +65,10 @@ namespace ir {
 
     private:
         /// pointer to the literal of the case
-        std::unique_ptr<IRLiteralExpr> literalExpr;
+        IRPtr<IRLiteralExpr> literalExpr;
 
         /// pointer to the switch-block of the case
-        std::unique_ptr<IRSwitchBlockStmt> switchBlockStmt;
+        IRPtr<IRSwitchBlockStmt> switchBlockStmt;
 
         /// flag if case breaks
         bool breaks;
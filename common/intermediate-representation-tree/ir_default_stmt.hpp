@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_switch_block_stmt.hpp"
 #include "../visitor/ir_visitor.hpp"
@@ -32,7 +33,7 @@ namespace ir {
          * @brief initializes the default statement node
          * @param swBlockStmt - pointer to a switch block node
         */
-        void setSwitchBlock(std::unique_ptr<IRSwitchBlockStmt> swBlockStmt);
+        void setSwitchBlock(IRPtr<IRSwitchBlockStmt> swBlockStmt);
 
         /**
          * @brief accepts the ir visitor
@@ -42,7 +43,7 @@ namespace ir {
 
     private:
         /// pointer to the switch-block of the default case
-        std::unique_ptr<IRSwitchBlockStmt> switchBlockStmt;
+        IRPtr<IRSwitchBlockStmt> switchBlockStmt;
         
     };
 
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
@@ -45,9 +46,9 @@ namespace ir {
          * @param tempExpr - pointer to the temporaries of the do-while statement node, default nullptr
         */
         void setDoWhileStmt(
-            std::unique_ptr<IRExpr> condExpr, 
-            std::unique_ptr<IRStmt> statement, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRExpr> condExpr, 
+            IRPtr<IRStmt> statement, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /**
@@ -73,13 +74,13 @@ namespace ir {
 
     private:
         /// pointer to the condition of the do-while statement
-        std::unique_ptr<IRExpr> conditionExpr;
+        IRPtr<IRExpr> conditionExpr;
 
         /// pointer to the statement of the do-while statement
-        std::unique_ptr<IRStmt> stmt;
+        IRPtr<IRStmt> stmt;
 
         /// pointer to the temporaries of the do-while statement
-        std::unique_ptr<IRTemporaryExpr> temporaryExpr;
+        IRPtr<IRTemporaryExpr> temporaryExpr;
     };
 
 }
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_assign_stmt.hpp"
@@ -68,11 +69,11 @@ namespace ir {
          * @param tempExpr - pointer to the temporaries, default nullptr
         */
         void setForStmt(
-            std::unique_ptr<IRAssignStmt> initStmt, 
-            std::unique_ptr<IRExpr> condExpr, 
-            std::unique_ptr<IRAssignStmt> incStmt, 
-            std::unique_ptr<IRStmt> statement, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRAssignStmt> initStmt, 
+            IRPtr<IRExpr> condExpr, 
+            IRPtr<IRAssignStmt> incStmt, 
+            IRPtr<IRStmt> statement, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /**
@@ -116,19 +117,19 @@ namespace ir {
 
     private:
         /// pointer to the assignment statement of the initializer
-        std::unique_ptr<IRAssignStmt> initializerStmt;
+        IRPtr<IRAssignStmt> initializerStmt;
 
         /// pointer to the condition of the for-statement
-        std::unique_ptr<IRExpr> conditionExpr;
+        IRPtr<IRExpr> conditionExpr;
 
         /// pointer to the assignment statement of the incrementer
-        std::unique_ptr<IRAssignStmt> incrementerStmt;
+        IRPtr<IRAssignStmt> incrementerStmt;
 
         /// pointer to the statement of the for-statement
-        std::unique_ptr<IRStmt> stmt;
+        IRPtr<IRStmt> stmt;
         
         /// pointer to temporaries of the for-statement
-        std::unique_ptr<IRTemporaryExpr> temporaryExpr;
+        IRPtr<IRTemporaryExpr> temporaryExpr;
     };
 
 }
@@ -4,62 +4,78 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 
+#include "ir_arena.hpp"
 #include "ir_node.hpp"
 #include "ir_parameter.hpp"
 #include "ir_stmt.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
     /**
      * @class IRFunction
      * @brief IRT representation for the function
+     * @details owns the arena all irt nodes of the function are placed into
     */
     class IRFunction final : public IRNode {
     public:
         /** 
          * @brief Creates the instance of the irt function
-         * @param funcName - name of the function
+         * @param funcId - interned name of the function
          * @param type - return type of the function
         */
-        IRFunction(const std::string& funcName, types::Type type);
+        IRFunction(util::text::SymbolId funcId, types::Type type);
+
+        /**
+         * @brief getter for the arena of the function
+         * @returns reference to the arena the nodes of the function are placed into
+        */
+        IRArena& getArena() noexcept;
 
         /** 
          * @brief getter for the parameters of the function
          * @returns reference to a const vector of pointers to parameters
         */
-        const std::vector<std::unique_ptr<IRParameter>>& getParameters() const noexcept;
+        const std::pmr::vector<IRPtr<IRParameter>>& getParameters() const noexcept;
 
         /** 
          * @brief adds new parameter to the function
          * @param parameter - pointer to the parameter that is being added
         */
-        void addParameter(std::unique_ptr<IRParameter> parameter);
+        void addParameter(IRPtr<IRParameter> parameter);
 
         /** 
          * @brief getter for the body of the function
          * @returns reference to a const vector of pointers to statements of the body
         */
-        const std::vector<std::unique_ptr<IRStmt>>& getBody() const noexcept;
+        const std::pmr::vector<IRPtr<IRStmt>>& getBody() const noexcept;
 
         /** 
          * @brief adds new statement to the body
          * @param stmt - pointer to the statement that is being added
         */
-        void addStatement(std::unique_ptr<IRStmt> stmt);
+        void addStatement(IRPtr<IRStmt> stmt);
 
         /** 
          * @brief getter for the name of the function
-         * @returns name of the function
+         * @returns view of the interned name
         */
-        const std::string& getFunctionName() const noexcept;
+        std::string_view getFunctionName() const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the function
+         * @returns id of the name
+        */
+        util::text::SymbolId getSymbolId() const noexcept;
 
         /** 
          * @brief initializes function's name
          * @param funcName - name that is being assigned to the function
         */
-        void setFunctionName(const std::string& funcName);
+        void setFunctionName(std::string_view funcName);
 
         /** 
          * @brief getter for the return type of the function
@@ -87,6 +103,7 @@ namespace ir {
 
         /**
          * @brief eliminates statements of the function's body that appear after the node that always returns
+         * @details eliminated nodes are left in the arena
          * @param startIdx - index in the vector of statements where deletion starts
         */
         void eliminateDeadStmts(size_t startIdx);
@@ -103,6 +120,18 @@ namespace ir {
         */
         bool isPredefined() const noexcept;
 
+        /**
+         * @brief sets the estimated cost of compiling the function
+         * @param estimatedCost - estimated cost, taken over from the ast function
+        */
+        void setCost(size_t estimatedCost) noexcept;
+
+        /**
+         * @brief getter for the estimated cost of compiling the function
+         * @returns estimated cost of the function
+        */
+        size_t getCost() const noexcept;
+
         /**
          * @brief accepts the ir visitor
          * @param visitor - reference to an ir visitor
@@ -110,8 +139,11 @@ namespace ir {
         void accept(IRVisitor& visitor) override;
 
     private:
-        /// name of the function
-        std::string functionName;
+        /// arena owning the nodes of the function, declared first so it is released last
+        IRArena arena;
+
+        /// interned name of the function
+        util::text::SymbolId functionId;
 
         /// memory required for the stack of the function
         std::string requiredMemory;
@@ -122,11 +154,14 @@ namespace ir {
         /// flag if function is predefined
         bool predefined;
 
+        /// estimated cost of compiling the function, used for scheduling the per function tasks
+        size_t cost;
+
         /// vector of pointers to parameters of the function
-        std::vector<std::unique_ptr<IRParameter>> parameters;
+        std::pmr::vector<IRPtr<IRParameter>> parameters;
 
         /// vector of pointers to statements of the body
-        std::vector<std::unique_ptr<IRStmt>> body;
+        std::pmr::vector<IRPtr<IRStmt>> body;
         
     };
 
@@ -3,11 +3,14 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
@@ -17,18 +20,22 @@ namespace ir {
     */
     class IRFunctionCallExpr final : public IRExpr {
     public:
+        /// allocator of the argument and temporary lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt function call expression
-         * @param callName - name of the function being called
+         * @param callId - interned name of the function being called
          * @param type - return type of the function being called
+         * @param alloc - allocator of the argument and temporary lists
         */
-        IRFunctionCallExpr(const std::string& callName, types::Type type);
+        IRFunctionCallExpr(util::text::SymbolId callId, types::Type type, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the arguments of the function call expression
          * @returns reference to a const vector of pointers to arguments
         */
-        const std::vector<std::unique_ptr<IRExpr>>& getArguments() const noexcept;
+        const std::pmr::vector<IRPtr<IRExpr>>& getArguments() const noexcept;
 
         /** 
          * @brief getter for the argument of the function call at specified position
@@ -41,7 +48,7 @@ namespace ir {
          * @brief getter for the temporaries of the function call expression
          * @returns reference to a const vector of pointers to the temporaries
         */
-        const std::vector<std::unique_ptr<IRTemporaryExpr>>& getTemporaryExprs() const noexcept;
+        const std::pmr::vector<IRPtr<IRTemporaryExpr>>& getTemporaryExprs() const noexcept;
 
         /** 
          * @brief adds new argument to the function call expression
@@ -50,21 +57,27 @@ namespace ir {
          * @param tempExpr - temporaries of the argument, default nullptr
         */
         void addArgument(
-            std::unique_ptr<IRExpr> argument, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRExpr> argument, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /** 
          * @brief getter for the name of the function that is being called
-         * @returns name of the called function
+         * @returns view of the interned name
+        */
+        std::string_view getCallName() const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the called function
+         * @returns id of the name
         */
-        const std::string& getCallName() const noexcept;
+        util::text::SymbolId getSymbolId() const noexcept;
 
         /** 
          * @brief initializes the name of the called function
          * @param _callName - name of the function that is being called
         */
-        void setCallName(const std::string& callName);
+        void setCallName(std::string_view callName);
 
         /** 
          * @brief getter for the argument count
@@ -79,14 +92,14 @@ namespace ir {
         void accept(IRVisitor& visitor) override;
 
     private:
-        /// name of the function being called
-        std::string functionCallName;
+        /// interned name of the function being called
+        util::text::SymbolId callId;
 
         /// vector of pointers to expressions representing arguments
-        std::vector<std::unique_ptr<IRExpr>> arguments;
+        std::pmr::vector<IRPtr<IRExpr>> arguments;
 
         /// vector of pointers to temporaries of the function call expression
-        std::vector<std::unique_ptr<IRTemporaryExpr>> temporaryExprs;
+        std::pmr::vector<IRPtr<IRTemporaryExpr>> temporaryExprs;
         
     };
 
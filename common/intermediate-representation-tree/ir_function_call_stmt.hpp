@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_function_call_expr.hpp"
 #include "../visitor/ir_visitor.hpp"
@@ -32,7 +33,7 @@ namespace ir {
          * @brief initializes the function call statement
          * @param callExpr - pointer to a function call expression
         */
-        void setFunctionCallStmt(std::unique_ptr<IRFunctionCallExpr> callExpr);
+        void setFunctionCallStmt(IRPtr<IRFunctionCallExpr> callExpr);
 
         /**
          * @brief accepts the ir visitor
@@ -42,7 +43,7 @@ namespace ir {
 
     private:
         /// pointer to the function call expression
-        std::unique_ptr<IRFunctionCallExpr> functionCallExpr; 
+        IRPtr<IRFunctionCallExpr> functionCallExpr; 
     };
 
 }
@@ -1,11 +1,13 @@
 #ifndef IR_ID_EXPR_HPP
 #define IR_ID_EXPR_HPP
 
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
 #include "ir_expr.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
@@ -15,36 +17,46 @@ namespace ir {
     */
     class IRIdExpr final : public IRExpr {
     public:
+        /// allocator of the value
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt id
-         * @param idName - name of the id
+         * @param idSymbol - interned name of the id
          * @param type - type of the id
+         * @param alloc - allocator of the value
         */
-        IRIdExpr(std::string_view idName, types::Type type);
+        IRIdExpr(util::text::SymbolId idSymbol, types::Type type, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the name of the id
-         * @returns reference to a name of the id as const string
+         * @returns view of the interned name
+        */
+        std::string_view getIdName() const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the id
+         * @returns id of the name
         */
-        const std::string& getIdName() const noexcept;
+        util::text::SymbolId getSymbolId() const noexcept;
 
         /** 
          * @brief initializes the name of the id
          * @param name - name of the id
         */
-        void setIdName(const std::string& name);
+        void setIdName(std::string_view name);
 
         /** 
          * @brief getter for the value of the id
          * @returns reference to the value of the id as const string
         */
-        const std::string& getValue() const noexcept;
+        std::string_view getValue() const noexcept;
 
         /** 
          * @brief initializes the value of the id
          * @param val - value of the id
         */
-        void setValue(const std::string& val);
+        void setValue(std::string_view val);
 
         /**
          * @brief accepts the ir visitor
@@ -53,11 +65,11 @@ namespace ir {
         void accept(IRVisitor& visitor) override;
 
     private:
-        /// name of the id
-        std::string idName;
+        /// interned name of the id
+        util::text::SymbolId idSymbol;
         
         /// value of the id
-        std::string value;
+        std::pmr::string value;
     };
 
 }
@@ -5,6 +5,7 @@
 #include <memory>
 #include <tuple>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
@@ -17,28 +18,32 @@ namespace ir {
     */
     class IRIfStmt final : public IRStmt {
     public:
+        /// allocator of the condition, statement and temporary lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt if-statement
+         * @param alloc - allocator of the condition, statement and temporary lists
         */
-        IRIfStmt();
+        explicit IRIfStmt(const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the conditions of the if-statement
          * @returns reference to a const vector of pointers to the conditions of the if-statement
         */
-        const std::vector<std::unique_ptr<IRExpr>>& getConditionExprs() const noexcept;
+        const std::pmr::vector<IRPtr<IRExpr>>& getConditionExprs() const noexcept;
 
         /** 
          * @brief getter for the statements of the if-statement
          * @returns reference to a const vector of pointers to the statements
         */
-        const std::vector<std::unique_ptr<IRStmt>>& getStmts() const noexcept;
+        const std::pmr::vector<IRPtr<IRStmt>>& getStmts() const noexcept;
 
         /** 
          * @brief getter for the temporaries of the if-statement
          * @returns reference to a const vector of pointers to the temporaries
         */
-        const std::vector<std::unique_ptr<IRTemporaryExpr>>& getTemporaryExprs() const noexcept;
+        const std::pmr::vector<IRPtr<IRTemporaryExpr>>& getTemporaryExprs() const noexcept;
 
         /** 
          * @brief getter for the number of if/else-if statements
@@ -53,16 +58,16 @@ namespace ir {
          * @param tempExpr - pointer to a temporary of the if/else-if statement, default nullptr
         */
         void addIfStmt(
-            std::unique_ptr<IRExpr> condExpr, 
-            std::unique_ptr<IRStmt> statement, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRExpr> condExpr, 
+            IRPtr<IRStmt> statement, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /** 
          * @brief initializes else-statement
          * @param statement - pointer to a statement of the else-statement
         */
-        void addElseStmt(std::unique_ptr<IRStmt> statement);
+        void addElseStmt(IRPtr<IRStmt> statement);
 
         /** 
          * @brief checks if if-statement ends with else-statement
@@ -92,13 +97,13 @@ namespace ir {
 
     private:
         /// vector of pointers to condition of the if-statement
-        std::vector<std::unique_ptr<IRExpr>> conditionExprs;
+        std::pmr::vector<IRPtr<IRExpr>> conditionExprs;
 
         /// vector of pointers to statements of the if-statement
-        std::vector<std::unique_ptr<IRStmt>> stmts;
+        std::pmr::vector<IRPtr<IRStmt>> stmts;
 
         /// vector of pointers to temporaries of the if-statement
-        std::vector<std::unique_ptr<IRTemporaryExpr>> temporaryExprs;
+        std::pmr::vector<IRPtr<IRTemporaryExpr>> temporaryExprs;
         
     };
 
@@ -1,7 +1,9 @@
 #ifndef IR_LITERAL_EXPR_HPP
 #define IR_LITERAL_EXPR_HPP
 
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
 #include "ir_expr.hpp"
 #include "../defs/types.hpp"
@@ -14,24 +16,28 @@ namespace ir {
     */
     class IRLiteralExpr final : public IRExpr {
     public:
+        /// allocator of the value
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt literal
          * @param val - value of the literal
          * @param type - type of the literal
+         * @param alloc - allocator of the value
         */
-        IRLiteralExpr(const std::string& val, types::Type type);
+        IRLiteralExpr(std::string_view val, types::Type type, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the value of the literal
          * @returns reference to a value of the literal as const string
         */
-        const std::string& getValue() const noexcept;
+        std::string_view getValue() const noexcept;
 
         /** 
          * @brief initializes the value of the literal
          * @param val - reference to a value
         */
-        void setValue(const std::string& val);
+        void setValue(std::string_view val);
 
         /**
          * @brief accepts the ir visitor
@@ -41,7 +47,7 @@ namespace ir {
 
     private:
         /// value of the literal
-        std::string value;
+        std::pmr::string value;
     };
 
 }
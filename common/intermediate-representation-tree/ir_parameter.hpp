@@ -6,6 +6,7 @@
 
 #include "ir_node.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
@@ -17,22 +18,28 @@ namespace ir {
     public:
         /** 
          * @brief Creates the instance of the irt parameter
-         * @param parName - name of the parameter
+         * @param parId - interned name of the parameter
          * @param type - type of the parameter
         */
-        IRParameter(std::string_view parName, types::Type type);
+        IRParameter(util::text::SymbolId parId, types::Type type);
 
         /** 
          * @brief getter for the name of the parameter
-         * @returns reference to a parameter's name
+         * @returns view of the interned name
         */
-        const std::string& getParameterName() const noexcept;
+        std::string_view getParameterName() const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the parameter
+         * @returns id of the name
+        */
+        util::text::SymbolId getSymbolId() const noexcept;
 
         /** 
          * @brief initializes the parameter's name
          * @param parName - the name of the parameter
         */
-        void setParameterName(const std::string& parName);
+        void setParameterName(std::string_view parName);
 
         /** 
          * @brief getter for the type of the parameter
@@ -53,8 +60,8 @@ namespace ir {
         void accept(IRVisitor& visitor) override;
 
     private:
-        /// name of the parameter
-        std::string parameterName;
+        /// interned name of the parameter
+        util::text::SymbolId parameterId;
 
         /// type of the parameter
         types::Type type;
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
@@ -35,8 +36,8 @@ namespace ir {
          * @param tempExpr - pointer to the temporaries of the expression, default nullptr
         */
         void setReturnExpr(
-            std::unique_ptr<IRExpr> expr, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRExpr> expr, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /** 
@@ -68,10 +69,10 @@ namespace ir {
 
     private:
         /// pointer to the expression of the return statement
-        std::unique_ptr<IRExpr> returnExpr;
+        IRPtr<IRExpr> returnExpr;
 
         /// pointer to the temporaries of the return statement
-        std::unique_ptr<IRTemporaryExpr> temporaryExpr;
+        IRPtr<IRTemporaryExpr> temporaryExpr;
         
     };
 
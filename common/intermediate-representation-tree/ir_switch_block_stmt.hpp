@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "../visitor/ir_visitor.hpp"
 
@@ -14,22 +15,26 @@ namespace ir {
     */
     class IRSwitchBlockStmt final : public IRStmt {
     public:
+        /// allocator of the statement list
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt switch-block
+         * @param alloc - allocator of the statement list
         */
-        IRSwitchBlockStmt();
+        explicit IRSwitchBlockStmt(const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the statements of the switch block
          * @returns reference to const vector of pointers to the statements
         */
-        const std::vector<std::unique_ptr<IRStmt>>& getStmts() const noexcept;
+        const std::pmr::vector<IRPtr<IRStmt>>& getStmts() const noexcept;
 
         /** 
          * @brief adds new statement to switch block
          * @param stmt - pointer to the statement
         */
-        void addStmt(std::unique_ptr<IRStmt> stmt);
+        void addStmt(IRPtr<IRStmt> stmt);
 
         /**
          * @brief eliminates statements of the switch block that appear after the node that always returns
@@ -45,7 +50,7 @@ namespace ir {
 
     private:
         /// vector of pointers to statements of the switch-block
-        std::vector<std::unique_ptr<IRStmt>> stmts;
+        std::pmr::vector<IRPtr<IRStmt>> stmts;
         
     };
 
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_id_expr.hpp"
 #include "ir_case_stmt.hpp"
@@ -17,10 +18,14 @@ namespace ir {
     */
     class IRSwitchStmt final : public IRStmt {
     public:
+        /// allocator of the case list
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt switch-statement
+         * @param alloc - allocator of the case list
         */
-        IRSwitchStmt();
+        explicit IRSwitchStmt(const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the variable of the switch statement
@@ -35,13 +40,13 @@ namespace ir {
          * @brief initializes the variable of the switch statement
          * @param idExpr - pointer to the id expression
         */
-        void setVariableIdExpr(std::unique_ptr<IRIdExpr> idExpr);
+        void setVariableIdExpr(IRPtr<IRIdExpr> idExpr);
 
         /** 
          * @brief getter for the cases of the switch statement
          * @returns reference to a const vector of pointers to cases
         */
-        const std::vector<std::unique_ptr<IRCaseStmt>>& getCaseStmts() const noexcept;
+        const std::pmr::vector<IRPtr<IRCaseStmt>>& getCaseStmts() const noexcept;
 
         /** 
          * @brief getter for the case at the specified position
@@ -54,7 +59,7 @@ namespace ir {
          * @brief adds new case to the switch statement
          * @param caseStmt - pointer to the case
         */
-        void addCaseStmt(std::unique_ptr<IRCaseStmt> caseStmt);
+        void addCaseStmt(IRPtr<IRCaseStmt> caseStmt);
 
         /** 
          * @brief getter for the default case of the switch statement
@@ -69,7 +74,7 @@ namespace ir {
          * @brief initializes the default case of the switch statement
          * @param swDefaultStmt - pointer to the default case
         */
-        void setDefaultStmt(std::unique_ptr<IRDefaultStmt> swDefaultStmt);
+        void setDefaultStmt(IRPtr<IRDefaultStmt> swDefaultStmt);
 
         /** 
          * @brief checks if the switch statement has default case
@@ -92,13 +97,13 @@ namespace ir {
 
     private:
         /// pointer to the id of the variable of the switch-statement
-        std::unique_ptr<IRIdExpr> variableIdExpr;
+        IRPtr<IRIdExpr> variableIdExpr;
 
         /// vector of pointers to cases of the switch-statement
-        std::vector<std::unique_ptr<IRCaseStmt>> caseStmts;
+        std::pmr::vector<IRPtr<IRCaseStmt>> caseStmts;
 
         /// pointer to default case of the switch-statement
-        std::unique_ptr<IRDefaultStmt> defaultStmt;
+        IRPtr<IRDefaultStmt> defaultStmt;
         
     };
 
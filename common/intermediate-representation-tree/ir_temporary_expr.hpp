@@ -4,11 +4,14 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <utility>
 
+#include "ir_arena.hpp"
 #include "ir_node.hpp"
 #include "ir_expr.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
@@ -18,29 +21,40 @@ namespace ir {
     */
     class IRTemporaryExpr final : public IRNode {
     public:
+        /// allocator of the temporary lists
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt temporary
+         * @param alloc - allocator of the temporary lists
         */
-        IRTemporaryExpr();
+        explicit IRTemporaryExpr(const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the temporaries
          * @returns reference to a const vector of pointers to expressions
         */
-        const std::vector<std::unique_ptr<IRExpr>>& getTemporaryExprs() const noexcept;
+        const std::pmr::vector<IRPtr<IRExpr>>& getTemporaryExprs() const noexcept;
 
         /** 
-         * @brief getter for the names of the temporaries
-         * @returns reference to a const vector of strings that represent temporaries
+         * @brief getter for the interned names of the temporaries
+         * @returns reference to a const vector of ids of the temporaries
         */
-        const std::vector<std::string>& getTemporaryNames() const noexcept;
+        const std::pmr::vector<util::text::SymbolId>& getTemporarySymbolIds() const noexcept;
 
         /** 
          * @brief getter for the name of the temporary at the specified position
          * @param n - position of the temporary
-         * @returns reference to a name of the temporary as const string
+         * @returns view of the interned name of the temporary
+        */
+        std::string_view getTemporaryNameAtN(size_t n) const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the temporary at the specified position
+         * @param n - position of the temporary
+         * @returns id of the name of the temporary
         */
-        const std::string& getTemporaryNameAtN(size_t n) const noexcept;
+        util::text::SymbolId getTemporarySymbolIdAtN(size_t n) const noexcept;
 
         /** 
          * @brief getter for temporary at specified position
@@ -52,19 +66,19 @@ namespace ir {
         /** 
          * @brief getter for the temporary name and temporary expression at the specified position
          * @param n - position of the temporary
-         * @returns pair of name as a string and pointer to the expression
+         * @returns pair of interned name and pointer to the expression
         */
-        std::pair<std::string, IRExpr*> getTemporaryDetailsAtN(size_t n) noexcept;
+        std::pair<util::text::SymbolId, IRExpr*> getTemporaryDetailsAtN(size_t n) noexcept;
 
         /** 
          * @brief adds new temporary variable
-         * @param tempName - name of the temporary variable
+         * @param tempId - interned name of the temporary variable
          * @param tempVal - pointer to the expression, default nullptr
          * @param type - type of the temporary variable, default NO_TYPE
         */
         void addTemporaryExpr(
-            const std::string& tempName, 
-            std::unique_ptr<IRExpr> tempVal = nullptr, 
+            util::text::SymbolId tempId, 
+            IRPtr<IRExpr> tempVal = nullptr, 
             types::Type type = types::Type::NO_TYPE
         );
 
@@ -74,13 +88,13 @@ namespace ir {
          * @param type - type of the temporary variable
          * @param n - position of the temporary
         */
-        void setTemporaryExprAtN(std::unique_ptr<IRExpr> tempVal, types::Type type, size_t n);
+        void setTemporaryExprAtN(IRPtr<IRExpr> tempVal, types::Type type, size_t n);
 
         /** 
          * @brief getter for the types of the temporaries
          * @returns reference to a const vector of types of the temporaries
         */
-        const std::vector<types::Type>& getTypes() const noexcept;
+        const std::pmr::vector<types::Type>& getTypes() const noexcept;
 
         /**
          * @brief accepts the ir visitor
@@ -90,13 +104,13 @@ namespace ir {
 
     private:
         /// vector of types of the temporaries
-        std::vector<types::Type> types;
+        std::pmr::vector<types::Type> types;
         
-        /// vector of names of the temporaries
-        std::vector<std::string> temporaryNames;
+        /// vector of interned names of the temporaries
+        std::pmr::vector<util::text::SymbolId> temporaryIds;
 
         /// vector of pointers to expressions of the temporaries
-        std::vector<std::unique_ptr<IRExpr>> temporaryExprs;
+        std::pmr::vector<IRPtr<IRExpr>> temporaryExprs;
         
     };
 
@@ -2,12 +2,16 @@
 #define IR_VARIABLE_DECL_STMT_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 
+#include "ir_arena.hpp"
 #include "ir_stmt.hpp"
 #include "ir_expr.hpp"
 #include "ir_temporary_expr.hpp"
 #include "../defs/types.hpp"
+#include "../symbol/string_interner.hpp"
 #include "../visitor/ir_visitor.hpp"
 
 namespace ir {
@@ -17,12 +21,16 @@ namespace ir {
     */
     class IRVariableDeclStmt final : public IRStmt {
     public:
+        /// allocator of the value
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         /** 
          * @brief Creates the instance of the irt variable declaration
-         * @param varName - name of the variable
+         * @param varId - interned name of the variable
          * @param type - type of the variable
+         * @param alloc - allocator of the value
         */
-        IRVariableDeclStmt(std::string_view varName, types::Type type);
+        IRVariableDeclStmt(util::text::SymbolId varId, types::Type type, const allocator_type& alloc = {});
 
         /** 
          * @brief getter for the value assigned to the variable
@@ -39,33 +47,39 @@ namespace ir {
          * @param temp - pointer to the temporaries, default nullptr
         */
         void setAssignExpr(
-            std::unique_ptr<IRExpr> expr, 
-            std::unique_ptr<IRTemporaryExpr> tempExpr = nullptr
+            IRPtr<IRExpr> expr, 
+            IRPtr<IRTemporaryExpr> tempExpr = nullptr
         );
 
         /** 
          * @brief getter for the name of the variable
-         * @returns reference to the name of the variable as const string
+         * @returns view of the interned name
+        */
+        std::string_view getVarName() const noexcept;
+
+        /** 
+         * @brief getter for the interned name of the variable
+         * @returns id of the name
         */
-        const std::string& getVarName() const noexcept;
+        util::text::SymbolId getSymbolId() const noexcept;
 
         /** 
          * @brief initializes the name of the variable
          * @param var - reference to the name of the variable
         */
-        void setVarName(const std::string& var);
+        void setVarName(std::string_view var);
 
         /** 
          * @brief getter for the value of the variable
          * @returns reference to the value of the variable as const string
         */
-        const std::string& getValue() const noexcept;
+        std::string_view getValue() const noexcept;
 
         /** 
          * @brief initializes the value of the variable
          * @param val - reference to a value of the variable as const string
         */
-        void setValue(const std::string& val);
+        void setValue(std::string_view val);
 
         /** 
          * @brief getter for the type of the variable
@@ -107,20 +121,20 @@ namespace ir {
         void accept(IRVisitor& visitor) override;
 
     private:
-        /// name of the variable
-        std::string varName;
+        /// interned name of the variable
+        util::text::SymbolId varId;
 
         /// value of the variable
-        std::string value;
+        std::pmr::string value;
 
         /// type of the variable
         types::Type type;
 
         /// pointer to the expression assigned to the variable
-        std::unique_ptr<IRExpr> assignExpr;
+        IRPtr<IRExpr> assignExpr;
 
         /// pointer to the temporaries of the variable
-        std::unique_ptr<IRTemporaryExpr> temporaryExpr;
+        IRPtr<IRTemporaryExpr> temporaryExpr;
         
     };
 
@@ -0,0 +1,8 @@
+#include "../ir_arena.hpp"
+
+ir::IRArena::IRArena()
+    : resource{ initialBlockSize } {}
+
+ir::IRArena::allocator_type ir::IRArena::getAllocator() noexcept {
+    return allocator_type{ &resource };
+}
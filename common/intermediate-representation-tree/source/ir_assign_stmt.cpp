@@ -5,9 +5,9 @@
 ir::IRAssignStmt::IRAssignStmt() : IRStmt(ir::IRNodeType::ASSIGN) {}
 
 void ir::IRAssignStmt::setAssignStmt(
-    std::unique_ptr<IRIdExpr> idExpr, 
-    std::unique_ptr<IRExpr> expr, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRIdExpr> idExpr, 
+    ir::IRPtr<ir::IRExpr> expr, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     variableIdExpr = std::move(idExpr);
     assignedExpr = std::move(expr);
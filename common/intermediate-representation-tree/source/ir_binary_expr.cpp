@@ -10,8 +10,8 @@ syntax::Operator ir::IRBinaryExpr::getOperator() const noexcept {
 }
 
 void ir::IRBinaryExpr::setBinaryExpr(
-    std::unique_ptr<IRExpr> leftOperand, 
-    std::unique_ptr<IRExpr> rightOperand, 
+    ir::IRPtr<ir::IRExpr> leftOperand, 
+    ir::IRPtr<ir::IRExpr> rightOperand, 
     syntax::Operator op
 ){
     leftOperandExpr = std::move(leftOperand);
@@ -5,8 +5,8 @@
 ir::IRCaseStmt::IRCaseStmt() : IRStmt(ir::IRNodeType::CASE) {}
 
 void ir::IRCaseStmt::setCase(
-    std::unique_ptr<IRLiteralExpr> litExpr, 
-    std::unique_ptr<IRSwitchBlockStmt> swBlockStmt, 
+    ir::IRPtr<ir::IRLiteralExpr> litExpr, 
+    ir::IRPtr<ir::IRSwitchBlockStmt> swBlockStmt, 
     bool hasBreak
 ){
     literalExpr = std::move(litExpr);
@@ -2,14 +2,16 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRCompoundStmt::IRCompoundStmt() : IRStmt(ir::IRNodeType::COMPOUND) {}
+ir::IRCompoundStmt::IRCompoundStmt(const allocator_type& alloc) 
+    : IRStmt(ir::IRNodeType::COMPOUND), 
+      stmts{ alloc } {}
 
-const std::vector<std::unique_ptr<ir::IRStmt>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRStmt>>& 
 ir::IRCompoundStmt::getStmts() const noexcept {
     return stmts;
 }
 
-void ir::IRCompoundStmt::addStmt(std::unique_ptr<IRStmt> stmt){
+void ir::IRCompoundStmt::addStmt(ir::IRPtr<ir::IRStmt> stmt){
     stmts.push_back(std::move(stmt));
 }
 
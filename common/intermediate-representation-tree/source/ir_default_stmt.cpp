@@ -5,7 +5,7 @@
 ir::IRDefaultStmt::IRDefaultStmt() 
     : IRStmt(ir::IRNodeType::DEFAULT) {}
 
-void ir::IRDefaultStmt::setSwitchBlock(std::unique_ptr<IRSwitchBlockStmt> swBlockStmt){
+void ir::IRDefaultStmt::setSwitchBlock(ir::IRPtr<ir::IRSwitchBlockStmt> swBlockStmt){
     switchBlockStmt = std::move(swBlockStmt);
 }
 
@@ -6,9 +6,9 @@ ir::IRDoWhileStmt::IRDoWhileStmt()
     : IRStmt(ir::IRNodeType::DO_WHILE) {}
 
 void ir::IRDoWhileStmt::setDoWhileStmt(
-    std::unique_ptr<IRExpr> condExpr, 
-    std::unique_ptr<IRStmt> statement, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> condExpr, 
+    ir::IRPtr<ir::IRStmt> statement, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     conditionExpr = std::move(condExpr);
     stmt = std::move(statement);
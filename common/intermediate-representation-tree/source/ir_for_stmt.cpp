@@ -5,11 +5,11 @@
 ir::IRForStmt::IRForStmt() : IRStmt(ir::IRNodeType::FOR) {}
 
 void ir::IRForStmt::setForStmt(
-    std::unique_ptr<IRAssignStmt> initStmt, 
-    std::unique_ptr<IRExpr> condExpr, 
-    std::unique_ptr<IRAssignStmt> incStmt, 
-    std::unique_ptr<IRStmt> statement, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRAssignStmt> initStmt, 
+    ir::IRPtr<ir::IRExpr> condExpr, 
+    ir::IRPtr<ir::IRAssignStmt> incStmt, 
+    ir::IRPtr<ir::IRStmt> statement, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     initializerStmt = std::move(initStmt);
     conditionExpr = std::move(condExpr);
@@ -2,37 +2,48 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRFunction::IRFunction(const std::string& funcName, types::Type type) 
+ir::IRFunction::IRFunction(util::text::SymbolId funcId, types::Type type) 
     : IRNode(ir::IRNodeType::FUNCTION), 
-      functionName{ funcName }, 
+      functionId{ funcId }, 
       requiredMemory{ "0" }, 
       type{ type }, 
-      predefined{ false } {}
+      predefined{ false }, 
+      cost{ 0 }, 
+      parameters{ arena.getAllocator() }, 
+      body{ arena.getAllocator() } {}
 
-const std::vector<std::unique_ptr<ir::IRParameter>>& 
+ir::IRArena& ir::IRFunction::getArena() noexcept {
+    return arena;
+}
+
+const std::pmr::vector<ir::IRPtr<ir::IRParameter>>& 
 ir::IRFunction::getParameters() const noexcept {
     return parameters;
 }
 
-void ir::IRFunction::addParameter(std::unique_ptr<IRParameter> parameter){
+void ir::IRFunction::addParameter(ir::IRPtr<ir::IRParameter> parameter){
     parameters.push_back(std::move(parameter));
 }
 
-const std::vector<std::unique_ptr<ir::IRStmt>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRStmt>>& 
 ir::IRFunction::getBody() const noexcept {
     return body;
 }
 
-void ir::IRFunction::addStatement(std::unique_ptr<IRStmt> stmt){
+void ir::IRFunction::addStatement(ir::IRPtr<ir::IRStmt> stmt){
     body.push_back(std::move(stmt));
 }
 
-const std::string& ir::IRFunction::getFunctionName() const noexcept {
-    return functionName;
+std::string_view ir::IRFunction::getFunctionName() const noexcept {
+    return util::text::StringInterner::name(functionId);
+}
+
+util::text::SymbolId ir::IRFunction::getSymbolId() const noexcept {
+    return functionId;
 }
 
-void ir::IRFunction::setFunctionName(const std::string& funcName){
-    functionName = funcName;
+void ir::IRFunction::setFunctionName(std::string_view funcName){
+    functionId = util::text::StringInterner::intern(funcName);
 }
 
 types::Type ir::IRFunction::getType() const noexcept {
@@ -65,6 +76,14 @@ bool ir::IRFunction::isPredefined() const noexcept {
     return predefined;
 }
 
+void ir::IRFunction::setCost(size_t estimatedCost) noexcept {
+    cost = estimatedCost;
+}
+
+size_t ir::IRFunction::getCost() const noexcept {
+    return cost;
+}
+
 void ir::IRFunction::accept(ir::IRVisitor& visitor){
     visitor.visit(this);
 }
\ No newline at end of file
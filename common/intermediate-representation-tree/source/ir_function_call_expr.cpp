@@ -2,10 +2,13 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRFunctionCallExpr::IRFunctionCallExpr(const std::string& callName, types::Type type) 
-    : IRExpr(ir::IRNodeType::CALL, type), functionCallName{ callName } {}
+ir::IRFunctionCallExpr::IRFunctionCallExpr(util::text::SymbolId callId, types::Type type, const allocator_type& alloc) 
+    : IRExpr(ir::IRNodeType::CALL, type), 
+      callId{ callId }, 
+      arguments{ alloc }, 
+      temporaryExprs{ alloc } {}
 
-const std::vector<std::unique_ptr<ir::IRExpr>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRExpr>>& 
 ir::IRFunctionCallExpr::getArguments() const noexcept {
     return arguments;
 }
@@ -15,25 +18,29 @@ ir::IRFunctionCallExpr::getArgumentAtN(size_t n) const noexcept {
     return arguments[n].get();
 }
 
-const std::vector<std::unique_ptr<ir::IRTemporaryExpr>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRTemporaryExpr>>& 
 ir::IRFunctionCallExpr::getTemporaryExprs() const noexcept {
     return temporaryExprs;
 }
 
 void ir::IRFunctionCallExpr::addArgument(
-    std::unique_ptr<IRExpr> argument, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> argument, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     arguments.push_back(std::move(argument));
     temporaryExprs.push_back(std::move(tempExpr));
 }
 
-const std::string& ir::IRFunctionCallExpr::getCallName() const noexcept {
-    return functionCallName;
+std::string_view ir::IRFunctionCallExpr::getCallName() const noexcept {
+    return util::text::StringInterner::name(callId);
 }
 
-void ir::IRFunctionCallExpr::setCallName(const std::string& callName){
-    functionCallName = callName;
+util::text::SymbolId ir::IRFunctionCallExpr::getSymbolId() const noexcept {
+    return callId;
+}
+
+void ir::IRFunctionCallExpr::setCallName(std::string_view callName){
+    callId = util::text::StringInterner::intern(callName);
 }
 
 size_t ir::IRFunctionCallExpr::getArgumentCount() const noexcept {
@@ -5,7 +5,7 @@
 ir::IRFunctionCallStmt::IRFunctionCallStmt() 
     : IRStmt{ ir::IRNodeType::CALL_STMT } {}
 
-void ir::IRFunctionCallStmt::setFunctionCallStmt(std::unique_ptr<IRFunctionCallExpr> callExpr){
+void ir::IRFunctionCallStmt::setFunctionCallStmt(ir::IRPtr<ir::IRFunctionCallExpr> callExpr){
     functionCallExpr = std::move(callExpr);
 }
 
@@ -2,24 +2,28 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRIdExpr::IRIdExpr(std::string_view idName, types::Type type) 
+ir::IRIdExpr::IRIdExpr(util::text::SymbolId idSymbol, types::Type type, const allocator_type& alloc) 
     : IRExpr(ir::IRNodeType::ID, type), 
-      idName{ idName }, 
-      value{ "0" } {}
+      idSymbol{ idSymbol }, 
+      value{ "0", alloc } {}
 
-const std::string& ir::IRIdExpr::getIdName() const noexcept {
-    return idName;
+std::string_view ir::IRIdExpr::getIdName() const noexcept {
+    return util::text::StringInterner::name(idSymbol);
 }
 
-void ir::IRIdExpr::setIdName(const std::string& name){
-    idName = name;
+util::text::SymbolId ir::IRIdExpr::getSymbolId() const noexcept {
+    return idSymbol;
 }
 
-const std::string& ir::IRIdExpr::getValue() const noexcept {
+void ir::IRIdExpr::setIdName(std::string_view name){
+    idSymbol = util::text::StringInterner::intern(name);
+}
+
+std::string_view ir::IRIdExpr::getValue() const noexcept {
     return value;
 }
 
-void ir::IRIdExpr::setValue(const std::string& val){
+void ir::IRIdExpr::setValue(std::string_view val){
     value = val;
 }
 
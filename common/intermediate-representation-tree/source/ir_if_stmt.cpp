@@ -2,19 +2,23 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRIfStmt::IRIfStmt() : IRStmt(ir::IRNodeType::IF) {}
+ir::IRIfStmt::IRIfStmt(const allocator_type& alloc) 
+    : IRStmt(ir::IRNodeType::IF), 
+      conditionExprs{ alloc }, 
+      stmts{ alloc }, 
+      temporaryExprs{ alloc } {}
 
-const std::vector<std::unique_ptr<ir::IRExpr>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRExpr>>& 
 ir::IRIfStmt::getConditionExprs() const noexcept {
     return conditionExprs;
 }
 
-const std::vector<std::unique_ptr<ir::IRStmt>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRStmt>>& 
 ir::IRIfStmt::getStmts() const noexcept {
     return stmts;
 }
 
-const std::vector<std::unique_ptr<ir::IRTemporaryExpr>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRTemporaryExpr>>& 
 ir::IRIfStmt::getTemporaryExprs() const noexcept {
     return temporaryExprs;
 }
@@ -24,16 +28,16 @@ size_t ir::IRIfStmt::getConditionCount() const noexcept {
 }
 
 void ir::IRIfStmt::addIfStmt(
-    std::unique_ptr<IRExpr> condExpr, 
-    std::unique_ptr<IRStmt> statement, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> condExpr, 
+    ir::IRPtr<ir::IRStmt> statement, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     conditionExprs.push_back(std::move(condExpr));
     stmts.push_back(std::move(statement));
     temporaryExprs.push_back(std::move(tempExpr));
 }
 
-void ir::IRIfStmt::addElseStmt(std::unique_ptr<IRStmt> statement){
+void ir::IRIfStmt::addElseStmt(ir::IRPtr<ir::IRStmt> statement){
     stmts.push_back(std::move(statement));
 }
 
@@ -2,14 +2,14 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRLiteralExpr::IRLiteralExpr(const std::string& val, types::Type type) 
-    : IRExpr(ir::IRNodeType::LITERAL, type), value{ val } {}
+ir::IRLiteralExpr::IRLiteralExpr(std::string_view val, types::Type type, const allocator_type& alloc) 
+    : IRExpr(ir::IRNodeType::LITERAL, type), value{ val, alloc } {}
 
-const std::string& ir::IRLiteralExpr::getValue() const noexcept {
+std::string_view ir::IRLiteralExpr::getValue() const noexcept {
     return value;
 }
 
-void ir::IRLiteralExpr::setValue(const std::string& val){
+void ir::IRLiteralExpr::setValue(std::string_view val){
     value = val;
 }
 
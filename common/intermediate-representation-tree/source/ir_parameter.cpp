@@ -2,17 +2,21 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRParameter::IRParameter(std::string_view parName, types::Type type) 
+ir::IRParameter::IRParameter(util::text::SymbolId parId, types::Type type) 
     : IRNode(ir::IRNodeType::PARAMETER), 
-      parameterName{ parName }, 
+      parameterId{ parId }, 
       type{ type } {}
 
-const std::string& ir::IRParameter::getParameterName() const noexcept {
-    return parameterName;
+std::string_view ir::IRParameter::getParameterName() const noexcept {
+    return util::text::StringInterner::name(parameterId);
 }
 
-void ir::IRParameter::setParameterName(const std::string& parName){
-    parameterName = parName;
+util::text::SymbolId ir::IRParameter::getSymbolId() const noexcept {
+    return parameterId;
+}
+
+void ir::IRParameter::setParameterName(std::string_view parName){
+    parameterId = util::text::StringInterner::intern(parName);
 }
 
 types::Type ir::IRParameter::getType() const noexcept {
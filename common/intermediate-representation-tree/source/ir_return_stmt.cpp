@@ -6,8 +6,8 @@ ir::IRReturnStmt::IRReturnStmt()
     : IRStmt(ir::IRNodeType::RETURN) {}
 
 void ir::IRReturnStmt::setReturnExpr(
-    std::unique_ptr<IRExpr> expr, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> expr, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     returnExpr = std::move(expr);
     temporaryExpr = std::move(tempExpr);
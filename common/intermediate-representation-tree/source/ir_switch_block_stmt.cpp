@@ -2,15 +2,16 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRSwitchBlockStmt::IRSwitchBlockStmt() 
-    : IRStmt(ir::IRNodeType::SWITCH_BLOCK) {}
+ir::IRSwitchBlockStmt::IRSwitchBlockStmt(const allocator_type& alloc) 
+    : IRStmt(ir::IRNodeType::SWITCH_BLOCK), 
+      stmts{ alloc } {}
 
-const std::vector<std::unique_ptr<ir::IRStmt>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRStmt>>& 
 ir::IRSwitchBlockStmt::getStmts() const noexcept {
     return stmts;
 }
 
-void ir::IRSwitchBlockStmt::addStmt(std::unique_ptr<IRStmt> stmt){
+void ir::IRSwitchBlockStmt::addStmt(ir::IRPtr<ir::IRStmt> stmt){
     stmts.push_back(std::move(stmt));
 }
 
@@ -2,14 +2,15 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRSwitchStmt::IRSwitchStmt() 
-    : IRStmt(ir::IRNodeType::SWITCH) {}
+ir::IRSwitchStmt::IRSwitchStmt(const allocator_type& alloc) 
+    : IRStmt(ir::IRNodeType::SWITCH), 
+      caseStmts{ alloc } {}
 
-void ir::IRSwitchStmt::setVariableIdExpr(std::unique_ptr<IRIdExpr> idExpr){
+void ir::IRSwitchStmt::setVariableIdExpr(ir::IRPtr<ir::IRIdExpr> idExpr){
     variableIdExpr = std::move(idExpr);
 }
 
-const std::vector<std::unique_ptr<ir::IRCaseStmt>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRCaseStmt>>& 
 ir::IRSwitchStmt::getCaseStmts() const noexcept {
     return caseStmts;
 }
@@ -19,11 +20,11 @@ ir::IRSwitchStmt::getCaseStmtAtN(size_t n) const noexcept {
     return caseStmts[n].get();
 }
 
-void ir::IRSwitchStmt::addCaseStmt(std::unique_ptr<IRCaseStmt> caseStmt){
+void ir::IRSwitchStmt::addCaseStmt(ir::IRPtr<ir::IRCaseStmt> caseStmt){
     caseStmts.push_back(std::move(caseStmt));
 }
 
-void ir::IRSwitchStmt::setDefaultStmt(std::unique_ptr<IRDefaultStmt> swDefaultStmt) {
+void ir::IRSwitchStmt::setDefaultStmt(ir::IRPtr<ir::IRDefaultStmt> swDefaultStmt) {
     defaultStmt = std::move(swDefaultStmt);
 }
 
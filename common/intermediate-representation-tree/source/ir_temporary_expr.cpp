@@ -2,22 +2,30 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRTemporaryExpr::IRTemporaryExpr() 
-    : IRNode(ir::IRNodeType::TEMPORARY) {}
+ir::IRTemporaryExpr::IRTemporaryExpr(const allocator_type& alloc) 
+    : IRNode(ir::IRNodeType::TEMPORARY), 
+      types{ alloc }, 
+      temporaryIds{ alloc }, 
+      temporaryExprs{ alloc } {}
 
-const std::vector<std::unique_ptr<ir::IRExpr>>& 
+const std::pmr::vector<ir::IRPtr<ir::IRExpr>>& 
 ir::IRTemporaryExpr::getTemporaryExprs() const noexcept {
     return temporaryExprs;
 }
 
-const std::vector<std::string>& 
-ir::IRTemporaryExpr::getTemporaryNames() const noexcept {
-    return temporaryNames;
+const std::pmr::vector<util::text::SymbolId>& 
+ir::IRTemporaryExpr::getTemporarySymbolIds() const noexcept {
+    return temporaryIds;
 }
 
-const std::string& 
+std::string_view 
 ir::IRTemporaryExpr::getTemporaryNameAtN(size_t n) const noexcept {
-    return temporaryNames[n];
+    return util::text::StringInterner::name(temporaryIds[n]);
+}
+
+util::text::SymbolId 
+ir::IRTemporaryExpr::getTemporarySymbolIdAtN(size_t n) const noexcept {
+    return temporaryIds[n];
 }
 
 const ir::IRExpr* 
@@ -25,23 +33,23 @@ ir::IRTemporaryExpr::getTemporaryExprAtN(size_t n) const noexcept {
     return temporaryExprs[n].get();
 }
 
-std::pair<std::string, ir::IRExpr*> 
+std::pair<util::text::SymbolId, ir::IRExpr*> 
 ir::IRTemporaryExpr::getTemporaryDetailsAtN(size_t n) noexcept {
-    return {temporaryNames[n], temporaryExprs[n].get()};
+    return {temporaryIds[n], temporaryExprs[n].get()};
 }
 
 void ir::IRTemporaryExpr::addTemporaryExpr(
-    const std::string& tempName, 
-    std::unique_ptr<IRExpr> tempVal, 
+    util::text::SymbolId tempId, 
+    ir::IRPtr<ir::IRExpr> tempVal, 
     types::Type type
 ){
-    temporaryNames.push_back(tempName);
+    temporaryIds.push_back(tempId);
     temporaryExprs.push_back(std::move(tempVal));
     types.push_back(type);
 }
 
 void ir::IRTemporaryExpr::setTemporaryExprAtN(
-    std::unique_ptr<IRExpr> tempVal, 
+    ir::IRPtr<ir::IRExpr> tempVal, 
     types::Type type, 
     size_t n
 ){
@@ -49,7 +57,7 @@ void ir::IRTemporaryExpr::setTemporaryExprAtN(
     types[n] = type;
 }
 
-const std::vector<types::Type>& ir::IRTemporaryExpr::getTypes() const noexcept {
+const std::pmr::vector<types::Type>& ir::IRTemporaryExpr::getTypes() const noexcept {
     return types;
 }
 
@@ -2,33 +2,37 @@
 
 #include "../defs/ir_defs.hpp"
 
-ir::IRVariableDeclStmt::IRVariableDeclStmt(std::string_view varName, types::Type type) 
+ir::IRVariableDeclStmt::IRVariableDeclStmt(util::text::SymbolId varId, types::Type type, const allocator_type& alloc) 
     : IRStmt(ir::IRNodeType::VARIABLE), 
-      varName{ varName }, 
-      value{ "0" }, 
+      varId{ varId }, 
+      value{ "0", alloc }, 
       type{ type } {}
 
 void ir::IRVariableDeclStmt::setAssignExpr(
-    std::unique_ptr<IRExpr> expr, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> expr, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     assignExpr = std::move(expr);
     temporaryExpr = std::move(tempExpr);
 }
 
-const std::string& ir::IRVariableDeclStmt::getVarName() const noexcept {
-    return varName;
+std::string_view ir::IRVariableDeclStmt::getVarName() const noexcept {
+    return util::text::StringInterner::name(varId);
 }
 
-void ir::IRVariableDeclStmt::setVarName(const std::string& var){
-    varName = var;
+util::text::SymbolId ir::IRVariableDeclStmt::getSymbolId() const noexcept {
+    return varId;
 }
 
-const std::string& ir::IRVariableDeclStmt::getValue() const noexcept {
+void ir::IRVariableDeclStmt::setVarName(std::string_view var){
+    varId = util::text::StringInterner::intern(var);
+}
+
+std::string_view ir::IRVariableDeclStmt::getValue() const noexcept {
     return value;
 }
 
-void ir::IRVariableDeclStmt::setValue(const std::string& val){
+void ir::IRVariableDeclStmt::setValue(std::string_view val){
     value = val;
 }
 
@@ -5,9 +5,9 @@
 ir::IRWhileStmt::IRWhileStmt() : IRStmt(ir::IRNodeType::WHILE) {}
 
 void ir::IRWhileStmt::setWhileStmt(
-    std::unique_ptr<IRExpr> condExpr, 
-    std::unique_ptr<IRStmt> statement, 
-    std::unique_ptr<IRTemporaryExpr> tempExpr
+    ir::IRPtr<ir::IRExpr> condExpr, 
+    ir::IRPtr<ir::IRStmt> statement, 
+    ir::IRPtr<ir::IRTemporaryExpr> tempExpr
 ){
     conditionExpr = std::move(condExpr);
     stmt = std::move(statement);
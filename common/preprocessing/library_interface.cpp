@@ -0,0 +1,232 @@
+#include "library_interface.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "preprocessing_libs.hpp"
+#include "../source/source_registry.hpp"
+#include "../token/token.hpp"
+#include "../abstract-syntax-tree/ast_parameter.hpp"
+
+namespace {
+    /// leading bytes of every interface file
+    constexpr std::array<char, 4> magic{ 'M', 'C', 'P', 'I' };
+
+    /**
+     * @struct InterfaceReader
+     * @brief bounds checked cursor over the mapped interface file
+    */
+    struct InterfaceReader {
+        /// contents of the interface file
+        std::string_view data;
+
+        /// offset of the next unread byte
+        size_t offset{ 0 };
+
+        /**
+         * @brief reads the integer
+         * @param value - reference to the read value
+         * @returns false if the file ends before the value, true otherwise
+        */
+        template<typename T>
+        bool read(T& value) noexcept {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if(data.size() - offset < sizeof(T)){
+                return false;
+            }
+            // mapping gives no alignment guarantees past the header
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        /**
+         * @brief reads the length prefixed name
+         * @param name - reference to the view of the name
+         * @returns false if the file ends before the name or the name is empty, true otherwise
+        */
+        bool readName(std::string_view& name) noexcept {
+            uint16_t length;
+            if(!read(length) || length == 0 || data.size() - offset < length){
+                return false;
+            }
+            name = data.substr(offset, length);
+            offset += length;
+            return true;
+        }
+
+        /**
+         * @brief reads the type
+         * @param type - reference to the read type
+         * @returns false if the file ends before the type or the type is unknown, true otherwise
+        */
+        bool readType(types::Type& type) noexcept {
+            uint8_t encoded;
+            if(!read(encoded) || encoded >= types::TYPE_COUNT){
+                return false;
+            }
+            type = static_cast<types::Type>(encoded);
+            return true;
+        }
+    };
+
+    /**
+     * @brief appends the integer to the interface
+     * @param out - reference to the contents of the interface
+     * @param value - appended value
+    */
+    template<typename T>
+    void write(std::string& out, T value){
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief appends the length prefixed name to the interface
+     * @param out - reference to the contents of the interface
+     * @param name - appended name
+     * @throws std::length_error when the name does not fit the length prefix
+    */
+    void writeName(std::string& out, std::string_view name){
+        if(name.size() > std::numeric_limits<uint16_t>::max()){
+            throw std::length_error(std::format("Name '{}' is too long for the library interface", name));
+        }
+        write(out, static_cast<uint16_t>(name.size()));
+        out.append(name);
+    }
+}
+
+preprocessing::LibraryInterface::LibraryInterface(util::io::MappedFile file) noexcept
+    : file{ std::move(file) } {}
+
+std::optional<preprocessing::LibraryInterface> preprocessing::LibraryInterface::load(std::string_view libName){
+    const std::string interfacePath{ preprocessing::generateLibInterfacePath(libName) };
+
+    // interface generated before the last change of the library is out of date
+    std::error_code error;
+    const auto interfaceTime{ std::filesystem::last_write_time(interfacePath, error) };
+    if(error){
+        return std::nullopt;
+    }
+    const auto sourceTime{ std::filesystem::last_write_time(preprocessing::generateLibSourcePath(libName), error) };
+    if(error || sourceTime > interfaceTime){
+        return std::nullopt;
+    }
+
+    return open(interfacePath);
+}
+
+std::optional<preprocessing::LibraryInterface> preprocessing::LibraryInterface::open(const std::string& path){
+    util::io::MappedFile file{ path };
+    if(!file.isOpen()){
+        return std::nullopt;
+    }
+
+    // signatures view into the mapping, it is not relocated by the moves
+    preprocessing::LibraryInterface interface{ std::move(file) };
+    if(!interface.decode()){
+        return std::nullopt;
+    }
+
+    return interface;
+}
+
+std::string preprocessing::LibraryInterface::serialize(const syntax::ast::ASTProgram* program){
+    if(!program->getDirs().empty()){
+        throw std::runtime_error("Library with an interface cannot include other libraries");
+    }
+
+    std::string out;
+    out.append(magic.data(), magic.size());
+    write(out, version);
+    write(out, static_cast<uint32_t>(program->getFunctionCount()));
+
+    for(const auto& function : program->getFunctions()){
+        const auto name{ function->getToken().value() };
+        if(!function->isPredefined()){
+            throw std::runtime_error(std::format("Library function '{}' cannot have a body", name));
+        }
+
+        const auto& parameters{ function->getParameters() };
+        if(parameters.size() > std::numeric_limits<uint16_t>::max()){
+            throw std::length_error(std::format("Function '{}' has too many parameters for the library interface", name));
+        }
+
+        write(out, static_cast<uint8_t>(function->getType()));
+        write(out, static_cast<uint16_t>(parameters.size()));
+        writeName(out, name);
+
+        for(const auto& parameter : parameters){
+            write(out, static_cast<uint8_t>(parameter->getType()));
+            writeName(out, parameter->getToken().value());
+        }
+    }
+
+    return out;
+}
+
+const std::vector<preprocessing::FunctionSignature>& preprocessing::LibraryInterface::getFunctions() const noexcept {
+    return functions;
+}
+
+void preprocessing::LibraryInterface::declare(
+    syntax::ast::ASTArena& arena,
+    std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>>& declarations
+) const {
+    // names are tokens without a source, there is no line to point at in the interface
+    auto nameToken{
+        [](std::string_view name) -> syntax::Token {
+            return syntax::Token{ name, util::io::SourceRegistry::noSource, syntax::TokenType::ID, syntax::GeneralTokenType::VALUE };
+        }
+    };
+
+    for(const auto& signature : functions){
+        auto function{ arena.make<syntax::ast::ASTFunction>(nameToken(signature.name), signature.type) };
+        for(const auto& parameter : signature.parameters){
+            function->addParameter(arena.make<syntax::ast::ASTParameter>(nameToken(parameter.name), parameter.type));
+        }
+        function->setPredefined(true);
+        declarations.push_back(std::move(function));
+    }
+}
+
+bool preprocessing::LibraryInterface::decode(){
+    InterfaceReader reader{ .data = file.view() };
+
+    std::array<char, magic.size()> fileMagic;
+    uint32_t fileVersion;
+    uint32_t functionCount;
+    if(!reader.read(fileMagic) || fileMagic != magic || !reader.read(fileVersion) || fileVersion != version){
+        return false;
+    }
+    if(!reader.read(functionCount)){
+        return false;
+    }
+
+    // every function takes at least 6 bytes, count of a truncated file is not trusted for the reservation
+    functions.reserve(std::min<size_t>(functionCount, reader.data.size() / 6));
+    for(uint32_t i{ 0 }; i < functionCount; ++i){
+        preprocessing::FunctionSignature& signature{ functions.emplace_back() };
+        uint16_t parameterCount;
+        if(!reader.readType(signature.type) || !reader.read(parameterCount) || !reader.readName(signature.name)){
+            return false;
+        }
+
+        signature.parameters.resize(parameterCount);
+        for(auto& parameter : signature.parameters){
+            if(!reader.readType(parameter.type) || !reader.readName(parameter.name)){
+                return false;
+            }
+        }
+    }
+
+    return reader.offset == reader.data.size();
+}
\ No newline at end of file
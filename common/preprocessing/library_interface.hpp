@@ -0,0 +1,123 @@
+#ifndef LIBRARY_INTERFACE_HPP
+#define LIBRARY_INTERFACE_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../source/mapped_file.hpp"
+#include "../defs/types.hpp"
+#include "../abstract-syntax-tree/ast_arena.hpp"
+#include "../abstract-syntax-tree/ast_function.hpp"
+#include "../abstract-syntax-tree/ast_program.hpp"
+
+namespace preprocessing {
+    /**
+     * @struct ParameterSignature
+     * @brief parameter of the function declared by the library
+    */
+    struct ParameterSignature {
+        /// name of the parameter, view into the interface file
+        std::string_view name;
+
+        /// type of the parameter
+        types::Type type;
+    };
+
+    /**
+     * @struct FunctionSignature
+     * @brief function declared by the library
+    */
+    struct FunctionSignature {
+        /// name of the function, view into the interface file
+        std::string_view name;
+
+        /// return type of the function
+        types::Type type;
+
+        /// parameters of the function in declaration order
+        std::vector<ParameterSignature> parameters;
+    };
+
+    /**
+     * @class LibraryInterface
+     * @brief precompiled interface of the library, memory mapped from its .mcppi file
+     * @details interface holds the signatures of the functions the library declares,
+     * they are placed into the ast directly, so the library source is not lexed nor parsed on include
+     *
+     * layout (native byte order):
+     *
+     * header - magic "MCPI", u32 version, u32 function count
+     *
+     * function - u8 return type, u16 parameter count, u16 name length, name
+     *
+     * parameter - u8 type, u16 name length, name
+    */
+    class LibraryInterface {
+    public:
+        /// version of the layout, interfaces of other versions are ignored
+        static constexpr uint32_t version{ 1 };
+
+        /**
+         * @brief maps the interface of the library
+         * @param libName - name of the library
+         * @returns interface, nullopt if it is missing, older than the library source or of another version
+        */
+        static std::optional<LibraryInterface> load(std::string_view libName);
+
+        /**
+         * @brief maps the interface file
+         * @param path - path to the interface file
+         * @returns interface, nullopt if the file is missing, malformed or of another version
+        */
+        static std::optional<LibraryInterface> open(const std::string& path);
+
+        /**
+         * @brief encodes the functions of the library
+         * @param program - const pointer to the parsed library source
+         * @returns contents of the interface file
+         * @throws std::runtime_error when the library includes other libraries or defines a function body
+         * @throws std::length_error when a name or parameter list does not fit the layout
+        */
+        static std::string serialize(const syntax::ast::ASTProgram* program);
+
+        /**
+         * @brief getter for the declared functions
+         * @returns signatures of the functions in declaration order
+        */
+        const std::vector<FunctionSignature>& getFunctions() const noexcept;
+
+        /**
+         * @brief places the predefined functions of the library into the arena
+         * @param arena - reference to the arena of the program
+         * @param declarations - reference to a vector the functions are appended to
+         * @note tokens of the functions view into the interface file, it has to outlive the ast
+        */
+        void declare(syntax::ast::ASTArena& arena, std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>>& declarations) const;
+
+    private:
+        /**
+         * @brief Creates the interface of the mapped file
+         * @param file - mapped interface file
+        */
+        explicit LibraryInterface(util::io::MappedFile file) noexcept;
+
+        /**
+         * @brief decodes the signatures of the mapped file
+         * @returns true if the file is a well formed interface of the current version, false otherwise
+        */
+        bool decode();
+
+        /// mapped interface file, the signatures view into it
+        util::io::MappedFile file;
+
+        /// signatures of the declared functions
+        std::vector<FunctionSignature> functions;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -7,4 +7,8 @@ std::string preprocessing::generateLibSourcePath(std::string_view libName) {
 
 std::string preprocessing::generateLibObjPath(std::string_view libName) {
     return std::format("{}{}/{}{}", relativeLibPath, libName, libName, objExt);
+}
+
+std::string preprocessing::generateLibInterfacePath(std::string_view libName) {
+    return std::format("{}{}/{}{}", relativeLibPath, libName, libName, interfaceExt);
 }
\ No newline at end of file
@@ -13,6 +13,9 @@ namespace preprocessing {
     /// extension of the source file
     inline constexpr std::string_view mcppExt{ ".mcpp" };
 
+    /// extension of the precompiled interface file
+    inline constexpr std::string_view interfaceExt{ ".mcppi" };
+
     /**
      * @brief generates the relative path to the source file
      * @param libName - name of the library
@@ -27,6 +30,13 @@ namespace preprocessing {
     */
     std::string generateLibObjPath(std::string_view libName);
 
+    /**
+     * @brief generates the relative path to the interface file
+     * @param libName - name of the library
+     * @returns relative path to the precompiled interface of the library
+    */
+    std::string generateLibInterfacePath(std::string_view libName);
+
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "mapped_file.hpp"
+
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+util::io::MappedFile::MappedFile(const std::string& path){
+    int fd{ ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+    if(fd == -1){
+        return;
+    }
+
+    struct stat fileStat;
+    if(::fstat(fd, &fileStat) == -1 || !S_ISREG(fileStat.st_mode)){
+        ::close(fd);
+        return;
+    }
+
+    size_t fileSize{ static_cast<size_t>(fileStat.st_size) };
+
+    // mmap rejects zero-length mappings, empty file is represented by an empty view
+    if(fileSize > 0){
+        void* mapping{ ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0) };
+        if(mapping == MAP_FAILED){
+            ::close(fd);
+            return;
+        }
+
+        // input is scanned front to back exactly once
+        ::madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+        data = static_cast<const char*>(mapping);
+        size = fileSize;
+    }
+
+    // mapping stays valid after the descriptor is closed
+    ::close(fd);
+    opened = true;
+}
+
+util::io::MappedFile::~MappedFile(){
+    unmap();
+}
+
+util::io::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{ std::exchange(other.data, nullptr) },
+      size{ std::exchange(other.size, 0) },
+      opened{ std::exchange(other.opened, false) } {}
+
+util::io::MappedFile& util::io::MappedFile::operator=(MappedFile&& other) noexcept {
+    if(this != &other){
+        unmap();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+    }
+    return *this;
+}
+
+bool util::io::MappedFile::isOpen() const noexcept {
+    return opened;
+}
+
+std::string_view util::io::MappedFile::view() const noexcept {
+    return std::string_view{ data, size };
+}
+
+void util::io::MappedFile::unmap() noexcept {
+    if(data != nullptr){
+        ::munmap(const_cast<char*>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+    opened = false;
+}
@@ -0,0 +1,80 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace util::io
+ * @brief module for utilities related to file input
+*/
+namespace util::io {
+    /**
+     * @class MappedFile
+     * @brief read-only memory mapping of a file, owns the mapping
+     * @details contents are exposed as a view, no copy of the file is made
+    */
+    class MappedFile {
+    public:
+        /**
+         * @brief Creates an empty instance of the mapped file
+        */
+        MappedFile() noexcept = default;
+
+        /**
+         * @brief maps the file into memory
+         * @param path - path to the file
+         * @note isOpen() reports whether mapping succeeded
+        */
+        explicit MappedFile(const std::string& path);
+
+        /**
+         * @brief unmaps the file
+        */
+        ~MappedFile();
+
+        /// deleted copy constructor
+        MappedFile(const MappedFile&) = delete;
+
+        /// deleted copy assignment operator
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// move constructor
+        MappedFile(MappedFile&& other) noexcept;
+
+        /// move assignment operator
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * @brief checks if the file was opened successfully
+         * @returns true if file is mapped (or empty), false otherwise
+        */
+        bool isOpen() const noexcept;
+
+        /**
+         * @brief getter for the contents of the file
+         * @returns view of the mapped contents, valid while the mapping exists
+        */
+        std::string_view view() const noexcept;
+
+    private:
+        /// start of the mapping, nullptr for empty files
+        const char* data{nullptr};
+
+        /// size of the mapping in bytes
+        size_t size{0};
+
+        /// flag if the file was opened
+        bool opened{false};
+
+        /**
+         * @brief releases the mapping
+        */
+        void unmap() noexcept;
+
+    };
+
+}
+
+#endif
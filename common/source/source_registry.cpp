@@ -0,0 +1,129 @@
+#include "source_registry.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /**
+     * @struct SourceEntry
+     * @brief registered source buffer with its line-start table
+    */
+    struct SourceEntry {
+        /// contents of the source
+        std::string_view source;
+
+        /// offsets at which lines start, built on first lookup
+        std::vector<uint32_t> lineStarts;
+
+        /// guards construction of the line-start table
+        std::once_flag lineStartsFlag;
+
+        explicit SourceEntry(std::string_view source) : source{ source } {}
+    };
+
+    /// guards registration and lookup of entries
+    std::mutex registryMtx;
+
+    /// registered sources at their id - 1, entries stay in place while new sources are added
+    std::vector<std::unique_ptr<SourceEntry>> entries;
+
+    /// ids of the unregistered sources, reused before new ids are handed out
+    std::vector<uint16_t> freeIds;
+
+    /**
+     * @brief fills the line-start table of the entry
+     * @param entry - entry whose table is built
+    */
+    void buildLineStarts(SourceEntry& entry){
+        entry.lineStarts.push_back(0);
+        for(size_t i = 0; i < entry.source.size(); ++i){
+            if(entry.source[i] == '\n'){
+                entry.lineStarts.push_back(static_cast<uint32_t>(i + 1));
+            }
+        }
+    }
+}
+
+uint16_t util::io::SourceRegistry::registerSource(std::string_view source){
+    if(source.size() > std::numeric_limits<uint32_t>::max()){
+        throw std::length_error("Source file exceeds 4GiB");
+    }
+
+    auto entry{ std::make_unique<SourceEntry>(source) };
+    std::lock_guard<std::mutex> lock{ registryMtx };
+    if(!freeIds.empty()){
+        const uint16_t sourceId{ freeIds.back() };
+        freeIds.pop_back();
+        entries[sourceId - 1] = std::move(entry);
+        return sourceId;
+    }
+
+    if(entries.size() >= std::numeric_limits<uint16_t>::max()){
+        throw std::length_error("Too many source files");
+    }
+
+    // every id can be released without allocating
+    freeIds.reserve(entries.size() + 1);
+    entries.push_back(std::move(entry));
+    return static_cast<uint16_t>(entries.size());
+}
+
+void util::io::SourceRegistry::unregisterSource(uint16_t sourceId) noexcept {
+    if(sourceId == noSource){
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{ registryMtx };
+    entries[sourceId - 1].reset();
+    freeIds.push_back(sourceId);
+}
+
+util::io::SourcePosition util::io::SourceRegistry::position(uint16_t sourceId, const char* location){
+    if(sourceId == noSource){
+        return {0, 0};
+    }
+
+    SourceEntry* entry;
+    {
+        std::lock_guard<std::mutex> lock{ registryMtx };
+        entry = entries[sourceId - 1].get();
+    }
+
+    std::call_once(entry->lineStartsFlag, buildLineStarts, std::ref(*entry));
+
+    const uint32_t offset{ static_cast<uint32_t>(location - entry->source.data()) };
+    auto lineIt{ std::upper_bound(entry->lineStarts.begin(), entry->lineStarts.end(), offset) - 1 };
+
+    return {
+        static_cast<size_t>(lineIt - entry->lineStarts.begin()) + 1,
+        static_cast<size_t>(offset - *lineIt)
+    };
+}
+
+util::io::SourceRegistration::SourceRegistration(std::string_view source)
+    : sourceId{ SourceRegistry::registerSource(source) } {}
+
+util::io::SourceRegistration::~SourceRegistration(){
+    SourceRegistry::unregisterSource(sourceId);
+}
+
+util::io::SourceRegistration::SourceRegistration(SourceRegistration&& other) noexcept
+    : sourceId{ std::exchange(other.sourceId, SourceRegistry::noSource) } {}
+
+util::io::SourceRegistration& util::io::SourceRegistration::operator=(SourceRegistration&& other) noexcept {
+    if(this != &other){
+        SourceRegistry::unregisterSource(sourceId);
+        sourceId = std::exchange(other.sourceId, SourceRegistry::noSource);
+    }
+    return *this;
+}
+
+uint16_t util::io::SourceRegistration::getSourceId() const noexcept {
+    return sourceId;
+}
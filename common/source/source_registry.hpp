@@ -0,0 +1,106 @@
+#ifndef SOURCE_REGISTRY_HPP
+#define SOURCE_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace util::io
+ * @brief module for utilities related to file input
+*/
+namespace util::io {
+    /**
+     * @struct SourcePosition
+     * @brief line and column decoded from a location in the source
+    */
+    struct SourcePosition {
+        /// line of the location, starting from 1
+        size_t line;
+
+        /// column of the location, starting from 0
+        size_t column;
+    };
+
+    /**
+     * @class SourceRegistry
+     * @brief process wide registry of the source buffers tokens point into
+     * @details tokens store only a file id and a pointer into the buffer,
+     * line and column are decoded on demand from a lazily built line-start table,
+     * ids of the unregistered sources are reused
+    */
+    class SourceRegistry {
+    public:
+        /// id of the tokens that do not belong to any source buffer
+        static constexpr uint16_t noSource{ 0 };
+
+        /**
+         * @brief registers a new source buffer
+         * @param source - view of the source, must outlive every token pointing into it
+         * @returns id of the registered source
+         * @throws std::length_error when every id is in use
+        */
+        static uint16_t registerSource(std::string_view source);
+
+        /**
+         * @brief unregisters the source buffer, its id may be given to the next registered source
+         * @param sourceId - id of the source buffer, no token pointing into it may be decoded anymore
+        */
+        static void unregisterSource(uint16_t sourceId) noexcept;
+
+        /**
+         * @brief decodes line and column of the location
+         * @param sourceId - id of the source buffer
+         * @param location - pointer into the source buffer
+         * @returns position of the location, {0, 0} for tokens without source
+         * @note thread-safe, the line-start table is built on the first call for the source
+        */
+        static SourcePosition position(uint16_t sourceId, const char* location);
+
+    };
+
+    /**
+     * @class SourceRegistration
+     * @brief owns the registration of the source buffer, the source is unregistered with it
+     * @details owner of the registration has to outlive every token pointing into the source
+    */
+    class SourceRegistration {
+    public:
+        /**
+         * @brief registers the source buffer
+         * @param source - view of the source, must outlive the registration
+         * @throws std::length_error when every id is in use
+        */
+        explicit SourceRegistration(std::string_view source);
+
+        /**
+         * @brief unregisters the source buffer
+        */
+        ~SourceRegistration();
+
+        /// deleted copy constructor
+        SourceRegistration(const SourceRegistration&) = delete;
+
+        /// deleted copy assignment operator
+        SourceRegistration& operator=(const SourceRegistration&) = delete;
+
+        /// move constructor, moved from registration owns no source
+        SourceRegistration(SourceRegistration&& other) noexcept;
+
+        /// move assignment operator, moved from registration owns no source
+        SourceRegistration& operator=(SourceRegistration&& other) noexcept;
+
+        /**
+         * @brief getter for the id of the registered source
+         * @returns id of the source, noSource for the moved from registration
+        */
+        uint16_t getSourceId() const noexcept;
+
+    private:
+        /// id of the registered source
+        uint16_t sourceId;
+
+    };
+}
+
+#endif
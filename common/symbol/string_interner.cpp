@@ -0,0 +1,251 @@
+#include "string_interner.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /// number of independently locked shards, insertions of different names rarely contend
+    constexpr size_t shardCount{ 64 };
+
+    /// number of slots of the first table of a shard
+    constexpr size_t initialSlots{ 256 };
+
+    /// number of names in the first segment of the id table, every next segment is twice as large
+    constexpr size_t baseSegment{ 1024 };
+
+    /// number of segments, enough to cover the whole 32-bit id space
+    constexpr size_t segmentCount{ 23 };
+
+    /// size of a block the names are copied into
+    constexpr size_t nameBlockSize{ 64 * 1024 };
+
+    /**
+     * @struct Table
+     * @brief open addressing table of a shard
+     * @details slot holds upper 32 bits of the hash and the id, 0 marks an empty slot,
+     * full table is replaced by a larger one and kept alive for the readers still probing it
+    */
+    struct Table {
+        /// capacity - 1, capacity is a power of two
+        size_t mask;
+
+        /// number of occupied slots, written under the shard lock
+        size_t count{ 0 };
+
+        /// slots of the table
+        std::unique_ptr<std::atomic<uint64_t>[]> slots;
+
+        explicit Table(size_t capacity)
+            : mask{ capacity - 1 }, slots{ std::make_unique<std::atomic<uint64_t>[]>(capacity) } {}
+    };
+
+    /**
+     * @struct Shard
+     * @brief part of the interner owning the names whose hash falls into it
+    */
+    struct Shard {
+        /// guards insertions into the shard
+        std::mutex mtx;
+
+        /// table readers probe
+        std::atomic<Table*> table{ nullptr };
+
+        /// current and replaced tables
+        std::vector<std::unique_ptr<Table>> tables;
+
+        /// blocks the names are copied into
+        std::vector<std::unique_ptr<char[]>> nameBlocks;
+
+        /// number of used bytes of the last block
+        size_t blockUsed{ nameBlockSize };
+    };
+
+    /**
+     * @struct InternerState
+     * @brief shared state of the interner
+    */
+    struct InternerState {
+        /// shards of the hash table
+        std::array<Shard, shardCount> shards;
+
+        /// segments mapping ids to names, allocated when the first id of the segment is handed out
+        std::array<std::atomic<std::string_view*>, segmentCount> segments{};
+
+        /// next id to be handed out, 0 is reserved for the empty name
+        std::atomic<uint32_t> nextId{ 1 };
+
+        ~InternerState(){
+            for(auto& segment : segments){
+                delete[] segment.load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+    /**
+     * @brief getter for the interner state
+     * @returns state constructed on the first use, so names can be interned during static initialization
+    */
+    InternerState& state(){
+        static InternerState interner;
+        return interner;
+    }
+
+    /**
+     * @brief splits the id into its segment and offset inside of the segment
+     * @param id - id of the name
+     * @returns pair (segment, offset)
+    */
+    std::pair<size_t, size_t> locate(util::text::SymbolId id) noexcept {
+        const size_t block{ id / baseSegment + 1 };
+        const size_t segment{ static_cast<size_t>(std::bit_width(block)) - 1 };
+        return { segment, id - baseSegment * ((size_t{ 1 } << segment) - 1) };
+    }
+
+    /**
+     * @brief probes the table for the name
+     * @param table - table of the shard
+     * @param tag - upper 32 bits of the hash of the name
+     * @param name - searched name
+     * @returns id of the name, emptyId if the name is not in the table
+    */
+    util::text::SymbolId probe(const Table& table, uint32_t tag, std::string_view name) noexcept {
+        for(size_t slot = tag & table.mask; ; slot = (slot + 1) & table.mask){
+            const uint64_t entry{ table.slots[slot].load(std::memory_order_acquire) };
+            if(entry == 0){
+                return util::text::StringInterner::emptyId;
+            }
+
+            const auto id{ static_cast<util::text::SymbolId>(entry) };
+            if(static_cast<uint32_t>(entry >> 32) == tag && util::text::StringInterner::name(id) == name){
+                return id;
+            }
+        }
+    }
+
+    /**
+     * @brief places the entry into the first free slot of its probe sequence
+     * @param table - table of the shard
+     * @param entry - tag and id of the name
+    */
+    void place(Table& table, uint64_t entry) noexcept {
+        size_t slot{ static_cast<uint32_t>(entry >> 32) & table.mask };
+        while(table.slots[slot].load(std::memory_order_relaxed) != 0){
+            slot = (slot + 1) & table.mask;
+        }
+        table.slots[slot].store(entry, std::memory_order_release);
+        ++table.count;
+    }
+
+    /**
+     * @brief copies the name into the storage of the shard
+     * @param shard - shard owning the name, locked
+     * @param name - name to be copied
+     * @returns view of the copy
+    */
+    std::string_view storeName(Shard& shard, std::string_view name){
+        if(shard.blockUsed + name.size() > nameBlockSize){
+            shard.nameBlocks.push_back(std::make_unique<char[]>(std::max(nameBlockSize, name.size())));
+            shard.blockUsed = 0;
+        }
+
+        char* copy{ shard.nameBlocks.back().get() + shard.blockUsed };
+        std::memcpy(copy, name.data(), name.size());
+        shard.blockUsed += name.size();
+        return std::string_view{ copy, name.size() };
+    }
+
+    /**
+     * @brief hands out the next id and records its name
+     * @param interner - interner state
+     * @param name - stored name
+     * @returns new id
+    */
+    util::text::SymbolId assignId(InternerState& interner, std::string_view name){
+        const util::text::SymbolId id{ interner.nextId.fetch_add(1, std::memory_order_relaxed) };
+        if(id == util::text::StringInterner::emptyId){
+            throw std::length_error("Too many distinct names");
+        }
+
+        auto [segment, offset]{ locate(id) };
+        std::string_view* names{ interner.segments[segment].load(std::memory_order_acquire) };
+        if(names == nullptr){
+            auto* allocated{ new std::string_view[baseSegment << segment] };
+            if(interner.segments[segment].compare_exchange_strong(names, allocated, std::memory_order_acq_rel)){
+                names = allocated;
+            }
+            else {
+                delete[] allocated;
+            }
+        }
+
+        names[offset] = name;
+        return id;
+    }
+}
+
+util::text::SymbolId util::text::StringInterner::intern(std::string_view name){
+    if(name.empty()){
+        return emptyId;
+    }
+
+    const uint64_t hash{ std::hash<std::string_view>{}(name) };
+    const auto tag{ static_cast<uint32_t>(hash >> 32) };
+
+    auto& interner{ state() };
+    Shard& shard{ interner.shards[hash % shardCount] };
+
+    if(const Table* table{ shard.table.load(std::memory_order_acquire) }){
+        if(SymbolId id{ probe(*table, tag, name) }; id != emptyId){
+            return id;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{ shard.mtx };
+
+    Table* table{ shard.table.load(std::memory_order_relaxed) };
+    if(table == nullptr){
+        table = shard.tables.emplace_back(std::make_unique<Table>(initialSlots)).get();
+        shard.table.store(table, std::memory_order_release);
+    }
+    else if(SymbolId id{ probe(*table, tag, name) }; id != emptyId){
+        // other thread interned the name in the meantime
+        return id;
+    }
+
+    if((table->count + 1) * 2 > table->mask + 1){
+        // keeping the load under one half keeps the probe sequences short
+        auto grown{ std::make_unique<Table>((table->mask + 1) * 2) };
+        for(size_t slot = 0; slot <= table->mask; ++slot){
+            if(uint64_t entry{ table->slots[slot].load(std::memory_order_relaxed) }; entry != 0){
+                place(*grown, entry);
+            }
+        }
+        table = shard.tables.emplace_back(std::move(grown)).get();
+        shard.table.store(table, std::memory_order_release);
+    }
+
+    const SymbolId id{ assignId(interner, storeName(shard, name)) };
+    place(*table, static_cast<uint64_t>(tag) << 32 | id);
+    return id;
+}
+
+std::string_view util::text::StringInterner::name(util::text::SymbolId id) noexcept {
+    if(id == emptyId){
+        return {};
+    }
+
+    auto [segment, offset]{ locate(id) };
+    return state().segments[segment].load(std::memory_order_acquire)[offset];
+}
+
+size_t util::text::StringInterner::size() noexcept {
+    return state().nextId.load(std::memory_order_relaxed);
+}
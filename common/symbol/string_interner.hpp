@@ -0,0 +1,55 @@
+#ifndef STRING_INTERNER_HPP
+#define STRING_INTERNER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace util::text
+ * @brief module for utilities related to names and text shared by the compiler phases
+*/
+namespace util::text {
+    /// dense id of the interned name
+    using SymbolId = uint32_t;
+
+    /**
+     * @class StringInterner
+     * @brief process wide table mapping every distinct name to a dense 32-bit id
+     * @details names are copied into storage that lives until the end of the process,
+     * so views returned for an id stay valid after the source is unmapped,
+     * lookup of an already interned name does not take any lock, only the first insertion does
+    */
+    class StringInterner {
+    public:
+        /// id of the empty name, used by nodes that are not named
+        static constexpr SymbolId emptyId{ 0 };
+
+        /**
+         * @brief interns the name
+         * @param name - name to be interned
+         * @returns id of the name, same name always yields the same id
+         * @throws std::length_error when the id space is exhausted
+         * @note thread-safe
+        */
+        static SymbolId intern(std::string_view name);
+
+        /**
+         * @brief getter for the name of the id
+         * @param id - id returned by intern
+         * @returns view of the interned name
+         * @note thread-safe, id must have been obtained from intern
+        */
+        static std::string_view name(SymbolId id) noexcept;
+
+        /**
+         * @brief getter for the number of interned names
+         * @returns number of names, including the empty name
+        */
+        static size_t size() noexcept;
+
+    };
+
+}
+
+#endif
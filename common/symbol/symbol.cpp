@@ -2,11 +2,18 @@
 
 #include <format>
 
+semantic::Symbol::Symbol(util::text::SymbolId id, semantic::Kind kind, types::Type type) 
+    : id{ id }, parameters{ nullptr }, kind{ kind }, type{ type } {}
+
 semantic::Symbol::Symbol(std::string_view name, semantic::Kind kind, types::Type type) 
-    : name{ name }, parameters{ nullptr }, kind{ kind }, type{ type } {}
+    : Symbol{ util::text::StringInterner::intern(name), kind, type } {}
+
+util::text::SymbolId semantic::Symbol::getId() const noexcept {
+    return id;
+}
 
-const std::string& semantic::Symbol::getName() const noexcept {
-    return name;
+std::string_view semantic::Symbol::getName() const noexcept {
+    return util::text::StringInterner::name(id);
 }
 
 semantic::Kind semantic::Symbol::getKind() const noexcept {
@@ -17,13 +24,13 @@ types::Type semantic::Symbol::getType() const noexcept {
     return type;
 }
 
-const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>* 
+const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>* 
 semantic::Symbol::getParameters() const noexcept {
     return parameters;
 }
 
 void semantic::Symbol::setName(std::string_view symName){
-    name = symName;
+    id = util::text::StringInterner::intern(symName);
 }
 
 void semantic::Symbol::setKind(semantic::Kind symKind) noexcept {
@@ -35,14 +42,14 @@ void semantic::Symbol::setType(types::Type symType) noexcept {
 }
 
 void semantic::Symbol::setParameters(
-    const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>* symParams
+    const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>* symParams
 ) noexcept {
     parameters = symParams;
 }
 
 std::string semantic::Symbol::symbolToString() const {
     return std::format("| {:11} | {:3} | {:8} | {:2} |\n", 
-        name, 
+        getName(), 
         semantic::kindToStr(kind), 
         typeToStr(type), 
         (parameters != nullptr 
@@ -2,12 +2,15 @@
 #define SYMBOL_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 
+#include "../abstract-syntax-tree/ast_arena.hpp"
 #include "../abstract-syntax-tree/ast_parameter.hpp"
 #include "../defs/types.hpp"
 #include "../defs/kinds.hpp"
+#include "string_interner.hpp"
 
 namespace semantic {
     /** 
@@ -18,7 +21,19 @@ namespace semantic {
     public:
         /** 
          * @brief Creates a new instance of the symbol
-         * @param name - name of the symbol
+         * @param id - interned name of the symbol
+         * @param kind - kind of the symbol, default NO_KIND
+         * @param type - type of the symbol, default NO_TYPE
+        */
+        Symbol(
+            util::text::SymbolId id, 
+            Kind kind = Kind::NO_KIND, 
+            types::Type type = types::Type::NO_TYPE
+        );
+
+        /** 
+         * @brief Creates a new instance of the symbol
+         * @param name - name of the symbol, interned
          * @param kind - kind of the symbol, default NO_KIND
          * @param type - type of the symbol, default NO_TYPE
         */
@@ -28,11 +43,17 @@ namespace semantic {
             types::Type type = types::Type::NO_TYPE
         );
 
+        /** 
+         * @brief getter for the id of the symbol
+         * @returns interned name of the symbol
+        */
+        util::text::SymbolId getId() const noexcept;
+
         /** 
          * @brief getter for the name of the symbol
-         * @returns const reference to a name of the symbol
+         * @returns view of the interned name of the symbol
         */
-        const std::string& getName() const noexcept;
+        std::string_view getName() const noexcept;
 
         /** 
          * @brief getter for the kind of the symbol
@@ -50,7 +71,7 @@ namespace semantic {
          * @brief getter for the parameters (if symbol is a function)
          * @returns pointer to a vector of pointers to parameters
         */
-        const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>* 
+        const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>* 
         getParameters() const noexcept;
 
         /** 
@@ -75,7 +96,7 @@ namespace semantic {
          * @brief initializes symbol parameters (if the symbol is a function)
          * @param symParams - pointer to a vector of pointers to the parameters of the symbol
         */
-        void setParameters(const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>* symParams) noexcept;
+        void setParameters(const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>* symParams) noexcept;
 
         /** 
          * @brief formats the fields of the symbol
@@ -85,11 +106,11 @@ namespace semantic {
         std::string symbolToString() const;
 
     private:
-        /// name of the symbol
-        std::string name;
+        /// interned name of the symbol
+        util::text::SymbolId id;
 
         /// pointer to parameter node (only for functions)
-        const std::vector<std::unique_ptr<syntax::ast::ASTParameter>>* parameters;
+        const std::pmr::vector<syntax::ast::ASTPtr<syntax::ast::ASTParameter>>* parameters;
 
         /// kind of the symbol
         Kind kind;
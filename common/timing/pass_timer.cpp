@@ -0,0 +1,199 @@
+#include "pass_timer.hpp"
+
+#include <format>
+#include <time.h>
+#include <sys/resource.h>
+
+namespace {
+    /**
+     * @brief getter for the cpu time of the clock
+     * @param clock - id of the cpu clock
+     * @returns cpu time consumed so far
+    */
+    std::chrono::nanoseconds cpuTime(clockid_t clock) noexcept {
+        timespec time{};
+        clock_gettime(clock, &time);
+        return std::chrono::seconds{ time.tv_sec } + std::chrono::nanoseconds{ time.tv_nsec };
+    }
+
+    /**
+     * @brief getter for the cpu time of the terminated and waited for children
+     * @returns user and system time of the children
+    */
+    std::chrono::nanoseconds childrenCpuTime() noexcept {
+        rusage usage{};
+        getrusage(RUSAGE_CHILDREN, &usage);
+        auto toNanoseconds{
+            [](const timeval& time) -> std::chrono::nanoseconds {
+                return std::chrono::seconds{ time.tv_sec } + std::chrono::microseconds{ time.tv_usec };
+            }
+        };
+        return toNanoseconds(usage.ru_utime) + toNanoseconds(usage.ru_stime);
+    }
+
+    /**
+     * @brief getter for the peak resident set size of the process
+     * @returns peak resident set size in KiB
+    */
+    int64_t peakRss() noexcept {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    /**
+     * @brief converts the duration into milliseconds
+     * @param duration - converted duration
+     * @returns duration in milliseconds
+    */
+    double toMilliseconds(std::chrono::nanoseconds duration) noexcept {
+        return std::chrono::duration<double, std::milli>{ duration }.count();
+    }
+}
+
+std::string_view util::timing::passName(util::timing::Pass pass) noexcept {
+    switch(pass){
+        case Pass::READ_SOURCE:             return "read source";
+        case Pass::PREPROCESS:              return "preprocess";
+        case Pass::LEXICAL_ANALYSIS:        return "lexical analysis";
+        case Pass::SYNTAX_ANALYSIS:         return "syntax analysis";
+        case Pass::TRANSLATION:             return "translation";
+        case Pass::SEMANTIC_ANALYSIS:       return "semantic analysis";
+        case Pass::LOWERING:                return "ir lowering";
+        case Pass::DEAD_CODE_ELIMINATION:   return "dead code elimination";
+        case Pass::STACK_FRAME_ANALYSIS:    return "stack frame analysis";
+        case Pass::FUNCTION_GENERATION:     return "function generation";
+        case Pass::WRITE_CODE:              return "write code";
+        case Pass::ASSEMBLE_AND_LINK:       return "assemble and link";
+        default:                            return "unknown";
+    }
+}
+
+bool util::timing::isTaskPass(util::timing::Pass pass) noexcept {
+    switch(pass){
+        case Pass::PREPROCESS:
+        case Pass::SEMANTIC_ANALYSIS:
+        case Pass::LOWERING:
+        case Pass::DEAD_CODE_ELIMINATION:
+        case Pass::STACK_FRAME_ANALYSIS:
+        case Pass::FUNCTION_GENERATION:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void util::timing::PassTimer::add(util::timing::Pass pass, const util::timing::PassTimes& times) noexcept {
+    Entry& entry{ entries[static_cast<size_t>(pass)] };
+    entry.runs.fetch_add(1, std::memory_order_relaxed);
+    entry.wall.fetch_add(times.wall.count(), std::memory_order_relaxed);
+    entry.cpu.fetch_add(times.cpu.count(), std::memory_order_relaxed);
+    entry.peakRssDelta.fetch_add(times.peakRssDelta, std::memory_order_relaxed);
+    entry.cost.fetch_add(times.cost, std::memory_order_relaxed);
+}
+
+util::timing::PassTimes util::timing::PassTimer::get(util::timing::Pass pass) const noexcept {
+    const Entry& entry{ entries[static_cast<size_t>(pass)] };
+    return PassTimes{
+        entry.runs.load(std::memory_order_relaxed),
+        std::chrono::nanoseconds{ entry.wall.load(std::memory_order_relaxed) },
+        std::chrono::nanoseconds{ entry.cpu.load(std::memory_order_relaxed) },
+        entry.peakRssDelta.load(std::memory_order_relaxed),
+        entry.cost.load(std::memory_order_relaxed)
+    };
+}
+
+void util::timing::PassTimer::write(std::ostream& out, util::timing::ReportFormat format) const {
+    if(format == ReportFormat::JSON){
+        writeJson(out);
+    }
+    else {
+        writeTable(out);
+    }
+}
+
+void util::timing::PassTimer::writeTable(std::ostream& out) const {
+    out << std::format("{:<26}{:>8}{:>14}{:>14}{:>22}{:>16}\n", "Pass", "Runs", "Wall (ms)", "CPU (ms)", "Peak RSS delta (KiB)", "Estimated cost");
+    for(size_t i{ 0 }; i < entries.size(); ++i){
+        const Pass pass{ static_cast<Pass>(i) };
+        const PassTimes times{ get(pass) };
+        if(times.runs == 0){
+            continue;
+        }
+
+        // passes of the translation run as a chain of every function, they are nested under it
+        const bool nested{ pass > Pass::TRANSLATION && pass <= Pass::WRITE_CODE };
+        out << std::format(
+            "{:<26}{:>8}{:>14.3f}{:>14.3f}{:>22}{:>16}\n",
+            std::format("{}{}{}", nested ? "  " : "", passName(pass), isTaskPass(pass) ? " *" : ""),
+            times.runs, toMilliseconds(times.wall), toMilliseconds(times.cpu),
+            isTaskPass(pass) ? std::string{ "-" } : std::to_string(times.peakRssDelta),
+            times.cost == 0 ? std::string{ "-" } : std::to_string(times.cost)
+        );
+    }
+    out << "* times of the runs summed over every thread\n";
+}
+
+void util::timing::PassTimer::writeJson(std::ostream& out) const {
+    out << "{\"passes\": [";
+    bool first{ true };
+    for(size_t i{ 0 }; i < entries.size(); ++i){
+        const Pass pass{ static_cast<Pass>(i) };
+        const PassTimes times{ get(pass) };
+        if(times.runs == 0){
+            continue;
+        }
+
+        out << std::format(
+            "{}\n  {{\"name\": \"{}\", \"task\": {}, \"runs\": {}, \"wall_ms\": {:.3f}, \"cpu_ms\": {:.3f}",
+            first ? "" : ",", passName(pass), isTaskPass(pass), times.runs,
+            toMilliseconds(times.wall), toMilliseconds(times.cpu)
+        );
+        if(!isTaskPass(pass)){
+            out << std::format(", \"peak_rss_delta_kib\": {}", times.peakRssDelta);
+        }
+        if(times.cost != 0){
+            out << std::format(", \"estimated_cost\": {}", times.cost);
+        }
+        out << "}";
+        first = false;
+    }
+    out << "\n]}\n";
+}
+
+util::timing::PassGuard::PassGuard(
+    util::timing::PassTimer* timer, util::timing::Pass pass, util::text::SymbolId subject, size_t cost
+) noexcept
+    : timer{ timer }, pass{ pass }, cost{ cost },
+      trace{ passName(pass), pass == Pass::PREPROCESS ? "library" : isTaskPass(pass) ? "function" : "phase", subject, cost } {
+    if(!timer){
+        return;
+    }
+
+    if(isTaskPass(pass)){
+        cpuStart = cpuTime(CLOCK_THREAD_CPUTIME_ID);
+    }
+    else {
+        cpuStart = cpuTime(CLOCK_PROCESS_CPUTIME_ID) + childrenCpuTime();
+        peakRssStart = peakRss();
+    }
+    wallStart = std::chrono::steady_clock::now();
+}
+
+util::timing::PassGuard::~PassGuard(){
+    if(!timer){
+        return;
+    }
+
+    PassTimes times;
+    times.cost = cost;
+    times.wall = std::chrono::steady_clock::now() - wallStart;
+    if(isTaskPass(pass)){
+        times.cpu = cpuTime(CLOCK_THREAD_CPUTIME_ID) - cpuStart;
+    }
+    else {
+        times.cpu = cpuTime(CLOCK_PROCESS_CPUTIME_ID) + childrenCpuTime() - cpuStart;
+        times.peakRssDelta = peakRss() - peakRssStart;
+    }
+    timer->add(pass, times);
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#ifndef PASS_TIMER_HPP
+#define PASS_TIMER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+#include "../symbol/string_interner.hpp"
+#include "../tracing/trace.hpp"
+
+/**
+ * @namespace util::timing
+ * @brief module for measuring the passes of the compiler
+*/
+namespace util::timing {
+    /**
+     * @enum Pass
+     * @brief measured passes of the compiler, in the order they are reported
+    */
+    enum class Pass : uint8_t {
+        READ_SOURCE,            //< mapping of the source file
+        PREPROCESS,             //< loading of the included libraries, per library
+        LEXICAL_ANALYSIS,       //< tokenization
+        SYNTAX_ANALYSIS,        //< parsing, lexing included when the tokens are streamed
+        TRANSLATION,            //< every pass from the semantic analysis to the written code
+        SEMANTIC_ANALYSIS,      //< semantic analysis, per function
+        LOWERING,               //< transformation of the ast into irt, per function
+        DEAD_CODE_ELIMINATION,  //< dead code elimination, per function
+        STACK_FRAME_ANALYSIS,   //< stack frame analysis, per function
+        FUNCTION_GENERATION,    //< code generation, per function
+        WRITE_CODE,             //< writing of the generated code
+        ASSEMBLE_AND_LINK,      //< assembling and linking of the executable
+
+        COUNT                   //< number of the passes
+    };
+
+    /**
+     * @brief getter for the name of the pass
+     * @param pass - measured pass
+     * @returns name of the pass as it is reported
+    */
+    std::string_view passName(Pass pass) noexcept;
+
+    /**
+     * @brief checks if the pass runs as many tasks, concurrently on different threads
+     * @param pass - measured pass
+     * @returns true if the times of the pass are summed over its tasks, false if the pass runs once on the calling thread
+    */
+    bool isTaskPass(Pass pass) noexcept;
+
+    /**
+     * @enum ReportFormat
+     * @brief format of the written report
+    */
+    enum class ReportFormat : uint8_t {
+        TABLE,  //< human-readable table
+        JSON    //< json object
+    };
+
+    /**
+     * @struct PassTimes
+     * @brief measured times of the pass
+    */
+    struct PassTimes {
+        /// number of the measured runs, functions or libraries for the task passes
+        size_t runs{ 0 };
+
+        /// elapsed wall time, summed over the tasks of the task pass
+        std::chrono::nanoseconds wall{ 0 };
+
+        /// cpu time, of the whole process and its children, of the running threads for the task pass
+        std::chrono::nanoseconds cpu{ 0 };
+
+        /// growth of the peak resident set size in KiB, not measured for the task pass
+        int64_t peakRssDelta{ 0 };
+
+        /// estimated cost of the functions the runs worked on, 0 when it was not estimated
+        size_t cost{ 0 };
+    };
+
+    /**
+     * @class PassTimer
+     * @brief collects the times of the passes and writes them as a report
+     * @note thread-safe, tasks of the same pass add their times concurrently
+    */
+    class PassTimer {
+    public:
+        /**
+         * @brief Creates the instance of the timer without measured passes
+        */
+        PassTimer() = default;
+
+        /// deleted copy constructor
+        PassTimer(const PassTimer&) = delete;
+
+        /// deleted assignment operator
+        PassTimer& operator=(const PassTimer&) = delete;
+
+        /**
+         * @brief adds a measured run of the pass
+         * @param pass - measured pass
+         * @param times - times of the run, runs are ignored
+        */
+        void add(Pass pass, const PassTimes& times) noexcept;
+
+        /**
+         * @brief getter for the times of the pass
+         * @param pass - measured pass
+         * @returns times of every run of the pass added together
+        */
+        PassTimes get(Pass pass) const noexcept;
+
+        /**
+         * @brief writes the times of the measured passes, passes that did not run are left out
+         * @param out - output stream
+         * @param format - format of the report
+        */
+        void write(std::ostream& out, ReportFormat format) const;
+
+    private:
+        /**
+         * @struct Entry
+         * @brief accumulated times of the pass
+        */
+        struct Entry {
+            /// number of the measured runs
+            std::atomic<size_t> runs{ 0 };
+
+            /// wall time in nanoseconds
+            std::atomic<int64_t> wall{ 0 };
+
+            /// cpu time in nanoseconds
+            std::atomic<int64_t> cpu{ 0 };
+
+            /// growth of the peak resident set size in KiB
+            std::atomic<int64_t> peakRssDelta{ 0 };
+
+            /// estimated cost of the functions
+            std::atomic<size_t> cost{ 0 };
+        };
+
+        /// times of the passes, indexed by the pass
+        std::array<Entry, static_cast<size_t>(Pass::COUNT)> entries;
+
+        /**
+         * @brief writes the report as a table
+         * @param out - output stream
+        */
+        void writeTable(std::ostream& out) const;
+
+        /**
+         * @brief writes the report as a json object
+         * @param out - output stream
+        */
+        void writeJson(std::ostream& out) const;
+
+    };
+
+    /**
+     * @class PassGuard
+     * @brief measures the pass from its creation until its destruction
+     * @details task pass measures the cpu time of the calling thread,
+     * other passes measure the cpu time of the process and the growth of its peak resident set size,
+     * run is recorded as a trace event as well, when the tracing is started
+    */
+    class PassGuard {
+    public:
+        /**
+         * @brief starts measuring the pass
+         * @param timer - pointer to the timer the run is added to, nullptr measures nothing
+         * @param pass - measured pass
+         * @param subject - interned name of the function or library the run works on, traced with the run
+         * @param cost - estimated cost of the function the run works on, reported next to the measured times
+        */
+        PassGuard(PassTimer* timer, Pass pass, util::text::SymbolId subject = util::text::StringInterner::emptyId, size_t cost = 0) noexcept;
+
+        /**
+         * @brief adds the measured run to the timer
+        */
+        ~PassGuard();
+
+        /// deleted copy constructor
+        PassGuard(const PassGuard&) = delete;
+
+        /// deleted assignment operator
+        PassGuard& operator=(const PassGuard&) = delete;
+
+    private:
+        /// timer the run is added to, null when nothing is measured
+        PassTimer* timer;
+
+        /// measured pass
+        Pass pass;
+
+        /// estimated cost of the function the run works on
+        size_t cost;
+
+        /// wall time at the start of the run
+        std::chrono::steady_clock::time_point wallStart;
+
+        /// cpu time at the start of the run
+        std::chrono::nanoseconds cpuStart{ 0 };
+
+        /// peak resident set size in KiB at the start of the run
+        int64_t peakRssStart{ 0 };
+
+        /// trace event of the run
+        [[maybe_unused]] util::tracing::Scope trace;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
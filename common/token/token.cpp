@@ -1,29 +1,25 @@
 #include "token.hpp"
 
-syntax::Token::Token() 
-    : value{ "" }, 
-      line{ 0 }, 
-      column{ 0 }, 
-      type{ syntax::TokenType::NODE }, 
-      gtype{ syntax::GeneralTokenType::OTHER } {}
+#include "../source/source_registry.hpp"
 
-syntax::Token::Token(std::string_view value, size_t line, size_t column) 
-    : value{ value }, 
-      line{ line }, 
-      column{ column }, 
-      type{ syntax::TokenType::NODE }, 
-      gtype{ syntax::GeneralTokenType::OTHER } {}
+syntax::Token::Token()
+    : start{ "" },
+      length{ 0 },
+      type{ syntax::TokenType::NODE },
+      gtype{ syntax::GeneralTokenType::OTHER },
+      sourceId{ util::io::SourceRegistry::noSource } {}
 
-syntax::Token::Token(std::string_view value, size_t line, size_t column, syntax::TokenType type) 
-    : value{ value }, 
-      line{ line }, 
-      column{ column }, 
-      type{ type }, 
-      gtype{ syntax::GeneralTokenType::OTHER } {}
+syntax::Token::Token(std::string_view value, uint16_t sourceId, syntax::TokenType type, syntax::GeneralTokenType gtype)
+    : start{ value.data() },
+      length{ static_cast<uint32_t>(value.length()) },
+      type{ type },
+      gtype{ gtype },
+      sourceId{ sourceId } {}
 
-syntax::Token::Token(std::string_view value, size_t line, size_t column, syntax::TokenType type, syntax::GeneralTokenType gtype) 
-    : value{ value }, 
-      line{ line }, 
-      column{ column }, 
-      type{ type }, 
-      gtype{ gtype } {}
+size_t syntax::Token::line() const {
+    return util::io::SourceRegistry::position(sourceId, start).line;
+}
+
+size_t syntax::Token::column() const {
+    return util::io::SourceRegistry::position(sourceId, start).column;
+}
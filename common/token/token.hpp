@@ -1,65 +1,73 @@
 #ifndef TOKEN_HPP
 #define TOKEN_HPP
 
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 #include "token_types.hpp"
 
 namespace syntax {
-    /** 
+    /**
      * @struct Token
      * @brief description of a token
+     * @details token is a view into a registered source buffer,
+     * line and column are decoded only when requested
     */
     struct Token {
-        /// literal value of the token
-        std::string value;
+        /// start of the token in the source buffer
+        const char* start;
 
-        /// line where token was found
-        size_t line;
-
-        /// column where token ends
-        size_t column;
+        /// length of the token in bytes
+        uint32_t length;
 
         /// type of a token
         TokenType type;
-        
+
         /// general type of a token
         GeneralTokenType gtype;
 
-        /** 
+        /// id of the source buffer the token belongs to
+        uint16_t sourceId;
+
+        /**
         * @brief Creates a new instance of a token
         */
         Token();
 
-        /** 
+        /**
          * @brief Creates a new instance of a token
-         * @param value - literal value of the token
-         * @param line - line where token was found
-         * @param column - column where token ends
+         * @param value - literal value of the token, view into the source buffer
+         * @param sourceId - id of the source buffer
+         * @param type - type of the token
+         * @param gtype - general type of the token
         */
-        Token(std::string_view value, size_t line, size_t column);
+        Token(std::string_view value, uint16_t sourceId, TokenType type, GeneralTokenType gtype);
 
-        /** 
-         * @brief Creates a new instance of a token
-         * @param value - literal value of the token
-         * @param line - line where token was found
-         * @param column - column where token ends
-         * @param type - type of the token
+        /**
+         * @brief getter for the literal value of the token
+         * @returns view into the source buffer
         */
-        Token(std::string_view value, size_t line, size_t column, TokenType type);
+        inline std::string_view value() const noexcept {
+            return std::string_view{ start, length };
+        }
 
-        /** 
-         * @brief Creates a new instance of a token
-         * @param value - literal value of the token
-         * @param line - line where token was found
-         * @param column - column where token ends
-         * @param type - type of the token
-         * @param gtype - general type of the token
+        /**
+         * @brief decodes the line of the token
+         * @returns line where token was found
         */
-        Token(std::string_view value, size_t line, size_t column, TokenType type, GeneralTokenType gtype);
+        size_t line() const;
+
+        /**
+         * @brief decodes the column of the token
+         * @returns column where token starts
+        */
+        size_t column() const;
 
     };
 
+    static_assert(sizeof(Token) == 16, "token is expected to fit into 16 bytes");
+
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -2,6 +2,7 @@
 #define TOKEN_DEFS_HPP
 
 #include <array>
+#include <cstdint>
 #include <string_view>
 
 namespace syntax {
@@ -9,7 +10,7 @@ namespace syntax {
      * @enum TokenType
      * @brief types of the tokens defined by the compiler
     */
-    enum class TokenType{
+    enum class TokenType : uint8_t {
         /// identifiers and literals
         ID,           //< identifier (variables, function names etc.) 
         LITERAL,      //< numeric literals
@@ -86,7 +87,7 @@ namespace syntax {
      * @enum GeneralTokenType
      * @brief general types of the tokens
     */
-    enum class GeneralTokenType { 
+    enum class GeneralTokenType : uint8_t { 
         VALUE,      //< identifiers and literals
         OPERATOR,   //< all operators
         TYPE,       //< type keywords
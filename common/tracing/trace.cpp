@@ -0,0 +1,219 @@
+#include "trace.hpp"
+
+#ifdef MINICPP_TRACING
+
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+    /**
+     * @struct Event
+     * @brief recorded event
+    */
+    struct Event {
+        /// name of the event
+        std::string_view name;
+
+        /// category of the event
+        std::string_view category;
+
+        /// interned name of the function or library the event works on
+        util::text::SymbolId subject;
+
+        /// estimated cost of the subject, 0 for none
+        size_t cost;
+
+        /// start of the event
+        util::tracing::Clock::time_point begin;
+
+        /// end of the event
+        util::tracing::Clock::time_point end;
+
+        /// time the enclosing task was queued at, epoch of the clock when it was not measured
+        util::tracing::Clock::time_point queued;
+
+        /// time the enclosing task started at
+        util::tracing::Clock::time_point taskBegin;
+    };
+
+    /**
+     * @struct ThreadBuffer
+     * @brief events of a single thread
+    */
+    struct ThreadBuffer {
+        /// id of the thread in the trace
+        size_t tid;
+
+        /// name of the thread
+        std::string name;
+
+        /// events in the order they ended
+        std::vector<Event> events;
+    };
+
+    /// flag if the events are recorded
+    std::atomic<bool> recording{ false };
+
+    /// start of the trace, times of the events are relative to it
+    util::tracing::Clock::time_point epoch;
+
+    /// mutex for the buffers
+    std::mutex buffersMtx;
+
+    /// buffers of every thread that recorded an event, they outlive their threads
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    /// number of the written traces, buffer of an earlier trace is not used anymore
+    std::atomic<size_t> generation{ 0 };
+
+    /// buffer of the calling thread
+    thread_local ThreadBuffer* threadBuffer{ nullptr };
+
+    /// trace the buffer of the calling thread belongs to
+    thread_local size_t threadGeneration{ 0 };
+
+    /// time the task running on the calling thread was queued at
+    thread_local util::tracing::Clock::time_point taskQueued{};
+
+    /// time the task running on the calling thread started at
+    thread_local util::tracing::Clock::time_point taskBegin{};
+
+    /**
+     * @brief getter for the buffer of the calling thread, registers it on the first use
+     * @returns reference to the buffer of the calling thread
+    */
+    ThreadBuffer& localBuffer(){
+        if(!threadBuffer || threadGeneration != generation.load(std::memory_order_relaxed)){
+            std::lock_guard<std::mutex> lock(buffersMtx);
+            threadGeneration = generation.load(std::memory_order_relaxed);
+            buffers.push_back(std::make_unique<ThreadBuffer>(buffers.size(), std::format("thread {}", buffers.size())));
+            threadBuffer = buffers.back().get();
+        }
+        return *threadBuffer;
+    }
+
+    /**
+     * @brief converts the time into microseconds since the start of the trace
+     * @param time - converted time
+     * @returns microseconds since the start of the trace
+    */
+    double sinceEpoch(util::tracing::Clock::time_point time) noexcept {
+        return std::chrono::duration<double, std::micro>{ time - epoch }.count();
+    }
+
+    /**
+     * @brief converts the duration into microseconds
+     * @param duration - converted duration
+     * @returns duration in microseconds
+    */
+    double toMicroseconds(util::tracing::Clock::duration duration) noexcept {
+        return std::chrono::duration<double, std::micro>{ duration }.count();
+    }
+}
+
+bool util::tracing::start(){
+    epoch = Clock::now();
+    recording.store(true, std::memory_order_release);
+    localBuffer().name = "main";
+    return true;
+}
+
+bool util::tracing::enabled() noexcept {
+    return recording.load(std::memory_order_relaxed);
+}
+
+bool util::tracing::write(const std::string& path){
+    recording.store(false, std::memory_order_relaxed);
+
+    std::ofstream out{ path };
+    if(!out.is_open()){
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffersMtx);
+    const auto pid{ getpid() };
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    bool first{ true };
+    for(const auto& buffer : buffers){
+        out << std::format(
+            "{}\n{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": {}, \"tid\": {}, \"args\": {{\"name\": \"{}\"}}}}",
+            first ? "" : ",", pid, buffer->tid, buffer->name
+        );
+        first = false;
+
+        for(const auto& event : buffer->events){
+            out << std::format(
+                ",\n{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"pid\": {}, \"tid\": {}, \"ts\": {:.3f}, \"dur\": {:.3f}, \"args\": {{",
+                event.name, event.category, pid, buffer->tid, sinceEpoch(event.begin), toMicroseconds(event.end - event.begin)
+            );
+
+            std::string_view separator{ "" };
+            if(event.subject != util::text::StringInterner::emptyId){
+                out << std::format("\"subject\": \"{}\"", util::text::StringInterner::name(event.subject));
+                separator = ", ";
+            }
+            if(event.cost != 0){
+                out << std::format("{}\"cost\": {}", separator, event.cost);
+                separator = ", ";
+            }
+            if(event.queued != Clock::time_point{}){
+                // work done by the task before the event is not waiting
+                out << std::format("{}\"queue_wait_us\": {:.3f}", separator, toMicroseconds(event.taskBegin - event.queued));
+            }
+            out << "}}";
+        }
+    }
+    out << "\n]}\n";
+
+    buffers.clear();
+    generation.fetch_add(1, std::memory_order_relaxed);
+    return out.good();
+}
+
+void util::tracing::setThreadName(std::string_view name, size_t index){
+    if(enabled()){
+        localBuffer().name = std::format("{} {}", name, index);
+    }
+}
+
+util::tracing::Clock::time_point util::tracing::queuedAt() noexcept {
+    return enabled() ? Clock::now() : Clock::time_point{};
+}
+
+util::tracing::Scope::Scope(std::string_view name, std::string_view category, util::text::SymbolId subject, size_t cost) noexcept
+    : name{ name }, category{ category }, subject{ subject }, cost{ cost }, recorded{ enabled() } {
+    if(recorded){
+        begin = Clock::now();
+    }
+}
+
+util::tracing::Scope::~Scope(){
+    if(recorded){
+        localBuffer().events.push_back(Event{ name, category, subject, cost, begin, Clock::now(), taskQueued, taskBegin });
+    }
+}
+
+util::tracing::TaskScope::TaskScope(Clock::time_point queued) noexcept
+    : enclosing{ std::exchange(taskQueued, queued) }, recorded{ enabled() } {
+    if(recorded){
+        begin = Clock::now();
+    }
+    enclosingBegin = std::exchange(taskBegin, begin);
+}
+
+util::tracing::TaskScope::~TaskScope(){
+    if(recorded){
+        localBuffer().events.push_back(Event{ "task", "pool", util::text::StringInterner::emptyId, 0, begin, Clock::now(), taskQueued, begin });
+    }
+    taskQueued = enclosing;
+    taskBegin = enclosingBegin;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../symbol/string_interner.hpp"
+
+/**
+ * @namespace util::tracing
+ * @brief module for recording the passes and the tasks of the compiler as chrome trace events
+ * @details every thread records its events into a buffer of its own, without locking,
+ * buffers outlive their threads and are merged only when the trace is written,
+ * without MINICPP_TRACING defined every recording function is an empty inline function
+*/
+namespace util::tracing {
+    /// clock the events are timed by
+    using Clock = std::chrono::steady_clock;
+
+#ifdef MINICPP_TRACING
+    /// flag if the tracing is compiled in
+    inline constexpr bool compiledIn{ true };
+
+    /**
+     * @brief starts recording the events, the calling thread is named main
+     * @returns true if the events are recorded, false if the tracing is compiled out
+    */
+    bool start();
+
+    /**
+     * @brief checks if the events are recorded
+     * @returns true if the tracing is started, false otherwise
+     * @note thread-safe
+    */
+    bool enabled() noexcept;
+
+    /**
+     * @brief stops recording and writes the recorded events as chrome trace event json
+     * @param path - path of the written file
+     * @returns true if the file is written, false otherwise
+     * @note threads that recorded the events must not record anymore
+    */
+    bool write(const std::string& path);
+
+    /**
+     * @brief names the calling thread in the trace
+     * @param name - name of the thread
+     * @param index - index appended to the name
+    */
+    void setThreadName(std::string_view name, size_t index);
+
+    /**
+     * @brief getter for the time the task is queued at
+     * @returns current time if the events are recorded, epoch of the clock otherwise
+    */
+    Clock::time_point queuedAt() noexcept;
+
+    /**
+     * @class Scope
+     * @brief records the event lasting from its creation until its destruction
+    */
+    class Scope {
+    public:
+        /**
+         * @brief starts the event
+         * @param name - name of the event, has to outlive the trace
+         * @param category - category of the event, has to outlive the trace
+         * @param subject - interned name of the function or library the event works on, emptyId for none
+         * @param cost - estimated cost of the subject, 0 for none
+        */
+        Scope(std::string_view name, std::string_view category, util::text::SymbolId subject = util::text::StringInterner::emptyId, size_t cost = 0) noexcept;
+
+        /**
+         * @brief records the event
+        */
+        ~Scope();
+
+        /// deleted copy constructor
+        Scope(const Scope&) = delete;
+
+        /// deleted assignment operator
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        /// name of the event
+        std::string_view name;
+
+        /// category of the event
+        std::string_view category;
+
+        /// interned name of the function or library the event works on
+        util::text::SymbolId subject;
+
+        /// estimated cost of the subject
+        size_t cost;
+
+        /// flag if the event is recorded
+        bool recorded;
+
+        /// start of the event
+        Clock::time_point begin;
+
+    };
+
+    /**
+     * @class TaskScope
+     * @brief records the pool task, events inside of it carry the time the task waited in the queue
+    */
+    class TaskScope {
+    public:
+        /**
+         * @brief starts the task
+         * @param queued - time the task was queued at, epoch of the clock when it was not measured
+        */
+        explicit TaskScope(Clock::time_point queued) noexcept;
+
+        /**
+         * @brief records the task, events of the enclosing task carry its queue and start time again
+        */
+        ~TaskScope();
+
+        /// deleted copy constructor
+        TaskScope(const TaskScope&) = delete;
+
+        /// deleted assignment operator
+        TaskScope& operator=(const TaskScope&) = delete;
+
+    private:
+        /// queue time of the enclosing task
+        Clock::time_point enclosing;
+
+        /// flag if the task is recorded
+        bool recorded;
+
+        /// start of the task
+        Clock::time_point begin;
+
+        /// start of the enclosing task
+        Clock::time_point enclosingBegin;
+
+    };
+#else
+    /// flag if the tracing is compiled in
+    inline constexpr bool compiledIn{ false };
+
+    /// events are never recorded
+    inline bool start(){ return false; }
+
+    /// events are never recorded
+    constexpr bool enabled() noexcept { return false; }
+
+    /// there are no events to write
+    inline bool write(const std::string&){ return false; }
+
+    /// threads are not named
+    inline void setThreadName(std::string_view, size_t){}
+
+    /// time of the queued task is not measured
+    inline Clock::time_point queuedAt() noexcept { return {}; }
+
+    /**
+     * @class Scope
+     * @brief empty event, the tracing is compiled out
+    */
+    class Scope {
+    public:
+        /// records nothing
+        constexpr Scope(std::string_view, std::string_view, util::text::SymbolId = util::text::StringInterner::emptyId, size_t = 0) noexcept {}
+    };
+
+    /**
+     * @class TaskScope
+     * @brief empty task, the tracing is compiled out
+    */
+    class TaskScope {
+    public:
+        /// records nothing
+        constexpr explicit TaskScope(Clock::time_point) noexcept {}
+    };
+#endif
+
+}
+
+#endif
\ No newline at end of file
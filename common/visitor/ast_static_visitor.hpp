@@ -0,0 +1,154 @@
+#ifndef AST_STATIC_VISITOR_HPP
+#define AST_STATIC_VISITOR_HPP
+
+#include <memory>
+#include <utility>
+
+#include "../abstract-syntax-tree/ast_program.hpp"
+#include "../abstract-syntax-tree/ast_include_dir.hpp"
+#include "../abstract-syntax-tree/ast_function.hpp"
+#include "../abstract-syntax-tree/ast_parameter.hpp"
+#include "../abstract-syntax-tree/ast_variable_decl_stmt.hpp"
+#include "../abstract-syntax-tree/ast_assign_stmt.hpp"
+#include "../abstract-syntax-tree/ast_compound_stmt.hpp"
+#include "../abstract-syntax-tree/ast_for_stmt.hpp"
+#include "../abstract-syntax-tree/ast_function_call_stmt.hpp"
+#include "../abstract-syntax-tree/ast_if_stmt.hpp"
+#include "../abstract-syntax-tree/ast_return_stmt.hpp"
+#include "../abstract-syntax-tree/ast_while_stmt.hpp"
+#include "../abstract-syntax-tree/ast_dowhile_stmt.hpp"
+#include "../abstract-syntax-tree/ast_switch_stmt.hpp"
+#include "../abstract-syntax-tree/ast_case_stmt.hpp"
+#include "../abstract-syntax-tree/ast_default_stmt.hpp"
+#include "../abstract-syntax-tree/ast_switch_block_stmt.hpp"
+#include "../abstract-syntax-tree/ast_binary_expr.hpp"
+#include "../abstract-syntax-tree/ast_function_call_expr.hpp"
+#include "../abstract-syntax-tree/ast_id_expr.hpp"
+#include "../abstract-syntax-tree/ast_literal_expr.hpp"
+
+namespace syntax::ast {
+    /**
+     * @class ASTStaticVisitor
+     * @brief statically dispatched ast traversal for the hot passes
+     * @tparam Derived - visitor deriving from this class, defines visit for every node class
+     * @details node is dispatched by a switch on its node type instead of the virtual accept,
+     * visit methods of the derived visitor are not virtual and can be inlined into the traversal
+    */
+    template<typename Derived>
+    class ASTStaticVisitor {
+    public:
+        /// deleted copy constructor
+        ASTStaticVisitor(const ASTStaticVisitor&) = delete;
+
+        /// deleted copy assignment operator
+        ASTStaticVisitor& operator=(const ASTStaticVisitor&) = delete;
+
+        /// deleted move constructor
+        ASTStaticVisitor(ASTStaticVisitor&&) noexcept = delete;
+
+        /// deleted move assignment operator
+        ASTStaticVisitor& operator=(ASTStaticVisitor&&) noexcept = delete;
+
+        /**
+         * @brief visits the node
+         * @param node - pointer to the node
+         * @details node of a concrete class is visited directly, node of an abstract class is dispatched on its type
+        */
+        template<typename Node>
+        void visitNode(Node* node){
+            if constexpr(requires(Derived& visitor){ visitor.visit(node); }){
+                derived().visit(node);
+            }
+            else {
+                dispatch(node);
+            }
+        }
+
+        /**
+         * @brief visits the node owned by the handle
+         * @param node - handle of the node
+        */
+        template<typename Node, typename Deleter>
+        void visitNode(const std::unique_ptr<Node, Deleter>& node){
+            visitNode(node.get());
+        }
+
+    protected:
+        /**
+         * @brief default constructor
+        */
+        ASTStaticVisitor() = default;
+
+        /**
+         * @brief default destructor, visitor is never destroyed through the base
+        */
+        ~ASTStaticVisitor() = default;
+
+    private:
+        /**
+         * @brief getter for the derived visitor
+         * @returns reference to the derived visitor
+        */
+        Derived& derived() noexcept {
+            return static_cast<Derived&>(*this);
+        }
+
+        /**
+         * @brief dispatches the node to the visit of its concrete class
+         * @param node - pointer to the node
+        */
+        void dispatch(ASTNode* node){
+            switch(node->getNodeType()){
+                case ASTNodeType::PROGRAM:
+                    return derived().visit(static_cast<ASTProgram*>(node));
+                case ASTNodeType::FUNCTION:
+                    return derived().visit(static_cast<ASTFunction*>(node));
+                case ASTNodeType::PARAMETER:
+                    return derived().visit(static_cast<ASTParameter*>(node));
+                case ASTNodeType::INCLUDE_DIR:
+                    return derived().visit(static_cast<ASTIncludeDir*>(node));
+                case ASTNodeType::VARIABLE_DECL_STMT:
+                    return derived().visit(static_cast<ASTVariableDeclStmt*>(node));
+                case ASTNodeType::COMPOUND_STMT:
+                    return derived().visit(static_cast<ASTCompoundStmt*>(node));
+                case ASTNodeType::ASSIGN_STMT:
+                    return derived().visit(static_cast<ASTAssignStmt*>(node));
+                case ASTNodeType::RETURN_STMT:
+                    return derived().visit(static_cast<ASTReturnStmt*>(node));
+                case ASTNodeType::FUNCTION_CALL_STMT:
+                    return derived().visit(static_cast<ASTFunctionCallStmt*>(node));
+                case ASTNodeType::IF_STMT:
+                    return derived().visit(static_cast<ASTIfStmt*>(node));
+                case ASTNodeType::WHILE_STMT:
+                    return derived().visit(static_cast<ASTWhileStmt*>(node));
+                case ASTNodeType::FOR_STMT:
+                    return derived().visit(static_cast<ASTForStmt*>(node));
+                case ASTNodeType::DOWHILE_STMT:
+                    return derived().visit(static_cast<ASTDoWhileStmt*>(node));
+                case ASTNodeType::SWITCH_STMT:
+                    return derived().visit(static_cast<ASTSwitchStmt*>(node));
+                case ASTNodeType::CASE_STMT:
+                    return derived().visit(static_cast<ASTCaseStmt*>(node));
+                case ASTNodeType::DEFAULT_STMT:
+                    return derived().visit(static_cast<ASTDefaultStmt*>(node));
+                case ASTNodeType::SWITCH_BLOCK_STMT:
+                    return derived().visit(static_cast<ASTSwitchBlockStmt*>(node));
+                case ASTNodeType::BINARY_EXPR:
+                    return derived().visit(static_cast<ASTBinaryExpr*>(node));
+                case ASTNodeType::FUNCTION_CALL_EXPR:
+                    return derived().visit(static_cast<ASTFunctionCallExpr*>(node));
+                case ASTNodeType::LITERAL_EXPR:
+                    return derived().visit(static_cast<ASTLiteralExpr*>(node));
+                case ASTNodeType::ID_EXPR:
+                    return derived().visit(static_cast<ASTIdExpr*>(node));
+                default:
+                    // abstract node types and break are never instantiated
+                    std::unreachable();
+            }
+        }
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef IR_STATIC_VISITOR_HPP
+#define IR_STATIC_VISITOR_HPP
+
+#include <memory>
+#include <utility>
+
+#include "../intermediate-representation-tree/ir_program.hpp"
+#include "../intermediate-representation-tree/ir_function.hpp"
+#include "../intermediate-representation-tree/ir_parameter.hpp"
+#include "../intermediate-representation-tree/ir_variable_decl_stmt.hpp"
+#include "../intermediate-representation-tree/ir_assign_stmt.hpp"
+#include "../intermediate-representation-tree/ir_compound_stmt.hpp"
+#include "../intermediate-representation-tree/ir_for_stmt.hpp"
+#include "../intermediate-representation-tree/ir_function_call_stmt.hpp"
+#include "../intermediate-representation-tree/ir_if_stmt.hpp"
+#include "../intermediate-representation-tree/ir_return_stmt.hpp"
+#include "../intermediate-representation-tree/ir_while_stmt.hpp"
+#include "../intermediate-representation-tree/ir_dowhile_stmt.hpp"
+#include "../intermediate-representation-tree/ir_switch_stmt.hpp"
+#include "../intermediate-representation-tree/ir_case_stmt.hpp"
+#include "../intermediate-representation-tree/ir_default_stmt.hpp"
+#include "../intermediate-representation-tree/ir_switch_block_stmt.hpp"
+#include "../intermediate-representation-tree/ir_binary_expr.hpp"
+#include "../intermediate-representation-tree/ir_function_call_expr.hpp"
+#include "../intermediate-representation-tree/ir_id_expr.hpp"
+#include "../intermediate-representation-tree/ir_literal_expr.hpp"
+#include "../intermediate-representation-tree/ir_temporary_expr.hpp"
+
+namespace ir {
+    /**
+     * @class IRStaticVisitor
+     * @brief statically dispatched ir traversal for the hot passes
+     * @tparam Derived - visitor deriving from this class, defines visit for every node class
+     * @details node is dispatched by a switch on its node type instead of the virtual accept,
+     * visit methods of the derived visitor are not virtual and can be inlined into the traversal
+    */
+    template<typename Derived>
+    class IRStaticVisitor {
+    public:
+        /// deleted copy constructor
+        IRStaticVisitor(const IRStaticVisitor&) = delete;
+
+        /// deleted copy assignment operator
+        IRStaticVisitor& operator=(const IRStaticVisitor&) = delete;
+
+        /// deleted move constructor
+        IRStaticVisitor(IRStaticVisitor&&) noexcept = delete;
+
+        /// deleted move assignment operator
+        IRStaticVisitor& operator=(IRStaticVisitor&&) noexcept = delete;
+
+        /**
+         * @brief visits the node
+         * @param node - pointer to the node
+         * @details node of a concrete class is visited directly, node of an abstract class is dispatched on its type
+        */
+        template<typename Node>
+        void visitNode(Node* node){
+            if constexpr(requires(Derived& visitor){ visitor.visit(node); }){
+                derived().visit(node);
+            }
+            else {
+                dispatch(node);
+            }
+        }
+
+        /**
+         * @brief visits the node owned by the handle
+         * @param node - handle of the node
+        */
+        template<typename Node, typename Deleter>
+        void visitNode(const std::unique_ptr<Node, Deleter>& node){
+            visitNode(node.get());
+        }
+
+    protected:
+        /**
+         * @brief default constructor
+        */
+        IRStaticVisitor() = default;
+
+        /**
+         * @brief default destructor, visitor is never destroyed through the base
+        */
+        ~IRStaticVisitor() = default;
+
+    private:
+        /**
+         * @brief getter for the derived visitor
+         * @returns reference to the derived visitor
+        */
+        Derived& derived() noexcept {
+            return static_cast<Derived&>(*this);
+        }
+
+        /**
+         * @brief dispatches the node to the visit of its concrete class
+         * @param node - pointer to the node
+        */
+        void dispatch(IRNode* node){
+            switch(node->getNodeType()){
+                case IRNodeType::PROGRAM:
+                    return derived().visit(static_cast<IRProgram*>(node));
+                case IRNodeType::FUNCTION:
+                    return derived().visit(static_cast<IRFunction*>(node));
+                case IRNodeType::PARAMETER:
+                    return derived().visit(static_cast<IRParameter*>(node));
+                case IRNodeType::VARIABLE:
+                    return derived().visit(static_cast<IRVariableDeclStmt*>(node));
+                case IRNodeType::IF:
+                    return derived().visit(static_cast<IRIfStmt*>(node));
+                case IRNodeType::WHILE:
+                    return derived().visit(static_cast<IRWhileStmt*>(node));
+                case IRNodeType::DO_WHILE:
+                    return derived().visit(static_cast<IRDoWhileStmt*>(node));
+                case IRNodeType::FOR:
+                    return derived().visit(static_cast<IRForStmt*>(node));
+                case IRNodeType::COMPOUND:
+                    return derived().visit(static_cast<IRCompoundStmt*>(node));
+                case IRNodeType::ASSIGN:
+                    return derived().visit(static_cast<IRAssignStmt*>(node));
+                case IRNodeType::RETURN:
+                    return derived().visit(static_cast<IRReturnStmt*>(node));
+                case IRNodeType::CALL_STMT:
+                    return derived().visit(static_cast<IRFunctionCallStmt*>(node));
+                case IRNodeType::SWITCH:
+                    return derived().visit(static_cast<IRSwitchStmt*>(node));
+                case IRNodeType::CASE:
+                    return derived().visit(static_cast<IRCaseStmt*>(node));
+                case IRNodeType::SWITCH_BLOCK:
+                    return derived().visit(static_cast<IRSwitchBlockStmt*>(node));
+                case IRNodeType::DEFAULT:
+                    return derived().visit(static_cast<IRDefaultStmt*>(node));
+                case IRNodeType::TEMPORARY:
+                    return derived().visit(static_cast<IRTemporaryExpr*>(node));
+                case IRNodeType::CALL:
+                    return derived().visit(static_cast<IRFunctionCallExpr*>(node));
+                case IRNodeType::ID:
+                    return derived().visit(static_cast<IRIdExpr*>(node));
+                case IRNodeType::LITERAL:
+                    return derived().visit(static_cast<IRLiteralExpr*>(node));
+                // binary expression is typed by its operation
+                case IRNodeType::ADD:
+                case IRNodeType::SUB:
+                case IRNodeType::MUL:
+                case IRNodeType::DIV:
+                case IRNodeType::AND:
+                case IRNodeType::OR:
+                case IRNodeType::XOR:
+                case IRNodeType::SHL:
+                case IRNodeType::SAL:
+                case IRNodeType::SHR:
+                case IRNodeType::SAR:
+                case IRNodeType::ANDL:
+                case IRNodeType::ORL:
+                case IRNodeType::CMP:
+                case IRNodeType::JG:
+                case IRNodeType::JA:
+                case IRNodeType::JL:
+                case IRNodeType::JB:
+                case IRNodeType::JGE:
+                case IRNodeType::JAE:
+                case IRNodeType::JLE:
+                case IRNodeType::JBE:
+                case IRNodeType::JE:
+                case IRNodeType::JNE:
+                    return derived().visit(static_cast<IRBinaryExpr*>(node));
+                default:
+                    // argument, break and none are never instantiated
+                    std::unreachable();
+            }
+        }
+
+    };
+
+}
+
+#endif
@@ -1,9 +1,13 @@
 #include "compiler.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cstring>
 #include <format>
 #include <cassert>
+#include <optional>
 #include <stdexcept>
+#include <thread>
 #include <filesystem>
 #include <fstream>
 #include <spawn.h>
@@ -11,14 +15,17 @@
 #include <unistd.h>
 
 #include "../preprocessor/preprocessor.hpp"
+#include "../common/preprocessing/preprocessing_libs.hpp"
 #include "../lexer/lexer.hpp"
 #include "../parser/parser.hpp"
+#include "../parser/parallel_parser.hpp"
 #include "../symbol-handling/scope-manager/scope_manager.hpp"
 #include "../analyzer/analyzer.hpp"
 #include "../intermediate-representation/intermediate_representation.hpp"
 #include "../code-generator/code-generator/code_generator.hpp"
 #include "../common/dump/ast_dumper.hpp"
 #include "../common/dump/ir_dumper.hpp"
+#include "../thread-pool/task_group.hpp"
 
 extern "C" {
     extern char** environ;
@@ -41,9 +48,58 @@ compiler::CompileOptions compiler::parseOptions(int argc, char** argv){
             }
             options.output = argv[++i];
         }
+        else if(arg == "--stream-tokens"){
+            options.streamTokens = true;
+        }
+        else if(arg == "--emit-interface"){
+            options.emitInterface = true;
+        }
         else if(arg == "-s"){
             options.stopAfterAssembly = true;
         }
+        else if(arg == "--pin-threads"){
+            options.pinThreads = true;
+        }
+        else if(arg.starts_with("-j")){
+            // both "-j N" and "-jN" forms are accepted
+            std::string_view jobs{ arg };
+            jobs.remove_prefix(2);
+            if(jobs.empty()){
+                if(i + 1 >= argc){
+                    throw std::runtime_error("-j requires argument");
+                }
+                jobs = argv[++i];
+            }
+
+            const auto [end, error]{ std::from_chars(jobs.data(), jobs.data() + jobs.size(), options.jobs) };
+            if(error != std::errc{} || end != jobs.data() + jobs.size() || options.jobs == 0){
+                throw std::runtime_error(std::format("Invalid number of jobs: {}", jobs));
+            }
+        }
+        else if(arg == "--time-passes"){
+            options.timePasses = util::timing::ReportFormat::TABLE;
+        }
+        else if(arg == "--time-passes=json"){
+            options.timePasses = util::timing::ReportFormat::JSON;
+        }
+        else if(arg.starts_with("--trace=")){
+            if(!util::tracing::compiledIn){
+                throw std::runtime_error("--trace requires the compiler built with TRACING=1");
+            }
+            options.tracePath = arg.substr(std::strlen("--trace="));
+            if(options.tracePath.empty()){
+                throw std::runtime_error("--trace requires path");
+            }
+        }
+        else if(arg.starts_with("-fmax-errors=")){
+            std::string_view maxErrors{ arg };
+            maxErrors.remove_prefix(std::strlen("-fmax-errors="));
+
+            const auto [end, error]{ std::from_chars(maxErrors.data(), maxErrors.data() + maxErrors.size(), options.maxErrors) };
+            if(error != std::errc{} || end != maxErrors.data() + maxErrors.size() || maxErrors.empty()){
+                throw std::runtime_error(std::format("Invalid number of errors: {}", maxErrors));
+            }
+        }
         else if (arg.starts_with("-")){
             throw std::runtime_error(std::format("Unknown compiler flag: {}", arg));
         }
@@ -66,40 +122,29 @@ compiler::CompileOptions compiler::parseOptions(int argc, char** argv){
     return options;
 }
 
-std::string compiler::readSourceCode(const std::string& input){
-    std::ifstream inputStream{ input };
+util::io::MappedFile compiler::readSourceCode(const std::string& input){
+    util::io::MappedFile sourceCode{ input };
 
-    if(!inputStream.is_open()){
+    if(!sourceCode.isOpen()){
         throw std::runtime_error(std::format("Failed to open file '{}'", input));
     }
 
-    std::stringstream sourceCode;
-    sourceCode << inputStream.rdbuf();
-    inputStream.close();
-
-    return sourceCode.str();
+    return sourceCode;
 }
 
-const compiler::PreprocessResult compiler::preprocess(const std::string& source) {
-    preprocessing::Preprocessor preprocessor;
-    preprocessor.preprocess(source);
+compiler::ExitCode compiler::lexicalAnalysis(
+    lex::Lexer& lexer, 
+    const preprocessing::Preprocessor& preprocessor, 
+    util::concurrency::ThreadPool& threadPool
+){
+    lexer.tokenize(threadPool);
 
-    bool isInvalid{ preprocessor.hasErrors() };
-    if(isInvalid){
+    // libraries that failed to load take priority, same as when they were loaded before lexing
+    if(preprocessor.hasErrors()){
         std::cerr << preprocessor.getPreprocessErrors();
+        return compiler::ExitCode::PREPROCESS_ERR;
     }
     
-    return {
-        .exitCode = isInvalid 
-            ? compiler::ExitCode::PREPROCESS_ERR 
-            : compiler::ExitCode::NO_ERR,
-        .source = preprocessor.getPreprocessed()
-    };
-}
-
-compiler::ExitCode compiler::lexicalAnalysis(lex::Lexer& lexer){
-    lexer.tokenize();
-    
     if(lexer.hasErrors()){
         std::cerr << lexer.getErrors();
         return compiler::ExitCode::LEXICAL_ERR;
@@ -109,11 +154,14 @@ compiler::ExitCode compiler::lexicalAnalysis(lex::Lexer& lexer){
 }
 
 compiler::ExitCode 
-compiler::syntaxAnalysis(lex::Lexer& lexer, std::unique_ptr<syntax::ast::ASTProgram>& astProgram){
+compiler::syntaxAnalysis(
+    lex::Lexer& lexer, 
+    std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
+    util::concurrency::ThreadPool& threadPool
+){
     try{
         assert(lexer.completedTokenization());
-        syntax::TokenConsumer tokenConsumer{ lexer };
-        syntax::Parser parser{ tokenConsumer };
+        syntax::ParallelParser parser{ lexer, threadPool };
         astProgram = parser.parseProgram();
     }
     catch(std::exception& e){
@@ -124,55 +172,191 @@ compiler::syntaxAnalysis(lex::Lexer& lexer, std::unique_ptr<syntax::ast::ASTProg
     return compiler::ExitCode::NO_ERR;
 }
 
-compiler::ExitCode compiler::semanticAnalysis(
+compiler::ExitCode compiler::pipelinedAnalysis(
+    lex::Lexer& lexer, 
+    const preprocessing::Preprocessor& preprocessor, 
     std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
     util::concurrency::ThreadPool& threadPool
 ){
-    semantic::SymbolTable symbolTable {};
-    semantic::ScopeManager scopeManager{ symbolTable };
-    semantic::Analyzer analyzer{scopeManager, threadPool};
-    astProgram->accept(analyzer);
+    std::optional<std::string> syntaxError;
 
-    if(analyzer.hasSemanticErrors(astProgram.get())){
-        std::cerr << analyzer.getSemanticErrors(astProgram.get());
-        return compiler::ExitCode::SEMANTIC_ERR;
+    lexer.startStreaming(threadPool);
+    try{
+        syntax::TokenConsumer tokenConsumer{ lexer };
+        syntax::Parser parser{ tokenConsumer };
+        astProgram = parser.parseProgram();
+    }
+    catch(std::exception& e){
+        syntaxError = e.what();
+    }
+    lexer.finishStreaming();
+
+    if(preprocessor.hasErrors()){
+        std::cerr << preprocessor.getPreprocessErrors();
+        return compiler::ExitCode::PREPROCESS_ERR;
     }
 
+    // lexical errors take priority, same as when lexer runs to completion before parsing
+    if(lexer.hasErrors()){
+        std::cerr << lexer.getErrors();
+        return compiler::ExitCode::LEXICAL_ERR;
+    }
+
+    if(syntaxError){
+        std::cerr << std::format("Syntax check: failed!\n{}\n", *syntaxError);
+        return compiler::ExitCode::SYNTAX_ERR;
+    }
+
+    // streamed libraries follow the source, functions are put in the order they have without streaming
+    astProgram->orderBySource(lexer.getSourceOrder());
+
     return compiler::ExitCode::NO_ERR;
 }
 
-compiler::ExitCode compiler::transformASTToIRT(
+bool compiler::shouldStreamTokens(std::string_view source) noexcept {
+    // below this size the whole token vector is small and lexing is too short to overlap with parsing,
+    // libraries are not known before lexing, they are small compared to the threshold anyway
+    constexpr size_t streamingThreshold{ 16 * 1024 * 1024 };
+
+    // with a single core lexer and parser would only take turns on it
+    return source.size() >= streamingThreshold && std::thread::hardware_concurrency() > 1;
+}
+
+size_t compiler::chooseJobs(std::string_view source) noexcept {
+    // below this much source per thread the threads cost more than they save, tiny inputs compile serially
+    constexpr size_t bytesPerJob{ 64 * 1024 };
+
+    const size_t cores{ std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+    return std::clamp<size_t>(source.size() / bytesPerJob, 1, cores);
+}
+
+void compiler::declareLibraries(
     std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
-    std::unique_ptr<ir::IRProgram>& irProgram, 
-    util::concurrency::ThreadPool& threadPool
+    const preprocessing::Preprocessor& preprocessor
 ){
-        ir::IntermediateRepresentation intermediateRepresentation{threadPool};
-        irProgram = intermediateRepresentation.transformProgram(astProgram.get());
-
-        if(intermediateRepresentation.hasErrors(irProgram.get())){
-            std::cerr << intermediateRepresentation.getErrors(irProgram.get());
-            return compiler::ExitCode::IR_ERR;
-        }
+    const auto interfaces{ preprocessor.getInterfaces() };
+    if(interfaces.empty()){
+        return;
+    }
 
-        return compiler::ExitCode::NO_ERR;
+    std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>> declarations;
+    for(const auto* interface : interfaces){
+        interface->declare(astProgram->getArena(), declarations);
+    }
+    astProgram->addDeclarations(std::move(declarations));
 }
 
-compiler::ExitCode compiler::generateProgram(
-    const ir::IRProgram* irProgram, 
-    std::string_view output, 
-    util::concurrency::ThreadPool& threadPool
+compiler::ExitCode compiler::translateProgram(
+    std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
+    std::unique_ptr<ir::IRProgram>& irProgram, 
+    const compiler::CompileOptions& options,
+    util::concurrency::ThreadPool& threadPool,
+    util::timing::PassTimer* timer
 ){
-    std::string outputFilePath{ std::format("{}.s", output) };
+    // shared by every function, functions past the first ones reaching the error limit are stopped
+    util::concurrency::CancellationToken cancellation{ options.maxErrors, astProgram->getFunctionCount() };
+    // ir errors are reported only without semantic errors, so they have an error limit of their own
+    util::concurrency::CancellationToken lowering{ options.maxErrors, astProgram->getFunctionCount() };
+    auto reportLimit{
+        [&options](const util::concurrency::CancellationToken& token) -> void {
+            if(options.maxErrors != 0 && token.getReportedErrors() >= options.maxErrors){
+                std::cerr << std::format("compilation terminated due to -fmax-errors={}.\n", options.maxErrors);
+            }
+        }
+    };
+
+    semantic::FunctionTable functionTable{};
+    semantic::Analyzer analyzer{functionTable, threadPool, &cancellation};
+    bool declared;
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::SEMANTIC_ANALYSIS };
+        declared = analyzer.declareFunctions(astProgram.get());
+    }
+    if(!declared){
+        std::cerr << analyzer.getSemanticErrors(astProgram.get());
+        reportLimit(cancellation);
+        return compiler::ExitCode::SEMANTIC_ERR;
+    }
+
+    ir::IntermediateRepresentation intermediateRepresentation{threadPool, &lowering, timer};
+    irProgram = intermediateRepresentation.beginProgram(astProgram.get());
+
+    std::string outputFilePath{ std::format("{}.s", options.output) };
     code_gen::CodeGenerator codeGenerator{ outputFilePath, threadPool };
+    codeGenerator.beginProgram(irProgram.get());
+
+    // function with errors stops at its phase, the work done on the other functions is discarded with the output
+    std::optional<std::string> codeGenError;
     try{
-        codeGenerator.generateProgram(irProgram);
-        if(!codeGenerator.successful()){
-            std::cerr << std::format("Unable to open '{}'", outputFilePath);
-            return compiler::ExitCode::CODEGEN_ERR;
-        }
+        util::concurrency::parallelForByCost(threadPool, astProgram->getFunctionCount(),
+            [program=astProgram.get()](size_t i) -> size_t { return program->getFunctionAtN(i)->getCost(); },
+            [&, program=astProgram.get(), irProgram=irProgram.get()](size_t i) -> void {
+                const util::text::SymbolId function{ program->getFunctionAtN(i)->getSymbolId() };
+                const size_t cost{ program->getFunctionAtN(i)->getCost() };
+                bool checked;
+                {
+                    util::timing::PassGuard passGuard{ timer, util::timing::Pass::SEMANTIC_ANALYSIS, function, cost };
+                    checked = analyzer.checkFunctionAt(program, i);
+                }
+                // ir errors are not reported with semantic errors, lowering the rest of the program is wasted work
+                if(!checked || cancellation.getReportedErrors() > 0){
+                    return;
+                }
+                if(!intermediateRepresentation.transformFunctionAt(program, irProgram, i)){
+                    return;
+                }
+                // program with errors is not generated, function cut short by the error limit has no complete ir
+                if(lowering.isCancelled(i) || cancellation.getReportedErrors() > 0 || lowering.getReportedErrors() > 0){
+                    return;
+                }
+
+                try{
+                    util::timing::PassGuard passGuard{ timer, util::timing::Pass::FUNCTION_GENERATION, function, cost };
+                    codeGenerator.generateFunctionAt(irProgram, i);
+                }
+                catch(...){
+                    // code is not written anyway, the functions not yet generated are dropped
+                    cancellation.cancel();
+                    lowering.cancel();
+                    throw;
+                }
+            },
+            &cancellation
+        );
     }
     catch(std::exception& e){
-        std::cerr << std::format("\nCode Generation: failed\n{}\n", e.what());
+        codeGenError = e.what();
+    }
+
+    // errors are reported in phase order, same as when every phase finished before the next one
+    analyzer.checkEntryPoint();
+    if(analyzer.hasSemanticErrors(astProgram.get())){
+        std::cerr << analyzer.getSemanticErrors(astProgram.get());
+        reportLimit(cancellation);
+        return compiler::ExitCode::SEMANTIC_ERR;
+    }
+
+    if(intermediateRepresentation.hasErrors(irProgram.get())){
+        std::cerr << intermediateRepresentation.getErrors(irProgram.get());
+        reportLimit(lowering);
+        return compiler::ExitCode::IR_ERR;
+    }
+
+    if(codeGenError){
+        std::cerr << std::format("\nCode Generation: failed\n{}\n", *codeGenError);
+        return compiler::ExitCode::CODEGEN_ERR;
+    }
+
+    if(options.dumpIR){
+        dumpIR(irProgram.get());
+    }
+
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::WRITE_CODE };
+        codeGenerator.writeCode(irProgram.get());
+    }
+    if(!codeGenerator.successful()){
+        std::cerr << std::format("Unable to open '{}'", outputFilePath);
         return compiler::ExitCode::CODEGEN_ERR;
     }
 
@@ -220,66 +404,154 @@ compiler::ExitCode compiler::assembleAndLink(
 }
 
 compiler::ExitCode compiler::compile(compiler::CompileOptions options) {
-    std::string source{ readSourceCode(options.input) };
+    if(options.emitInterface){
+        return emitLibraryInterface(options.input);
+    }
 
-    compiler::PreprocessResult preprocessResult{ preprocess(source) };
-    if(preprocessResult.exitCode != compiler::ExitCode::NO_ERR){
-        return preprocessResult.exitCode;
+    std::optional<util::timing::PassTimer> timer;
+    if(options.timePasses){
+        timer.emplace();
+    }
+    if(!options.tracePath.empty()){
+        util::tracing::start();
     }
 
-    compiler::ExitCode result;
+    // worker threads are joined by now, every recorded event is complete
+    compiler::ExitCode result{ compileProgram(options, timer ? &*timer : nullptr) };
 
-    lex::Lexer lexer{ preprocessResult.source };
-    result = lexicalAnalysis(lexer);
-    if(result != compiler::ExitCode::NO_ERR){
-        return result;
+    if(timer){
+        timer->write(std::cerr, *options.timePasses);
     }
-    
-    std::unique_ptr<syntax::ast::ASTProgram> astProgram;
-    result = syntaxAnalysis(lexer, astProgram);
-    if(result != compiler::ExitCode::NO_ERR){
-        return result;
+    if(!options.tracePath.empty() && !util::tracing::write(options.tracePath)){
+        std::cerr << std::format("Unable to write trace '{}'\n", options.tracePath);
     }
 
-    if(options.dumpAST){
-        dumpAST(astProgram.get());
+    return result;
+}
+
+compiler::ExitCode compiler::compileProgram(const compiler::CompileOptions& options, util::timing::PassTimer* timer){
+    // mapping has to outlive every token and ast node, they view into it
+    util::io::MappedFile source;
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::READ_SOURCE };
+        source = readSourceCode(options.input);
     }
 
-    util::concurrency::ThreadPool threadPool{ std::thread::hardware_concurrency() };
+    compiler::ExitCode result;
 
-    result = semanticAnalysis(astProgram, threadPool);
-    if(result != compiler::ExitCode::NO_ERR){
-        return result;
+    // requested pipeline needs a thread for the lexer besides the one for the parser
+    size_t jobs{ options.jobs != 0 ? options.jobs : chooseJobs(source.view()) };
+    if(options.jobs == 0 && options.streamTokens){
+        jobs = std::max<size_t>(jobs, 2);
     }
 
-    std::unique_ptr<ir::IRProgram> irProgram;
-    result = transformASTToIRT(astProgram, irProgram, threadPool);
-    if(result != compiler::ExitCode::NO_ERR){
-        return result;
+    // calling thread works on the tasks as well, single job needs no worker thread at all
+    util::concurrency::ThreadPool threadPool{ jobs - 1, options.pinThreads };
+
+    // libraries are requested by the lexer, they have to outlive every token and ast node as well
+    preprocessing::Preprocessor preprocessor{ threadPool, timer };
+    lex::Lexer lexer{ source.view(), preprocessor };
+    std::unique_ptr<syntax::ast::ASTProgram> astProgram;
+
+    // lexer runs on a worker in the pipeline, serial compilation has none
+    if(threadPool.size() > 0 && (options.streamTokens || shouldStreamTokens(source.view()))){
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::SYNTAX_ANALYSIS };
+        result = pipelinedAnalysis(lexer, preprocessor, astProgram, threadPool);
+        if(result != compiler::ExitCode::NO_ERR){
+            return result;
+        }
     }
+    else {
+        {
+            util::timing::PassGuard passGuard{ timer, util::timing::Pass::LEXICAL_ANALYSIS };
+            result = lexicalAnalysis(lexer, preprocessor, threadPool);
+        }
+        if(result != compiler::ExitCode::NO_ERR){
+            return result;
+        }
 
-    if(options.dumpIR){
-        dumpIR(irProgram.get());
+        {
+            util::timing::PassGuard passGuard{ timer, util::timing::Pass::SYNTAX_ANALYSIS };
+            result = syntaxAnalysis(lexer, astProgram, threadPool);
+        }
+        if(result != compiler::ExitCode::NO_ERR){
+            return result;
+        }
+    }
+
+    declareLibraries(astProgram, preprocessor);
+
+    if(options.dumpAST){
+        dumpAST(astProgram.get());
     }
 
-    result = generateProgram(irProgram.get(), options.output, threadPool);
+    std::unique_ptr<ir::IRProgram> irProgram;
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::TRANSLATION };
+        result = translateProgram(astProgram, irProgram, options, threadPool, timer);
+    }
     if(result != compiler::ExitCode::NO_ERR){
         return result;
     }
     
     if(!options.stopAfterAssembly){
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::ASSEMBLE_AND_LINK };
         result = assembleAndLink(irProgram.get(), options.output);
     }
 
     return result;
 }
 
+compiler::ExitCode compiler::emitLibraryInterface(const std::string& input){
+    util::io::MappedFile source{ readSourceCode(input) };
+    const std::vector<std::string_view> files{ source.view() };
+
+    lex::Lexer lexer{ files };
+    lexer.tokenize();
+    if(lexer.hasErrors()){
+        std::cerr << lexer.getErrors();
+        return compiler::ExitCode::LEXICAL_ERR;
+    }
+
+    std::unique_ptr<syntax::ast::ASTProgram> library;
+    try{
+        syntax::TokenConsumer tokenConsumer{ lexer };
+        syntax::Parser parser{ tokenConsumer };
+        library = parser.parseProgram();
+    }
+    catch(std::exception& e){
+        std::cerr << std::format("Syntax check: failed!\n{}\n", e.what());
+        return compiler::ExitCode::SYNTAX_ERR;
+    }
+
+    std::string interface;
+    try{
+        interface = preprocessing::LibraryInterface::serialize(library.get());
+    }
+    catch(std::exception& e){
+        std::cerr << std::format("Library interface: failed!\n{}\n", e.what());
+        return compiler::ExitCode::SEMANTIC_ERR;
+    }
+
+    std::filesystem::path interfacePath{ input };
+    interfacePath.replace_extension(preprocessing::interfaceExt);
+
+    std::ofstream out{ interfacePath, std::ios::binary | std::ios::trunc };
+    out.write(interface.data(), static_cast<std::streamsize>(interface.size()));
+    if(!out){
+        std::cerr << std::format("Unable to write '{}'", interfacePath.string());
+        return compiler::ExitCode::CODEGEN_ERR;
+    }
+
+    return compiler::ExitCode::NO_ERR;
+}
+
 void compiler::dumpAST(syntax::ast::ASTProgram* program, std::ostream& out){
     syntax::ast::ASTDumper dump{out};
-    program->accept(dump);
+    dump.visitNode(program);
 }
 
 void compiler::dumpIR(ir::IRProgram* program, std::ostream& out){
     ir::IRDumper dump{out};
-    program->accept(dump);
+    dump.visitNode(program);
 }
\ No newline at end of file
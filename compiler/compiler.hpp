@@ -2,6 +2,7 @@
 #define COMPILER_HPP
 
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string_view>
 #include <vector>
@@ -9,9 +10,12 @@
 #include <iostream>
 
 #include "../lexer/lexer.hpp"
+#include "../common/source/mapped_file.hpp"
+#include "../preprocessor/preprocessor.hpp"
 #include "../common/abstract-syntax-tree/ast_program.hpp"
 #include "../common/intermediate-representation-tree/ir_program.hpp"
 #include "../thread-pool/thread_pool.hpp"
+#include "../common/timing/pass_timer.hpp"
 
 /** 
  * @namespace compiler
@@ -49,6 +53,27 @@ namespace compiler {
         /// flag if .s file should be compiled into executable
         bool stopAfterAssembly{false};
 
+        /// flag if lexer and parser should run as a pipeline, forced on for large inputs
+        bool streamTokens{false};
+
+        /// flag if input is a library whose interface should be generated instead of compiling it
+        bool emitInterface{false};
+
+        /// number of threads compiling the input, calling thread included, 0 for the number chosen by the size of the input
+        size_t jobs{0};
+
+        /// flag if worker threads should be pinned to cores
+        bool pinThreads{false};
+
+        /// number of errors after which the compilation stops, 0 for no limit
+        size_t maxErrors{0};
+
+        /// format of the report of the times of the passes, nullopt for no report
+        std::optional<util::timing::ReportFormat> timePasses{};
+
+        /// path of the chrome trace of the passes and the tasks, empty for no trace
+        std::string tracePath{};
+
         /// relative path to input file, .mcpp extension
         std::string input;
 
@@ -63,7 +88,7 @@ namespace compiler {
      * @returns compile options
      * @details
      * 
-     * CLI: ./minicpp <input> [--dump-ast --dump-ir -s] [-o <output>]
+     * CLI: ./minicpp <input> [--dump-ast --dump-ir --stream-tokens --emit-interface --pin-threads -s] [-j <jobs>] [-fmax-errors=<n>] [--time-passes[=json]] [--trace=<path>] [-o <output>]
      *
      * <input> - path to input file, mandatory .mcpp extension
      * 
@@ -73,6 +98,20 @@ namespace compiler {
      *
      * --dump-ir - dumps the structure of the ir
      *
+     * --stream-tokens - parses tokens while the lexer is still producing them
+     *
+     * --emit-interface - writes the precompiled interface of the library next to it
+     *
+     * --pin-threads - pins every worker thread to its own core
+     *
+     * -j <jobs> - number of threads compiling the input, 1 compiles on the calling thread only
+     *
+     * -fmax-errors=<n> - stops the compilation once n errors are reported, 0 for no limit
+     *
+     * --time-passes[=json] - reports wall time, cpu time and peak rss growth of every pass to stderr, as a table or json
+     *
+     * --trace=<path> - writes every pass and every task of the thread pool as chrome trace event json, needs TRACING=1 build
+     *
      * -s - stops after generating .s file
      *
      * -o <output> - path to output file
@@ -80,78 +119,99 @@ namespace compiler {
     CompileOptions parseOptions(int argc, char** argv);
 
     /**
-     * @struct PreprocessResult
-     * @brief result of the preprocessing
-    */
-    struct PreprocessResult {
-        /// exit code after preprocessing, NO_ERR or PREPROCESS_ERR
-        ExitCode exitCode;
-
-        /// preprocessed source code
-        std::vector<std::string> source;
-    };
-
-    /**
-     * @brief reads the source code from the input file
+     * @brief maps the source code of the input file into memory
      * @param input - path to input file
-     * @returns source code
-    */
-    std::string readSourceCode(const std::string& input);
-
-    /** 
-     * @brief preprocesses the source code
-     * @param source - source code
-     * @return pair (ExitCode, vector of preprocessed files), ExitCode is NO_ERR if preprocessing succeeded, PREPROCESS_ERR if it failed
+     * @throws std::runtime_error - when the file can't be opened
+     * @returns read-only mapping of the source code
     */
-    const PreprocessResult preprocess(const std::string& source);
+    util::io::MappedFile readSourceCode(const std::string& input);
 
     /** 
-     * @brief performs lexical analysis of the code
+     * @brief performs lexical analysis of the code, included libraries are loaded while it runs
      * @param lexer - reference to a lexer
-     * @returns LEXICAL_ERR if it captures any lexical errors, NO_ERR otherwise
+     * @param preprocessor - reference to the preprocessor the lexer requests the libraries from
+     * @param threadPool - reference to a thread pool, files are tokenized concurrently
+     * @returns PREPROCESS_ERR if any library failed to load, LEXICAL_ERR if it captures any lexical errors, NO_ERR otherwise
     */
-    ExitCode lexicalAnalysis(lex::Lexer& lexer);
+    ExitCode lexicalAnalysis(
+        lex::Lexer& lexer, 
+        const preprocessing::Preprocessor& preprocessor, 
+        util::concurrency::ThreadPool& threadPool
+    );
 
     /** 
      * @brief performs syntax analysis of the code
      * @param lexer - reference to a lexer
      * @param astProgram - reference to the pointer of the AST program
+     * @param threadPool - reference to a thread pool functions are parsed on
      * @returns SYNTAX_ERR if it captures any syntax errors, NO_ERR otherwise
     */
-    ExitCode syntaxAnalysis(lex::Lexer& lexer, std::unique_ptr<syntax::ast::ASTProgram>& astProgram);
+    ExitCode syntaxAnalysis(
+        lex::Lexer& lexer, 
+        std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
+        util::concurrency::ThreadPool& threadPool
+    );
 
     /** 
-     * @brief performs semantic analysis of the code
+     * @brief performs lexical and syntax analysis as a pipeline, lexer streams tokens to the parser
+     * @details functions and directives are put in the order they have when the lexer runs to completion first
+     * @param lexer - reference to a lexer
+     * @param preprocessor - reference to the preprocessor the lexer requests the libraries from
      * @param astProgram - reference to the pointer of the AST program
-     * @param threadPool - reference to a thread pool
-     * @returns SEMANTIC_ERR if it captures any semantic errors, NO_ERR otherwise
+     * @param threadPool - reference to a thread pool, lexer runs on it
+     * @returns PREPROCESS_ERR if any library failed to load, LEXICAL_ERR if lexer captures any errors, 
+     * SYNTAX_ERR if parser does, NO_ERR otherwise
     */
-    ExitCode semanticAnalysis(std::unique_ptr<syntax::ast::ASTProgram>& astProgram, util::concurrency::ThreadPool& threadPool);
+    ExitCode pipelinedAnalysis(
+        lex::Lexer& lexer, 
+        const preprocessing::Preprocessor& preprocessor, 
+        std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
+        util::concurrency::ThreadPool& threadPool
+    );
 
-    /** 
-     * @brief performs transformation of the code from AST to IRT
+    /**
+     * @brief checks if the input is large enough for pipelined lexing and parsing
+     * @param source - view of the source code
+     * @returns true if its size exceeds the streaming threshold and machine has more than one core, false otherwise
+    */
+    bool shouldStreamTokens(std::string_view source) noexcept;
+
+    /**
+     * @brief chooses the number of threads for compiling the input
+     * @param source - view of the source code
+     * @returns 1 for small inputs, one more thread per work share of the input up to the number of cores otherwise
+    */
+    size_t chooseJobs(std::string_view source) noexcept;
+
+    /**
+     * @brief places the functions declared by the library interfaces into the program
      * @param astProgram - reference to the pointer of the AST program
-     * @param irProgram - reference to the pointer of the IRT program
-     * @param threadPool - reference to a thread pool
-     * @returns IR_ERR if it captures any errors, NO_ERR otherwise
+     * @param preprocessor - const reference to the preprocessor holding the interfaces, has to outlive the program
     */
-    ExitCode transformASTToIRT(
+    void declareLibraries(
         std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
-        std::unique_ptr<ir::IRProgram>& irProgram, 
-        util::concurrency::ThreadPool& threadPool
+        const preprocessing::Preprocessor& preprocessor
     );
 
     /** 
-     * @brief performs code generation
-     * @param irProgram - const pointer to the IRT program
-     * @param output - path of the output file
+     * @brief performs semantic analysis, transformation to IRT and code generation of the code
+     * @param astProgram - reference to the pointer of the AST program
+     * @param irProgram - reference to the pointer of the IRT program
+     * @param options - const reference to the compile options
      * @param threadPool - reference to a thread pool
-     * @returns CODEGEN_ERR if it fails to generate code, NO_ERR otherwise
+     * @param timer - pointer to the timer the passes are measured by, nullptr for none
+     * @returns SEMANTIC_ERR if it captures any semantic errors, IR_ERR if transformation to IRT does, 
+     * CODEGEN_ERR if it fails to generate code, NO_ERR otherwise
+     * @details once the signatures are checked every function goes through the analysis, transformation, 
+     * optimizations and code generation on its own, only writing of the code waits for all functions,
+     * running functions stop at the next statement once the error limit is reached, pending ones are dropped
     */
-    ExitCode generateProgram(
-        const ir::IRProgram* irProgram, 
-        std::string_view output, 
-        util::concurrency::ThreadPool& threadPool
+    ExitCode translateProgram(
+        std::unique_ptr<syntax::ast::ASTProgram>& astProgram, 
+        std::unique_ptr<ir::IRProgram>& irProgram, 
+        const CompileOptions& options,
+        util::concurrency::ThreadPool& threadPool,
+        util::timing::PassTimer* timer = nullptr
     );
 
     /**
@@ -165,13 +225,30 @@ namespace compiler {
     /** 
      * @brief performs compilation of the code
      *
-     * preprocessing -> lexer -> parser -> analyzer -> intermediate-representation -> code-generation -> asm + link
+     * lexer (+ preprocessing) -> parser -> analyzer -> intermediate-representation -> code-generation -> asm + link
      * @param input - source code
      * @param output - path of the output file
      * @returns exit code depending on the result of the compilation
+     * @details times of the passes are reported and the trace is written once the compilation ends, whatever its result
     */
     ExitCode compile(CompileOptions options);
 
+    /** 
+     * @brief performs compilation of the program, every pass is measured by the timer
+     * @param options - const reference to the compile options
+     * @param timer - pointer to the timer the passes are measured by, nullptr for none
+     * @returns exit code depending on the result of the compilation
+    */
+    ExitCode compileProgram(const CompileOptions& options, util::timing::PassTimer* timer);
+
+    /**
+     * @brief generates the precompiled interface of the library
+     * @param input - path to the library source, interface is written next to it with .mcppi extension
+     * @returns LEXICAL_ERR or SYNTAX_ERR if the library is invalid, SEMANTIC_ERR if it can't have an interface,
+     * CODEGEN_ERR if the interface can't be written, NO_ERR otherwise
+    */
+    ExitCode emitLibraryInterface(const std::string& input);
+
     /**
      * @brief dumps the structure of the ast program
      * @param program - const pointer to the ast program
@@ -6,17 +6,23 @@
 #include <string>
 #include <vector>
 
+#include "../../common/intermediate-representation-tree/ir_arena.hpp"
+#include "../../common/symbol/string_interner.hpp"
+
 namespace ir {
     /**
      * @struct IRFunctionContext
      * @brief context of the ir function
     */
     struct IRFunctionContext {
+        /// arena of the function being lowered, nodes of the function are placed into it
+        IRArena* arena{ nullptr };
+
         /// number to make temporary name unique
         size_t temporaries{};
 
         /// making sure nested temporary variables are handled properly
-        std::stack<std::string> temporaryNames;
+        std::stack<util::text::SymbolId> temporaryNames;
         
         /// vector of the errors of the function
         std::vector<std::string> errors;
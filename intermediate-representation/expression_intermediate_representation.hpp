@@ -32,14 +32,14 @@ namespace ir {
          * @param astExpr - const pointer to the ast expression
          * @returns pointer to the irt expression
         */
-        std::unique_ptr<ir::IRExpr> transformExpr(const syntax::ast::ASTExpr* astExpr);
+        ir::IRPtr<ir::IRExpr> transformExpr(const syntax::ast::ASTExpr* astExpr);
 
         /**
          * @brief turns ast binary expression into irt binary expression
          * @param astBinaryExpr - const pointer to the ast binary expression
          * @returns pointer to the irt expression
         */
-        std::unique_ptr<ir::IRExpr> 
+        ir::IRPtr<ir::IRExpr> 
         transformBinaryExpr(const syntax::ast::ASTBinaryExpr* astBinaryExpr);
 
         /**
@@ -47,7 +47,7 @@ namespace ir {
          * @param astIdExpr - const pointer to the ast id
          * @returns pointer to the irt id
         */
-        std::unique_ptr<ir::IRIdExpr> 
+        ir::IRPtr<ir::IRIdExpr> 
         transformIdExpr(const syntax::ast::ASTIdExpr* astIdExpr) const;
 
         /**
@@ -55,7 +55,7 @@ namespace ir {
          * @param astLiteralExpr - const pointer to the ast literal
          * @returns pointer to the irt literal
         */
-        std::unique_ptr<ir::IRLiteralExpr> 
+        ir::IRPtr<ir::IRLiteralExpr> 
         transformLiteralExpr(const syntax::ast::ASTLiteralExpr* astLiteralExpr) const;
 
         /**
@@ -63,7 +63,7 @@ namespace ir {
          * @param astExpr - const pointer to the ast expression
          * @returns pointer to the temporary variables
         */
-        std::unique_ptr<ir::IRTemporaryExpr> 
+        ir::IRPtr<ir::IRTemporaryExpr> 
         initiateTemporaries(const syntax::ast::ASTExpr* astExpr);
 
         /**
@@ -71,7 +71,7 @@ namespace ir {
          * @param astCallExpr - const pointer to the ast function call
          * @returns pointer to the irt function call
         */
-        std::unique_ptr<ir::IRFunctionCallExpr> 
+        ir::IRPtr<ir::IRFunctionCallExpr> 
         transformFunctionCallExpr(const syntax::ast::ASTFunctionCallExpr* astCallExpr);
 
         /**
@@ -93,9 +93,9 @@ namespace ir {
 
         /**
          * @brief generates the name for the temporary variable
-         * @returns name of the temporary variable
+         * @returns interned name of the temporary variable
         */
-        std::string generateTemporaries();
+        util::text::SymbolId generateTemporaries();
 
         /**
          * @brief assigns function calls to the temporaries
@@ -114,7 +114,7 @@ namespace ir {
          * @param astCallExpr - const pointer to the ast function call
          * @returns pointer to the irt id of the temporary variable
         */
-        std::unique_ptr<ir::IRIdExpr> 
+        ir::IRPtr<ir::IRIdExpr> 
         replaceFunctionCallExpr(const syntax::ast::ASTFunctionCallExpr* astCallExpr);
 
     private:
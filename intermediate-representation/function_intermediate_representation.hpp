@@ -1,11 +1,13 @@
 #ifndef FUNCTION_INTERMEDIATE_REPRESENTATION_HPP
 #define FUNCTION_INTERMEDIATE_REPRESENTATION_HPP
 
+#include <cstdint>
 #include <memory>
 
 #include "../common/abstract-syntax-tree/ast_function.hpp"
 #include "../common/intermediate-representation-tree/ir_function.hpp"
 #include "ctx/ir_ctx.hpp"
+#include "../thread-pool/cancellation_token.hpp"
 #include "statement_intermediate_representation.hpp"
 
 namespace ir {
@@ -17,8 +19,13 @@ namespace ir {
     public:
         /** 
          * @brief Creates the instance of the function intermediate representation
+         * @param cancellation - const pointer to the token that stops the transformation at the next statement, nullptr for none
+         * @param n - position of the function in the program, SIZE_MAX for the function transformed on its own
         */
-        FunctionIntermediateRepresentation();
+        explicit FunctionIntermediateRepresentation(
+            const util::concurrency::CancellationToken* cancellation = nullptr,
+            size_t n = SIZE_MAX
+        );
 
         /**
          * @brief turns ast function into irt function
@@ -54,6 +61,12 @@ namespace ir {
         */
         const ir::IRFunctionContext& getContext() const noexcept;
 
+        /**
+         * @brief getter for context of the function
+         * @returns context of the function, its results can be moved out
+        */
+        ir::IRFunctionContext& getContext() noexcept;
+
     private:
         /// context of the function
         ir::IRFunctionContext ctx{};
@@ -61,6 +74,23 @@ namespace ir {
         /// intermediate representation specialized for statements
         StatementIntermediateRepresentation stmtIR;
 
+        /// token that stops the transformation, null for none
+        const util::concurrency::CancellationToken* cancellation;
+
+        /// position of the function in the program, SIZE_MAX for the function transformed on its own
+        size_t functionIndex;
+
+        /**
+         * @brief checks if the transformation should stop at the next statement
+         * @returns true if the cancellation token stops the function, false otherwise
+        */
+        inline bool isCancelled() const noexcept {
+            if(!cancellation){
+                return false;
+            }
+            return functionIndex != SIZE_MAX ? cancellation->isCancelled(functionIndex) : cancellation->isCancelled();
+        }
+
     };
 
 }
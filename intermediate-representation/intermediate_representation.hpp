@@ -2,13 +2,15 @@
 #define INTERMEDIATE_REPRESENTATION_HPP
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include <string>
 
 #include "../common/intermediate-representation-tree/ir_program.hpp"
 #include "../common/abstract-syntax-tree/ast_program.hpp"
+#include "../common/symbol/string_interner.hpp"
 #include "../thread-pool/thread_pool.hpp"
+#include "../thread-pool/cancellation_token.hpp"
+#include "../common/timing/pass_timer.hpp"
 
 /**
  * @namespace ir
@@ -24,8 +26,14 @@ namespace ir {
         /** 
          * @brief Creates the instance of the intermediate representation
          * @param threadPool - reference to a thread pool
+         * @param cancellation - pointer to the token errors are reported to, transformation stops once it is set, nullptr for none
+         * @param timer - pointer to the timer the passes of the functions are measured by, nullptr for none
         */
-        IntermediateRepresentation(util::concurrency::ThreadPool& threadPool);
+        IntermediateRepresentation(
+            util::concurrency::ThreadPool& threadPool,
+            util::concurrency::CancellationToken* cancellation = nullptr,
+            util::timing::PassTimer* timer = nullptr
+        );
 
         /**
          * @brief transforms ast program into irt program
@@ -35,6 +43,25 @@ namespace ir {
         [[nodiscard]] std::unique_ptr<ir::IRProgram> 
         transformProgram(const syntax::ast::ASTProgram* program);
 
+        /**
+         * @brief creates the irt program with the directives of the ast program and a slot for every function
+         * @param program - const pointer to the root of the ast program
+         * @returns pointer to the root of irt program, functions are added by transformFunctionAt
+        */
+        [[nodiscard]] std::unique_ptr<ir::IRProgram> 
+        beginProgram(const syntax::ast::ASTProgram* program);
+
+        /**
+         * @brief transforms the function into irt, eliminates its dead code and calculates its stack frame
+         * @param program - const pointer to the root of the ast program
+         * @param irProgram - pointer to the irt program created by beginProgram
+         * @param n - position of the function in the program
+         * @returns true if no errors were caught in the function, false otherwise
+         * @note functions at different positions may be transformed concurrently,
+         * slot of the function is left empty when the cancellation token already stops it
+        */
+        bool transformFunctionAt(const syntax::ast::ASTProgram* program, ir::IRProgram* irProgram, size_t n);
+
         /**
          * @brief checks if any errors are caught
          * @param program - const pointer to the root of the irt
@@ -45,7 +72,7 @@ namespace ir {
         /**
          * @brief getter for the ir errors
          * @param program - pointer to the root of the irt program
-         * @returns errors merged into a string
+         * @returns errors merged into a string, at most the error limit of the cancellation token
         */
         std::string getErrors(const ir::IRProgram* program) const noexcept;
 
@@ -53,12 +80,15 @@ namespace ir {
         /// thread pool for parallel function ir transformation
         util::concurrency::ThreadPool& threadPool;
 
-    protected:
-        /// maps function name to its exceptions
-        std::unordered_map<std::string,std::vector<std::string>> exceptions;
+        /// token the errors are reported to, null for none
+        util::concurrency::CancellationToken* cancellation;
+
+        /// timer the passes of the functions are measured by, null for none
+        util::timing::PassTimer* timer;
 
-        /// mutex protecting exceptions map
-        std::mutex mtx;
+    protected:
+        /// exceptions of the functions, indexed by the position of the function in the program
+        std::vector<std::vector<std::string>> exceptions;
 
     };
 
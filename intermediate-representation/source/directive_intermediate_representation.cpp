@@ -1,5 +1,6 @@
 #include "../directive_intermediate_representation.hpp"
 
+#include <string>
 #include <utility>
 
 void ir::DirectiveIntermediateRepresentation::transformDir(
@@ -21,5 +22,5 @@ void ir::DirectiveIntermediateRepresentation::transformIncludeDir(
     ir::IRProgram* irProgram, 
     const syntax::ast::ASTIncludeDir* astLib
 ){
-    irProgram->addLinkedLib(astLib->getLibName());
+    irProgram->addLinkedLib(std::string{ astLib->getLibName() });
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ ir::ExpressionIntermediateRepresentation::ExpressionIntermediateRepresentation(
     ir::IRFunctionContext& context
 ) : ctx{ context } {};
 
-std::unique_ptr<ir::IRExpr> 
+ir::IRPtr<ir::IRExpr> 
 ir::ExpressionIntermediateRepresentation::transformExpr(const syntax::ast::ASTExpr* astExpr){
     auto nodeType{ astExpr->getNodeType() };
     switch(nodeType){
@@ -27,12 +27,12 @@ ir::ExpressionIntermediateRepresentation::transformExpr(const syntax::ast::ASTEx
     }
 }
 
-std::unique_ptr<ir::IRExpr> 
+ir::IRPtr<ir::IRExpr> 
 ir::ExpressionIntermediateRepresentation::transformBinaryExpr(const syntax::ast::ASTBinaryExpr* astBinaryExpr){
-    std::unique_ptr<ir::IRExpr> leftOperand{ 
+    ir::IRPtr<ir::IRExpr> leftOperand{ 
         transformExpr(astBinaryExpr->getLeftOperandExpr()) 
     };
-    std::unique_ptr<ir::IRExpr> rightOperand{ 
+    ir::IRPtr<ir::IRExpr> rightOperand{ 
         transformExpr(astBinaryExpr->getRightOperandExpr()) 
     };
 
@@ -40,14 +40,15 @@ ir::ExpressionIntermediateRepresentation::transformBinaryExpr(const syntax::ast:
     if(leftOperand->getNodeType() == ir::IRNodeType::LITERAL && 
        rightOperand->getNodeType() == ir::IRNodeType::LITERAL) {
 
-        optimization::constant_folding::MergeResult<std::unique_ptr<ir::IRExpr>> res;
+        optimization::constant_folding::MergeResult<ir::IRPtr<ir::IRExpr>> res;
 
         switch(type) {
             case types::Type::INT:
                 res = optimization::constant_folding::mergeLiterals<int>(
                     static_cast<const ir::IRLiteralExpr*>(leftOperand.get()), 
                     static_cast<const ir::IRLiteralExpr*>(rightOperand.get()), 
-                    astBinaryExpr
+                    astBinaryExpr, 
+                    *ctx.arena
                 );
                 break;
 
@@ -55,7 +56,8 @@ ir::ExpressionIntermediateRepresentation::transformBinaryExpr(const syntax::ast:
                 res = optimization::constant_folding::mergeLiterals<unsigned>(
                     static_cast<const ir::IRLiteralExpr*>(leftOperand.get()), 
                     static_cast<const ir::IRLiteralExpr*>(rightOperand.get()), 
-                    astBinaryExpr
+                    astBinaryExpr, 
+                    *ctx.arena
                 );
                 break;
             
@@ -72,8 +74,8 @@ ir::ExpressionIntermediateRepresentation::transformBinaryExpr(const syntax::ast:
     
     auto nodeType{ ir::resolveOperator(astBinaryExpr->getOperator(), type) };
 
-    std::unique_ptr<ir::IRBinaryExpr> irBinaryExpr{ 
-        std::make_unique<ir::IRBinaryExpr>(nodeType, type) 
+    ir::IRPtr<ir::IRBinaryExpr> irBinaryExpr{ 
+        ctx.arena->make<ir::IRBinaryExpr>(nodeType, type) 
     };
 
     irBinaryExpr->setBinaryExpr(
@@ -85,33 +87,33 @@ ir::ExpressionIntermediateRepresentation::transformBinaryExpr(const syntax::ast:
     return irBinaryExpr;
 }
 
-std::unique_ptr<ir::IRIdExpr> 
+ir::IRPtr<ir::IRIdExpr> 
 ir::ExpressionIntermediateRepresentation::transformIdExpr(
     const syntax::ast::ASTIdExpr* astIdExpr
 ) const {
-    return std::make_unique<ir::IRIdExpr>(
-        astIdExpr->getToken().value, 
+    return ctx.arena->make<ir::IRIdExpr>(
+        astIdExpr->getSymbolId(), 
         astIdExpr->getType()
     );
 }
 
-std::unique_ptr<ir::IRLiteralExpr> 
+ir::IRPtr<ir::IRLiteralExpr> 
 ir::ExpressionIntermediateRepresentation::transformLiteralExpr(
     const syntax::ast::ASTLiteralExpr* astLiteralExpr
 ) const {
-    return std::make_unique<ir::IRLiteralExpr>(
-        astLiteralExpr->getToken().value, 
+    return ctx.arena->make<ir::IRLiteralExpr>(
+        astLiteralExpr->getToken().value(), 
         astLiteralExpr->getType()
     );
 }
 
-std::unique_ptr<ir::IRFunctionCallExpr> 
+ir::IRPtr<ir::IRFunctionCallExpr> 
 ir::ExpressionIntermediateRepresentation::transformFunctionCallExpr(
     const syntax::ast::ASTFunctionCallExpr* astCallExpr
 ){
-    std::unique_ptr<ir::IRFunctionCallExpr> irCallExpr{ 
-        std::make_unique<ir::IRFunctionCallExpr>(
-            astCallExpr->getToken().value, astCallExpr->getType()
+    ir::IRPtr<ir::IRFunctionCallExpr> irCallExpr{ 
+        ctx.arena->make<ir::IRFunctionCallExpr>(
+            astCallExpr->getSymbolId(), astCallExpr->getType()
         )
     };
     transformArguments(irCallExpr.get(), astCallExpr);
@@ -152,8 +154,10 @@ size_t ir::ExpressionIntermediateRepresentation::countTemporaries(const syntax::
 }
 
 // generating temporary variables
-std::string ir::ExpressionIntermediateRepresentation::generateTemporaries(){
-    std::string name{ std::format("_t{}", ++ctx.temporaries) };
+util::text::SymbolId ir::ExpressionIntermediateRepresentation::generateTemporaries(){
+    const util::text::SymbolId name{ 
+        util::text::StringInterner::intern(std::format("_t{}", ++ctx.temporaries)) 
+    };
     ctx.temporaryNames.push(name);
     return name;
 }
@@ -190,24 +194,24 @@ void ir::ExpressionIntermediateRepresentation::assignTemporaries(
 }
 
 // replacing function calls with temporary variables in expression
-std::unique_ptr<ir::IRIdExpr> 
+ir::IRPtr<ir::IRIdExpr> 
 ir::ExpressionIntermediateRepresentation::replaceFunctionCallExpr(
     const syntax::ast::ASTFunctionCallExpr* astCallExpr
 ){
     assert(!ctx.temporaryNames.empty());
-    std::string name{ ctx.temporaryNames.top() };
+    const util::text::SymbolId name{ ctx.temporaryNames.top() };
     ctx.temporaryNames.pop();
-    return std::make_unique<ir::IRIdExpr>(name, astCallExpr->getType());
+    return ctx.arena->make<ir::IRIdExpr>(name, astCallExpr->getType());
 }
 
-std::unique_ptr<ir::IRTemporaryExpr> 
+ir::IRPtr<ir::IRTemporaryExpr> 
 ir::ExpressionIntermediateRepresentation::initiateTemporaries(
     const syntax::ast::ASTExpr* astExpr
 ){
     size_t tmpCount{ countTemporaries(astExpr) };
     if(tmpCount > 0){
-        std::unique_ptr<ir::IRTemporaryExpr> temporaryRoot{ 
-            std::make_unique<ir::IRTemporaryExpr>() 
+        ir::IRPtr<ir::IRTemporaryExpr> temporaryRoot{ 
+            ctx.arena->make<ir::IRTemporaryExpr>() 
         };
         
         size_t firstTemporaryIndex = 0;
@@ -1,16 +1,21 @@
 #include "../function_intermediate_representation.hpp"
 
-ir::FunctionIntermediateRepresentation::FunctionIntermediateRepresentation()
-    : stmtIR{ ctx } {}
+ir::FunctionIntermediateRepresentation::FunctionIntermediateRepresentation(
+    const util::concurrency::CancellationToken* cancellation,
+    size_t n
+)
+    : stmtIR{ ctx }, cancellation{ cancellation }, functionIndex{ n } {}
 
 std::unique_ptr<ir::IRFunction> 
 ir::FunctionIntermediateRepresentation::transformFunction(const syntax::ast::ASTFunction* astFunction){
     std::unique_ptr<ir::IRFunction> irFunction{ 
         std::make_unique<ir::IRFunction>(
-            astFunction->getToken().value, 
+            astFunction->getSymbolId(), 
             astFunction->getType()
         )
     };
+    ctx.arena = &irFunction->getArena();
+    irFunction->setCost(astFunction->getCost());
 
     transformParameters(irFunction.get(), astFunction);
     if(astFunction->isPredefined()){
@@ -29,8 +34,8 @@ void ir::FunctionIntermediateRepresentation::transformParameters(
 ){
     for(const auto& astParameter : astFunction->getParameters()){
         irFunction->addParameter(
-            std::make_unique<ir::IRParameter>(
-                astParameter->getToken().value, 
+            ctx.arena->make<ir::IRParameter>(
+                astParameter->getSymbolId(), 
                 astParameter->getType()
             )
         );
@@ -42,6 +47,9 @@ void ir::FunctionIntermediateRepresentation::transformBody(
     const syntax::ast::ASTFunction* astFunction
 ){
     for(const auto& astStmt : astFunction->getBody()){
+        if(isCancelled()){
+            break;
+        }
         irFunction->addStatement(stmtIR.transformStmt(astStmt.get()));
 
         // ignores all statements after return statement
@@ -54,4 +62,9 @@ void ir::FunctionIntermediateRepresentation::transformBody(
 const ir::IRFunctionContext& 
 ir::FunctionIntermediateRepresentation::getContext() const noexcept {
     return ctx;
+}
+
+ir::IRFunctionContext& 
+ir::FunctionIntermediateRepresentation::getContext() noexcept {
+    return ctx;
 }
\ No newline at end of file
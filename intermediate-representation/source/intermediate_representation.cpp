@@ -1,23 +1,42 @@
 #include "../intermediate_representation.hpp"
 
+#include <cstdint>
 #include <cassert>
 #include <memory>
-#include <mutex>
 #include <sstream>
 #include <string>
-#include <latch>
 
 #include "../../common/abstract-syntax-tree/ast_include_dir.hpp"
 #include "../../optimization/stack_frame_analyzer.hpp"
 #include "../../optimization/dead_code_eliminator.hpp"
 #include "../directive_intermediate_representation.hpp"
 #include "../function_intermediate_representation.hpp"
+#include "../../thread-pool/task_group.hpp"
 
-ir::IntermediateRepresentation::IntermediateRepresentation(util::concurrency::ThreadPool& threadPool) 
-    : threadPool{ threadPool } {}
+ir::IntermediateRepresentation::IntermediateRepresentation(
+    util::concurrency::ThreadPool& threadPool,
+    util::concurrency::CancellationToken* cancellation,
+    util::timing::PassTimer* timer
+) 
+    : threadPool{ threadPool }, cancellation{ cancellation }, timer{ timer } {}
 
 std::unique_ptr<ir::IRProgram> 
 ir::IntermediateRepresentation::transformProgram(const syntax::ast::ASTProgram* program){
+    std::unique_ptr<ir::IRProgram> irProgram{ beginProgram(program) };
+
+    util::concurrency::parallelForByCost(threadPool, program->getFunctionCount(),
+        [program](size_t i) -> size_t { return program->getFunctionAtN(i)->getCost(); },
+        [this, irProgram = irProgram.get(), program](size_t i) -> void {
+            transformFunctionAt(program, irProgram, i);
+        },
+        cancellation
+    );
+
+    return irProgram;
+}
+
+std::unique_ptr<ir::IRProgram> 
+ir::IntermediateRepresentation::beginProgram(const syntax::ast::ASTProgram* program){
     std::unique_ptr<ir::IRProgram> irProgram{ 
         std::make_unique<ir::IRProgram>() 
     };
@@ -30,47 +49,13 @@ ir::IntermediateRepresentation::transformProgram(const syntax::ast::ASTProgram*
     const size_t total{ program->getFunctionCount() };
     irProgram->resizeFunctions(total);
 
-    std::latch doneLatch{ static_cast<std::ptrdiff_t>(total) };
-
-    for(size_t i{0}; i < total; ++i){
-        threadPool.enqueue(
-            [this, 
-                irProgram = irProgram.get(), 
-                function = program->getFunctionAtN(i), 
-                &doneLatch, i
-            ] -> void {
-                // generating ir of a function
-                FunctionIntermediateRepresentation funcIR;
-                std::unique_ptr<ir::IRFunction> irFunction{ 
-                    funcIR.transformFunction(function) 
-                };
-
-                {
-                    std::lock_guard<std::mutex> lock{mtx};
-                    exceptions[irFunction->getFunctionName()] = funcIR.getContext().errors;
-                }
-
-                irProgram->setFunctionAtN(std::move(irFunction), i);
-
-                doneLatch.count_down();
-            }
-        );
-    }
-
-    doneLatch.wait();
-
-    // eliminating dead code from the program
-    optimization::dce::DeadCodeEliminator dce{threadPool};
-    irProgram->accept(dce);
-
-    // calculating required memory for the stack of each function
-    optimization::sfa::StackFrameAnalyzer stackFrameAnalyzer{threadPool};
-    irProgram->accept(stackFrameAnalyzer); 
+    // every function owns the slot at its position, tasks fill their slots without locking
+    exceptions.assign(total, {});
 
     for(const auto& dir : program->getDirs()) {
         if(dir->getNodeType() == syntax::ast::ASTNodeType::INCLUDE_DIR){
             irProgram->addLinkedLib(
-                static_cast<const syntax::ast::ASTIncludeDir*>(dir.get())->getLibName()
+                std::string{ static_cast<const syntax::ast::ASTIncludeDir*>(dir.get())->getLibName() }
             );
         }
     }
@@ -78,9 +63,54 @@ ir::IntermediateRepresentation::transformProgram(const syntax::ast::ASTProgram*
     return irProgram;
 }
 
+bool ir::IntermediateRepresentation::transformFunctionAt(
+    const syntax::ast::ASTProgram* program, 
+    ir::IRProgram* irProgram, 
+    size_t n
+){
+    if(cancellation && cancellation->isCancelled(n)){
+        return true;
+    }
+
+    const util::text::SymbolId function{ program->getFunctionAtN(n)->getSymbolId() };
+    const size_t cost{ program->getFunctionAtN(n)->getCost() };
+
+    // generating ir of a function
+    FunctionIntermediateRepresentation funcIR{ cancellation, n };
+    std::unique_ptr<ir::IRFunction> irFunction;
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::LOWERING, function, cost };
+        irFunction = funcIR.transformFunction(program->getFunctionAtN(n));
+    }
+
+    // eliminating dead code from the function
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::DEAD_CODE_ELIMINATION, function, cost };
+        optimization::dce::DeadCodeEliminator dce{threadPool};
+        dce.visitNode(irFunction.get());
+    }
+
+    // calculating required memory for the stack of the function
+    {
+        util::timing::PassGuard passGuard{ timer, util::timing::Pass::STACK_FRAME_ANALYSIS, function, cost };
+        optimization::sfa::StackFrameAnalyzer stackFrameAnalyzer{threadPool};
+        stackFrameAnalyzer.visitNode(irFunction.get()); 
+    }
+
+    exceptions[n] = std::move(funcIR.getContext().errors);
+    irProgram->setFunctionAtN(std::move(irFunction), n);
+
+    if(cancellation){
+        cancellation->reportErrors(n, exceptions[n].size());
+        cancellation->finishItem(n);
+    }
+
+    return exceptions[n].empty();
+}
+
 bool ir::IntermediateRepresentation::hasErrors(const ir::IRProgram* program) const noexcept {
-    for(const auto& function : program->getFunctions()){
-        if(!exceptions.at(function->getFunctionName()).empty()){
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        if(!exceptions[i].empty()){
             return true;
         }
     }
@@ -95,10 +125,16 @@ std::string ir::IntermediateRepresentation::getErrors(const ir::IRProgram* progr
     std::stringstream errors{"Forming Intermediate Representation failed:\n"};
     size_t errLen{ errors.str().length() };
 
-    for(const auto& function : program->getFunctions()){
-        const std::vector<std::string>& funcErrors{ exceptions.at(function->getFunctionName()) };
-        for(const auto& error : funcErrors){
+    // errors past the limit are dropped, functions past the first ones reaching the limit are the only ones stopped,
+    // so the kept errors are the same whatever functions were transformed first
+    size_t remaining{ cancellation && cancellation->getMaxErrors() != 0 ? cancellation->getMaxErrors() : SIZE_MAX };
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        for(const auto& error : exceptions[i]){
+            if(remaining == 0){
+                break;
+            }
             errors << error << "\n";
+            --remaining;
         }
     }
 
@@ -5,9 +5,9 @@
 
 ir::StatementIntermediateRepresentation::StatementIntermediateRepresentation(
     ir::IRFunctionContext& context
-) : exprIR{ context } {}
+) : exprIR{ context }, ctx{ context } {}
 
-std::unique_ptr<ir::IRStmt> 
+ir::IRPtr<ir::IRStmt> 
 ir::StatementIntermediateRepresentation::transformStmt(const syntax::ast::ASTStmt* astStmt){
     switch(astStmt->getNodeType()){
         case syntax::ast::ASTNodeType::VARIABLE_DECL_STMT:
@@ -45,13 +45,13 @@ ir::StatementIntermediateRepresentation::transformStmt(const syntax::ast::ASTStm
     }
 }
 
-std::unique_ptr<ir::IRVariableDeclStmt> 
+ir::IRPtr<ir::IRVariableDeclStmt> 
 ir::StatementIntermediateRepresentation::transformVariableDeclStmt(
     const syntax::ast::ASTVariableDeclStmt* astVariableDecl
 ){
-    std::unique_ptr<ir::IRVariableDeclStmt> irVariableDecl{ 
-        std::make_unique<ir::IRVariableDeclStmt>(
-            astVariableDecl->getToken().value, 
+    ir::IRPtr<ir::IRVariableDeclStmt> irVariableDecl{ 
+        ctx.arena->make<ir::IRVariableDeclStmt>(
+            astVariableDecl->getSymbolId(), 
             astVariableDecl->getType()
         )
     };
@@ -66,10 +66,10 @@ ir::StatementIntermediateRepresentation::transformVariableDeclStmt(
     return irVariableDecl;
 }
 
-std::unique_ptr<ir::IRIfStmt> 
+ir::IRPtr<ir::IRIfStmt> 
 ir::StatementIntermediateRepresentation::transformIfStmt(const syntax::ast::ASTIfStmt* astIfStmt){
-    std::unique_ptr<ir::IRIfStmt> irIfStmt{ 
-        std::make_unique<ir::IRIfStmt>() 
+    ir::IRPtr<ir::IRIfStmt> irIfStmt{ 
+        ctx.arena->make<ir::IRIfStmt>() 
     };
 
     const auto& astConds{ astIfStmt->getConditionExprs() };
@@ -93,12 +93,12 @@ ir::StatementIntermediateRepresentation::transformIfStmt(const syntax::ast::ASTI
     return irIfStmt;
 }
 
-std::unique_ptr<ir::IRCompoundStmt> 
+ir::IRPtr<ir::IRCompoundStmt> 
 ir::StatementIntermediateRepresentation::transformCompoundStmt(
     const syntax::ast::ASTCompoundStmt* astCompoundStmt
 ){
-    std::unique_ptr<ir::IRCompoundStmt> irCompoundStmt{ 
-        std::make_unique<ir::IRCompoundStmt>() 
+    ir::IRPtr<ir::IRCompoundStmt> irCompoundStmt{ 
+        ctx.arena->make<ir::IRCompoundStmt>() 
     };
 
     for(const auto& astStmt : astCompoundStmt->getStmts()){
@@ -112,12 +112,12 @@ ir::StatementIntermediateRepresentation::transformCompoundStmt(
     return irCompoundStmt;
 }
 
-std::unique_ptr<ir::IRAssignStmt> 
+ir::IRPtr<ir::IRAssignStmt> 
 ir::StatementIntermediateRepresentation::transformAssignStmt(
     const syntax::ast::ASTAssignStmt* astAssignStmt
 ){
-    std::unique_ptr<ir::IRAssignStmt> irAssignStmt{ 
-        std::make_unique<ir::IRAssignStmt>() 
+    ir::IRPtr<ir::IRAssignStmt> irAssignStmt{ 
+        ctx.arena->make<ir::IRAssignStmt>() 
     };
 
     // extracting function calls to temporary variables
@@ -131,12 +131,12 @@ ir::StatementIntermediateRepresentation::transformAssignStmt(
     return irAssignStmt;
 }
 
-std::unique_ptr<ir::IRReturnStmt> 
+ir::IRPtr<ir::IRReturnStmt> 
 ir::StatementIntermediateRepresentation::transformReturnStmt(
     const syntax::ast::ASTReturnStmt* astReturnStmt
 ){
-    std::unique_ptr<ir::IRReturnStmt> irReturnStmt{ 
-        std::make_unique<ir::IRReturnStmt>() 
+    ir::IRPtr<ir::IRReturnStmt> irReturnStmt{ 
+        ctx.arena->make<ir::IRReturnStmt>() 
     };
 
     if(astReturnStmt->hasReturnExpr()){
@@ -151,12 +151,12 @@ ir::StatementIntermediateRepresentation::transformReturnStmt(
     return irReturnStmt;
 }
 
-std::unique_ptr<ir::IRFunctionCallStmt> 
+ir::IRPtr<ir::IRFunctionCallStmt> 
 ir::StatementIntermediateRepresentation::transformFunctionCallStmt(
     const syntax::ast::ASTFunctionCallStmt* astCallStmt
 ){
-    std::unique_ptr<ir::IRFunctionCallStmt> irCallStmt{ 
-        std::make_unique<ir::IRFunctionCallStmt>() 
+    ir::IRPtr<ir::IRFunctionCallStmt> irCallStmt{ 
+        ctx.arena->make<ir::IRFunctionCallStmt>() 
     };
 
     irCallStmt->setFunctionCallStmt(
@@ -168,12 +168,12 @@ ir::StatementIntermediateRepresentation::transformFunctionCallStmt(
     return irCallStmt;
 }
 
-std::unique_ptr<ir::IRWhileStmt> 
+ir::IRPtr<ir::IRWhileStmt> 
 ir::StatementIntermediateRepresentation::transformWhileStmt(
     const syntax::ast::ASTWhileStmt* astWhileStmt
 ){
-    std::unique_ptr<ir::IRWhileStmt> irWhileStmt{ 
-        std::make_unique<ir::IRWhileStmt>() 
+    ir::IRPtr<ir::IRWhileStmt> irWhileStmt{ 
+        ctx.arena->make<ir::IRWhileStmt>() 
     };
 
     auto temps{ exprIR.initiateTemporaries(astWhileStmt->getConditionExpr()) };
@@ -186,17 +186,17 @@ ir::StatementIntermediateRepresentation::transformWhileStmt(
     return irWhileStmt;
 }
 
-std::unique_ptr<ir::IRForStmt> 
+ir::IRPtr<ir::IRForStmt> 
 ir::StatementIntermediateRepresentation::transformForStmt(
     const syntax::ast::ASTForStmt* astForStmt
 ){
-    std::unique_ptr<ir::IRForStmt> irForStmt{ 
-        std::make_unique<ir::IRForStmt>() 
+    ir::IRPtr<ir::IRForStmt> irForStmt{ 
+        ctx.arena->make<ir::IRForStmt>() 
     };
     
-    std::unique_ptr<ir::IRAssignStmt> irForInit{ nullptr }, irForInc{ nullptr };
-    std::unique_ptr<ir::IRExpr> irForCondition{ nullptr };
-    std::unique_ptr<ir::IRTemporaryExpr> temps{ nullptr };
+    ir::IRPtr<ir::IRAssignStmt> irForInit{ nullptr }, irForInc{ nullptr };
+    ir::IRPtr<ir::IRExpr> irForCondition{ nullptr };
+    ir::IRPtr<ir::IRTemporaryExpr> temps{ nullptr };
 
     if(astForStmt->hasInitializerStmt()){
         irForInit = transformAssignStmt(astForStmt->getInitializerStmt());
@@ -220,12 +220,12 @@ ir::StatementIntermediateRepresentation::transformForStmt(
     return irForStmt;
 }
 
-std::unique_ptr<ir::IRDoWhileStmt> 
+ir::IRPtr<ir::IRDoWhileStmt> 
 ir::StatementIntermediateRepresentation::transformDoWhileStmt(
     const syntax::ast::ASTDoWhileStmt* astDowhileStmt
 ){
-    std::unique_ptr<ir::IRDoWhileStmt> irDowhileStmt{ 
-        std::make_unique<ir::IRDoWhileStmt>() 
+    ir::IRPtr<ir::IRDoWhileStmt> irDowhileStmt{ 
+        ctx.arena->make<ir::IRDoWhileStmt>() 
     };
 
     auto temps{ exprIR.initiateTemporaries(astDowhileStmt->getConditionExpr()) };
@@ -237,12 +237,12 @@ ir::StatementIntermediateRepresentation::transformDoWhileStmt(
     return irDowhileStmt;
 }
 
-std::unique_ptr<ir::IRSwitchStmt> 
+ir::IRPtr<ir::IRSwitchStmt> 
 ir::StatementIntermediateRepresentation::transformSwitchStmt(
     const syntax::ast::ASTSwitchStmt* astSwitchStmt
 ){
-    std::unique_ptr<ir::IRSwitchStmt> irSwitchStmt{ 
-        std::make_unique<ir::IRSwitchStmt>() 
+    ir::IRPtr<ir::IRSwitchStmt> irSwitchStmt{ 
+        ctx.arena->make<ir::IRSwitchStmt>() 
     };
 
     irSwitchStmt->setVariableIdExpr(
@@ -266,11 +266,11 @@ ir::StatementIntermediateRepresentation::transformSwitchStmt(
     return irSwitchStmt;
 }
 
-std::unique_ptr<ir::IRCaseStmt> 
+ir::IRPtr<ir::IRCaseStmt> 
 ir::StatementIntermediateRepresentation::transformCaseStmt(
     const syntax::ast::ASTCaseStmt* astCaseStmt
 ){
-    std::unique_ptr<ir::IRCaseStmt> irCaseStmt{ std::make_unique<ir::IRCaseStmt>() };
+    ir::IRPtr<ir::IRCaseStmt> irCaseStmt{ ctx.arena->make<ir::IRCaseStmt>() };
     irCaseStmt->setCase(
         exprIR.transformLiteralExpr(astCaseStmt->getLiteralExpr()), 
         transformSwitchBlockStmt(astCaseStmt->getSwitchBlockStmt()), 
@@ -280,11 +280,11 @@ ir::StatementIntermediateRepresentation::transformCaseStmt(
     return irCaseStmt;
 }
 
-std::unique_ptr<ir::IRDefaultStmt> 
+ir::IRPtr<ir::IRDefaultStmt> 
 ir::StatementIntermediateRepresentation::transformDefaultStmt(
     const syntax::ast::ASTDefaultStmt* astDefaultStmt
 ){
-    std::unique_ptr<ir::IRDefaultStmt> irDefaultStmt{ std::make_unique<ir::IRDefaultStmt>() };
+    ir::IRPtr<ir::IRDefaultStmt> irDefaultStmt{ ctx.arena->make<ir::IRDefaultStmt>() };
     irDefaultStmt->setSwitchBlock(
         transformSwitchBlockStmt(
             astDefaultStmt->getSwitchBlockStmt()
@@ -294,12 +294,12 @@ ir::StatementIntermediateRepresentation::transformDefaultStmt(
     return irDefaultStmt;
 }
 
-std::unique_ptr<ir::IRSwitchBlockStmt> 
+ir::IRPtr<ir::IRSwitchBlockStmt> 
 ir::StatementIntermediateRepresentation::transformSwitchBlockStmt(
     const syntax::ast::ASTSwitchBlockStmt* astSwitchBlockStmt
 ){
-    std::unique_ptr<ir::IRSwitchBlockStmt> irSwitchBlockStmt{ 
-        std::make_unique<ir::IRSwitchBlockStmt>() 
+    ir::IRPtr<ir::IRSwitchBlockStmt> irSwitchBlockStmt{ 
+        ctx.arena->make<ir::IRSwitchBlockStmt>() 
     };
     
     for(const auto& astStmt : astSwitchBlockStmt->getStmts()){
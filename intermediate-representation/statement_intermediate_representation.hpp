@@ -47,14 +47,14 @@ namespace ir {
          * @param astStmt - const pointer to the ast statement
          * @returns pointer to the irt statement
         */
-        std::unique_ptr<ir::IRStmt> transformStmt(const syntax::ast::ASTStmt* astStmt);
+        ir::IRPtr<ir::IRStmt> transformStmt(const syntax::ast::ASTStmt* astStmt);
         
         /**
          * @brief turns ast variable declaration into irt variable declaration
          * @param astVariableDecl - const pointer to the ast variable declaration
          * @returns irt pointer to the variable declaratiom
         */
-        std::unique_ptr<ir::IRVariableDeclStmt> 
+        ir::IRPtr<ir::IRVariableDeclStmt> 
         transformVariableDeclStmt(const syntax::ast::ASTVariableDeclStmt* astVariableDecl);
 
         /**
@@ -62,7 +62,7 @@ namespace ir {
          * @param astIfStmt - const pointer to the ast if-statement
          * @returns pointer to the irt if-statement
         */
-        std::unique_ptr<ir::IRIfStmt> 
+        ir::IRPtr<ir::IRIfStmt> 
         transformIfStmt(const syntax::ast::ASTIfStmt* astIfStmt);
 
         /**
@@ -70,7 +70,7 @@ namespace ir {
          * @param astCompoundStmt - const pointer to the ast compound statement
          * @returns pointer to the irt compound statement
         */
-        std::unique_ptr<ir::IRCompoundStmt> 
+        ir::IRPtr<ir::IRCompoundStmt> 
         transformCompoundStmt(const syntax::ast::ASTCompoundStmt* astCompoundStmt);
 
         /**
@@ -78,7 +78,7 @@ namespace ir {
          * @param astAssignStmt - const pointer to the ast assignment statement
          * @returns pointer to the irt statement
         */
-        std::unique_ptr<ir::IRAssignStmt> 
+        ir::IRPtr<ir::IRAssignStmt> 
         transformAssignStmt(const syntax::ast::ASTAssignStmt* astAssignStmt);
 
         /**
@@ -86,7 +86,7 @@ namespace ir {
          * @param astReturnStmt - const pointer to the ast return statement
          * @returns pointer to the irt return statement
         */
-        std::unique_ptr<ir::IRReturnStmt> 
+        ir::IRPtr<ir::IRReturnStmt> 
         transformReturnStmt(const syntax::ast::ASTReturnStmt* astReturnStmt);
 
         /**
@@ -94,7 +94,7 @@ namespace ir {
          * @param astCallStmt - const pointer to the ast function-call statement
          * @returns pointer to the irt function-call statement
         */
-        std::unique_ptr<ir::IRFunctionCallStmt> 
+        ir::IRPtr<ir::IRFunctionCallStmt> 
         transformFunctionCallStmt(const syntax::ast::ASTFunctionCallStmt* astCallStmt);
 
         /**
@@ -102,7 +102,7 @@ namespace ir {
          * @param astWhileStmt - const pointer to the ast while-statement
          * @returns pointer to the irt while-statement 
         */
-        std::unique_ptr<ir::IRWhileStmt> 
+        ir::IRPtr<ir::IRWhileStmt> 
         transformWhileStmt(const syntax::ast::ASTWhileStmt* astWhileStmt);
 
         /**
@@ -110,7 +110,7 @@ namespace ir {
          * @param astForStmt - const pointer to the ast for-statement
          * @returns pointer to the irt for-statement
         */
-        std::unique_ptr<ir::IRForStmt> 
+        ir::IRPtr<ir::IRForStmt> 
         transformForStmt(const syntax::ast::ASTForStmt* astForStmt);
 
         /**
@@ -118,7 +118,7 @@ namespace ir {
          * @param astDowhileStmt - const pointer to the ast do-while statement
          * @returns pointer to the irt do-while statement
         */
-        std::unique_ptr<ir::IRDoWhileStmt> 
+        ir::IRPtr<ir::IRDoWhileStmt> 
         transformDoWhileStmt(const syntax::ast::ASTDoWhileStmt* astDowhileStmt);
 
         /**
@@ -126,7 +126,7 @@ namespace ir {
          * @param astSwitchStmt - const pointer to the ast switch-statement
          * @returns pointer to the irt switch-statement
         */
-        std::unique_ptr<ir::IRSwitchStmt> 
+        ir::IRPtr<ir::IRSwitchStmt> 
         transformSwitchStmt(const syntax::ast::ASTSwitchStmt* astSwitchStmt);
 
         /**
@@ -134,7 +134,7 @@ namespace ir {
          * @param astCaseStmt - const pointer to the ast case
          * @returns pointer to the irt case
         */
-        std::unique_ptr<ir::IRCaseStmt> 
+        ir::IRPtr<ir::IRCaseStmt> 
         transformCaseStmt(const syntax::ast::ASTCaseStmt* astCaseStmt);
 
         /**
@@ -142,7 +142,7 @@ namespace ir {
          * @param astDefaultStmt - const pointer to the ast default case
          * @returns pointer to the irt default case
         */
-        std::unique_ptr<ir::IRDefaultStmt> 
+        ir::IRPtr<ir::IRDefaultStmt> 
         transformDefaultStmt(const syntax::ast::ASTDefaultStmt* astDefaultStmt);
 
         /**
@@ -150,13 +150,16 @@ namespace ir {
          * @param astSwitchBlockStmt - const pointer to the ast switch-block
          * @returns pointer to the irt switch-block
         */
-        std::unique_ptr<ir::IRSwitchBlockStmt> 
+        ir::IRPtr<ir::IRSwitchBlockStmt> 
         transformSwitchBlockStmt(const syntax::ast::ASTSwitchBlockStmt* astSwitchBlockStmt);
 
     private:
         /// intermediate representation specialized for expressions
         ExpressionIntermediateRepresentation exprIR;
 
+        /// reference to a function context
+        ir::IRFunctionContext& ctx;
+
     };
 }
 
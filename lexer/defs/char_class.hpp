@@ -0,0 +1,69 @@
+#ifndef CHAR_CLASS_HPP
+#define CHAR_CLASS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace lex {
+    /**
+     * @namespace lex::char_class
+     * @brief bit flags describing the lexical class of a character
+    */
+    namespace char_class {
+        /// letters [a-z][A-Z]
+        constexpr uint8_t ALPHA{ 1 << 0 };
+
+        /// digits [0-9]
+        constexpr uint8_t DIGIT{ 1 << 1 };
+
+        /// underscore
+        constexpr uint8_t UNDERSCORE{ 1 << 2 };
+
+        /// whitespaces except the new line: ' ', \t, \v, \f, \r
+        constexpr uint8_t SPACE{ 1 << 3 };
+
+        /// new line
+        constexpr uint8_t NEWLINE{ 1 << 4 };
+
+        /// characters that can appear inside of an identifier
+        constexpr uint8_t IDENTIFIER{ ALPHA | DIGIT | UNDERSCORE };
+    }
+
+    /// maps every byte to its character class flags
+    constexpr std::array<uint8_t, 256> charClassTable{ []{
+        std::array<uint8_t, 256> table{};
+
+        for(size_t c = 'a'; c <= 'z'; ++c){
+            table[c] |= char_class::ALPHA;
+        }
+        for(size_t c = 'A'; c <= 'Z'; ++c){
+            table[c] |= char_class::ALPHA;
+        }
+        for(size_t c = '0'; c <= '9'; ++c){
+            table[c] |= char_class::DIGIT;
+        }
+
+        table['_'] |= char_class::UNDERSCORE;
+        table['\n'] |= char_class::NEWLINE;
+
+        for(unsigned char c : {' ', '\t', '\v', '\f', '\r'}){
+            table[c] |= char_class::SPACE;
+        }
+
+        return table;
+    }() };
+
+    /**
+     * @brief checks if the character belongs to any of the classes
+     * @param c - character
+     * @param classes - mask of the char_class flags
+     * @returns true if character belongs to at least one of the classes, false otherwise
+    */
+    inline constexpr bool hasCharClass(char c, uint8_t classes) noexcept {
+        return (charClassTable[static_cast<unsigned char>(c)] & classes) != 0;
+    }
+
+}
+
+#endif
@@ -0,0 +1,184 @@
+#ifndef KEYWORDS_HPP
+#define KEYWORDS_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "../../common/token/token_types.hpp"
+
+namespace lex {
+    /**
+     * @struct Keyword
+     * @brief describes the keyword of the language
+    */
+    struct Keyword {
+        /// spelling of the keyword in the source code, empty for unused slots
+        std::string_view spelling;
+
+        /// type of the token
+        syntax::TokenType type;
+
+        /// general type of the token
+        syntax::GeneralTokenType gtype;
+
+    };
+
+    /// keywords recognized by the lexer, new keywords of token_types.hpp are added here
+    constexpr std::array keywordTable{
+        Keyword{ "if",       syntax::TokenType::IF,       syntax::GeneralTokenType::OTHER },
+        Keyword{ "else",     syntax::TokenType::ELSE,     syntax::GeneralTokenType::OTHER },
+        Keyword{ "while",    syntax::TokenType::WHILE,    syntax::GeneralTokenType::OTHER },
+        Keyword{ "do",       syntax::TokenType::DO,       syntax::GeneralTokenType::OTHER },
+        Keyword{ "for",      syntax::TokenType::FOR,      syntax::GeneralTokenType::OTHER },
+        Keyword{ "return",   syntax::TokenType::RETURN,   syntax::GeneralTokenType::OTHER },
+        Keyword{ "switch",   syntax::TokenType::SWITCH,   syntax::GeneralTokenType::OTHER },
+        Keyword{ "case",     syntax::TokenType::CASE,     syntax::GeneralTokenType::OTHER },
+        Keyword{ "default",  syntax::TokenType::DEFAULT,  syntax::GeneralTokenType::OTHER },
+        Keyword{ "break",    syntax::TokenType::BREAK,    syntax::GeneralTokenType::OTHER },
+
+        Keyword{ "int",      syntax::TokenType::INT,      syntax::GeneralTokenType::TYPE },
+        Keyword{ "unsigned", syntax::TokenType::UNSIGNED, syntax::GeneralTokenType::TYPE },
+        Keyword{ "void",     syntax::TokenType::VOID,     syntax::GeneralTokenType::TYPE },
+        Keyword{ "auto",     syntax::TokenType::AUTO,     syntax::GeneralTokenType::TYPE },
+
+        Keyword{ "include",  syntax::TokenType::INCLUDE,  syntax::GeneralTokenType::OTHER }
+    };
+
+    /**
+     * @namespace lex::keyword_hash
+     * @brief building blocks of the keyword perfect hash
+    */
+    namespace keyword_hash {
+        /**
+         * @brief packs the characteristic characters of the word into the key
+         * @param word - word of at least 2 characters
+         * @returns key built from the length, first two and last character of the word
+        */
+        constexpr uint32_t keyOf(std::string_view word) noexcept {
+            return static_cast<uint32_t>(static_cast<unsigned char>(word[0]))
+                | static_cast<uint32_t>(static_cast<unsigned char>(word[1])) << 8
+                | static_cast<uint32_t>(static_cast<unsigned char>(word.back())) << 16
+                | static_cast<uint32_t>(word.size()) << 24;
+        }
+
+        /**
+         * @brief hashes the word into the slot
+         * @param seed - multiplier of the hash
+         * @param slotBits - number of bits of the slot index
+         * @param word - word of at least 2 characters
+         * @returns index of the slot
+        */
+        constexpr size_t slotOf(uint32_t seed, unsigned slotBits, std::string_view word) noexcept {
+            return static_cast<size_t>((keyOf(word) * seed) >> (32 - slotBits));
+        }
+
+        /**
+         * @brief searches for the multiplier that places every keyword into its own slot
+         * @tparam slotCount - number of slots, power of two
+         * @param keywords - table of the keywords
+         * @returns seed of the perfect hash
+        */
+        template<size_t slotCount, size_t N>
+        consteval uint32_t findSeed(const std::array<Keyword, N>& keywords) {
+            constexpr unsigned slotBits{ static_cast<unsigned>(std::countr_zero(slotCount)) };
+
+            for(uint32_t seed = 1; seed < (1u << 20); seed += 2){
+                std::array<bool, slotCount> taken{};
+                bool collision{ false };
+
+                for(const Keyword& keyword : keywords){
+                    const size_t slot{ slotOf(seed, slotBits, keyword.spelling) };
+                    if(taken[slot]){
+                        collision = true;
+                        break;
+                    }
+                    taken[slot] = true;
+                }
+
+                if(!collision){
+                    return seed;
+                }
+            }
+
+            throw "no perfect hash seed for the keyword table";
+        }
+    }
+
+    /**
+     * @class KeywordHash
+     * @brief perfect hash of the keyword table, generated at compile time
+     * @details multiplicative seed is searched for until no two keywords share a slot,
+     * so a lookup is one multiplication and one comparison
+     * @tparam keywords - table of the keywords, spellings have to be unique and at least 2 characters long
+    */
+    template<const auto& keywords>
+    class KeywordHash {
+    public:
+        /**
+         * @brief classifies the word
+         * @param word - sequence of identifier characters
+         * @returns keyword if word is one, nullopt otherwise
+        */
+        static constexpr std::optional<Keyword> find(std::string_view word) noexcept {
+            if(word.size() < minLength || word.size() > maxLength){
+                return std::nullopt;
+            }
+
+            const Keyword& candidate{ slots[keyword_hash::slotOf(seed, slotBits, word)] };
+            if(candidate.spelling != word){
+                return std::nullopt;
+            }
+            return candidate;
+        }
+
+    private:
+        /// number of slots, at least twice the number of keywords so the seed is found quickly
+        static constexpr size_t slotCount{ std::bit_ceil(keywords.size() * 2) };
+
+        /// number of bits of the slot index
+        static constexpr unsigned slotBits{ static_cast<unsigned>(std::countr_zero(slotCount)) };
+
+        /// multiplier of the perfect hash
+        static constexpr uint32_t seed{ keyword_hash::findSeed<slotCount>(keywords) };
+
+        /// keywords placed into their slots, empty spelling marks unused slot
+        static constexpr std::array<Keyword, slotCount> slots{ []{
+            std::array<Keyword, slotCount> table{};
+            for(const Keyword& keyword : keywords){
+                table[keyword_hash::slotOf(seed, slotBits, keyword.spelling)] = keyword;
+            }
+            return table;
+        }() };
+
+        /// length of the shortest keyword
+        static constexpr size_t minLength{ []{
+            size_t length{ keywords[0].spelling.size() };
+            for(const Keyword& keyword : keywords){
+                length = std::min(length, keyword.spelling.size());
+            }
+            return length;
+        }() };
+
+        /// length of the longest keyword
+        static constexpr size_t maxLength{ []{
+            size_t length{ 0 };
+            for(const Keyword& keyword : keywords){
+                length = std::max(length, keyword.spelling.size());
+            }
+            return length;
+        }() };
+
+        static_assert(minLength >= 2, "keyword hash reads the first two characters of the word");
+    };
+
+    /// perfect hash of the language keywords
+    using Keywords = KeywordHash<keywordTable>;
+
+}
+
+#endif
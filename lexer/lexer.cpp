@@ -1,40 +1,341 @@
 #include "lexer.hpp"
 
+#include <array>
 #include <format>
 #include <sstream>
-#include <cctype>
 #include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <latch>
+#include <deque>
+#include <unordered_map>
+
+#include "../preprocessor/preprocessor.hpp"
+#include "../thread-pool/task_group.hpp"
+
+namespace {
+    /// file of the library that was not tokenized
+    constexpr size_t notTokenized{ std::string_view::npos };
+
+    /**
+     * @brief orders the files depth first, every library is placed before the file that included it first
+     * @param fileIncludes - names of the libraries included by every file, in the order of the directives, source is the first file
+     * @param libraryFiles - maps the name of the library to its file, notTokenized for the libraries that are not tokenized
+     * @returns positions of the reachable files, source is the last one
+    */
+    std::vector<size_t> includeOrder(
+        const std::vector<std::span<const std::string_view>>& fileIncludes,
+        const std::unordered_map<std::string_view, size_t>& libraryFiles
+    ){
+        std::vector<size_t> order;
+        order.reserve(fileIncludes.size());
+        std::vector<char> visited(fileIncludes.size(), false);
+        std::vector<std::pair<size_t, size_t>> stack{ { 0, 0 } };
+        visited[0] = true;
+        while(!stack.empty()){
+            auto& [file, nextInclude]{ stack.back() };
+            if(nextInclude == fileIncludes[file].size()){
+                order.push_back(file);
+                stack.pop_back();
+                continue;
+            }
+
+            const auto library{ libraryFiles.find(fileIncludes[file][nextInclude++]) };
+            if(library != libraryFiles.end() && library->second != notTokenized && !visited[library->second]){
+                visited[library->second] = true;
+                stack.emplace_back(library->second, 0);
+            }
+        }
+        return order;
+    }
+}
 
-lex::Lexer::Lexer(const std::vector<std::string>& input) 
+lex::Lexer::Lexer(const std::vector<std::string_view>& input) 
     : input{ input }, nextTokenIdx{ 1 } {}
 
+lex::Lexer::Lexer(std::string_view source, preprocessing::Preprocessor& preprocessor)
+    : input{ source }, preprocessor{ &preprocessor }, fileIndex{ 0 }, nextTokenIdx{ 1 } {}
+
+lex::Lexer::~Lexer(){
+    finishStreaming();
+}
+
 void lex::Lexer::tokenize(){
+    if(preprocessor){
+        if(ring){
+            streamWithIncludes();
+        }
+        else {
+            tokenizeWithIncludes(nullptr);
+        }
+        return;
+    }
+
     const size_t fileCount{ input.size() };
 
     for (fileIndex = 0; fileIndex < fileCount; ++fileIndex) {
-        resetState();
+        tokenizeFile();
+    }
+
+    addEofToken();
+}
+
+void lex::Lexer::tokenize(util::concurrency::ThreadPool& threadPool){
+    if(preprocessor){
+        tokenizeWithIncludes(&threadPool);
+        return;
+    }
+
+    const size_t fileCount{ input.size() };
+    if(fileCount < 2){
+        tokenize();
+        return;
+    }
+
+    // each file is tokenized by its own lexer, so it has its own token and error buffer
+    std::vector<lex::Lexer> fileLexers;
+    fileLexers.reserve(fileCount);
+    for(size_t i = 0; i < fileCount; ++i){
+        fileLexers.emplace_back(input).fileIndex = i;
+    }
+
+    util::concurrency::parallelFor(threadPool, 0, fileCount, 1,
+        [&fileLexers](size_t i) -> void {
+            fileLexers[i].tokenizeFile();
+        }
+    );
+
+    size_t tokenCount{ 1 };
+    for(const auto& fileLexer : fileLexers){
+        tokenCount += fileLexer.tokens.size();
+    }
+    tokens.reserve(tokenCount);
+
+    // buffers are merged in file order, same order as serial tokenization produces
+    for(auto& fileLexer : fileLexers){
+        adoptSources(fileLexer);
+        tokens.insert(tokens.end(), fileLexer.tokens.begin(), fileLexer.tokens.end());
+        lexicalErrors.insert(
+            lexicalErrors.end(),
+            std::make_move_iterator(fileLexer.lexicalErrors.begin()),
+            std::make_move_iterator(fileLexer.lexicalErrors.end())
+        );
+    }
 
-        while (position < fileLength) {
+    sourceId = fileLexers.back().sourceId;
+    addEofToken();
+}
+
+void lex::Lexer::tokenizeWithIncludes(util::concurrency::ThreadPool* threadPool){
+    // file lexers of the source and of the libraries, deque keeps them in place while it grows
+    std::deque<lex::Lexer> fileLexers;
+    fileLexers.emplace_back(input.front(), *preprocessor);
+
+    // maps the name of the library to its file lexer, notTokenized for libraries that are not tokenized
+    std::unordered_map<std::string_view, size_t> libraryFiles;
+
+    // every round tokenizes the libraries first included by the files of the previous round
+    size_t roundBegin{ 0 };
+    while(roundBegin < fileLexers.size()){
+        const size_t roundEnd{ fileLexers.size() };
+
+        if(threadPool && roundEnd - roundBegin > 1){
+            util::concurrency::parallelFor(*threadPool, roundBegin, roundEnd, 1,
+                [&fileLexers](size_t i) -> void {
+                    fileLexers[i].tokenizeFile();
+                }
+            );
+        }
+        else {
+            for(size_t i{ roundBegin }; i < roundEnd; ++i){
+                fileLexers[i].tokenizeFile();
+            }
+        }
+
+        // libraries were requested during tokenization, their loading overlapped it
+        for(size_t i{ roundBegin }; i < roundEnd; ++i){
+            for(const auto libName : fileLexers[i].includes){
+                if(libraryFiles.contains(libName)){
+                    continue;
+                }
+
+                const auto library{ preprocessor->getSource(libName) };
+                libraryFiles.emplace(libName, library ? fileLexers.size() : notTokenized);
+                if(library){
+                    fileLexers.emplace_back(*library, *preprocessor);
+                }
+            }
+        }
+
+        roundBegin = roundEnd;
+    }
+
+    // depth first, every library is placed before the file that included it first
+    std::vector<std::span<const std::string_view>> fileIncludes;
+    fileIncludes.reserve(fileLexers.size());
+    for(const auto& fileLexer : fileLexers){
+        fileIncludes.emplace_back(fileLexer.includes);
+    }
+    const std::vector<size_t> order{ includeOrder(fileIncludes, libraryFiles) };
+
+    size_t tokenCount{ 1 };
+    for(const auto& fileLexer : fileLexers){
+        tokenCount += fileLexer.tokens.size();
+    }
+    tokens.reserve(tokenCount);
+
+    input.clear();
+    for(const size_t file : order){
+        auto& fileLexer{ fileLexers[file] };
+        input.push_back(fileLexer.input.front());
+        adoptSources(fileLexer);
+        tokens.insert(tokens.end(), fileLexer.tokens.begin(), fileLexer.tokens.end());
+        lexicalErrors.insert(
+            lexicalErrors.end(),
+            std::make_move_iterator(fileLexer.lexicalErrors.begin()),
+            std::make_move_iterator(fileLexer.lexicalErrors.end())
+        );
+    }
 
-            if(handleNewline()) continue;
-            if(handleWhitespace()) continue;
-            if(handleIdentifier()) continue;
-            if(handleNumber()) continue;
-            if(handleComment()) continue;
-            if(handleOperator()) continue;
-            if(handlePunctuation()) continue;
+    // source is the last file, eof points past its end
+    sourceId = fileLexers.front().sourceId;
+    addEofToken();
+}
+
+void lex::Lexer::streamWithIncludes(){
+    fileIndex = 0;
+    tokenizeFile();
+    const uint16_t sourceSourceId{ sourceId };
+
+    // range of the includes every file added, in the order of the input
+    std::vector<std::pair<size_t, size_t>> includeRanges{ { 0, includes.size() } };
+
+    // maps the name of the library to its file, notTokenized for libraries that are not tokenized
+    std::unordered_map<std::string_view, size_t> libraryFiles;
 
-            handleInvalid();
+    // includes grow while the libraries are tokenized, nested libraries are streamed after the ones including them
+    for(size_t i{ 0 }; i < includes.size() && !ring->isClosed(); ++i){
+        if(libraryFiles.contains(includes[i])){
+            continue;
+        }
+
+        const auto library{ preprocessor->getSource(includes[i]) };
+        libraryFiles.emplace(includes[i], library ? input.size() : notTokenized);
+        if(library){
+            input.push_back(*library);
+            fileIndex = input.size() - 1;
+            const size_t includesBegin{ includes.size() };
+            tokenizeFile();
+            includeRanges.emplace_back(includesBegin, includes.size());
         }
     }
 
-    addToken("", line, column(), syntax::TokenType::_EOF);
+    // libraries skipped by the closed ring are still loaded, so their errors are reported
+    preprocessor->wait();
+
+    // files are put in the order they have without streaming, source is the last one, eof points past its end
+    std::vector<std::span<const std::string_view>> fileIncludes;
+    fileIncludes.reserve(includeRanges.size());
+    for(const auto& [begin, end] : includeRanges){
+        fileIncludes.emplace_back(includes.data() + begin, end - begin);
+    }
+    const std::vector<size_t> order{ includeOrder(fileIncludes, libraryFiles) };
+
+    std::vector<std::string_view> orderedInput;
+    std::vector<util::io::SourceRegistration> orderedSources;
+    orderedInput.reserve(order.size());
+    orderedSources.reserve(order.size());
+    for(const size_t file : order){
+        orderedInput.push_back(input[file]);
+        orderedSources.push_back(std::move(sources[file]));
+    }
+    input = std::move(orderedInput);
+    sources = std::move(orderedSources);
+
+    sourceId = sourceSourceId;
+    addEofToken();
+}
+
+void lex::Lexer::startStreaming(util::concurrency::ThreadPool& threadPool, size_t ringCapacity){
+    ring = std::make_unique<lex::TokenRing>(ringCapacity);
+    releaseBatch = std::max<size_t>(1, ringCapacity / 4);
+    producerDone = std::make_unique<std::latch>(1);
+
+    threadPool.enqueue(
+        [this] -> void {
+            tokenize();
+            ring->finish();
+            producerDone->count_down();
+        }
+    );
+}
+
+void lex::Lexer::finishStreaming() noexcept {
+    if(!producerDone){
+        return;
+    }
+
+    ring->close();
+    producerDone->wait();
+    producerDone.reset();
+}
+
+void lex::Lexer::tokenizeFile(){
+    resetState();
+
+    while (position < fileLength) {
+        // consumer stopped reading the stream, rest of the input is irrelevant
+        if(ring && ring->isClosed()) return;
+
+        if(handleNewline()) continue;
+        if(handleWhitespace()) continue;
+        if(handleIdentifier()) continue;
+        if(handleNumber()) continue;
+        if(handleComment()) continue;
+        if(handleOperator()) continue;
+        if(handlePunctuation()) continue;
+
+        handleInvalid();
+    }
+}
+
+void lex::Lexer::adoptSources(lex::Lexer& fileLexer){
+    sources.insert(
+        sources.end(),
+        std::make_move_iterator(fileLexer.sources.begin()),
+        std::make_move_iterator(fileLexer.sources.end())
+    );
+    fileLexer.sources.clear();
+}
+
+void lex::Lexer::addEofToken(){
+    // eof token points past the end of the last file, so its position decodes to the end of the input
+    if(input.empty()){
+        sourceId = util::io::SourceRegistry::noSource;
+        addToken("", syntax::TokenType::_EOF);
+    }
+    else{
+        addToken(input.back().substr(input.back().length()), syntax::TokenType::_EOF);
+    }
 }
 
 bool lex::Lexer::completedTokenization() const noexcept {
     return tokens.size() > 0 && tokens.back().type == syntax::TokenType::_EOF;
 }
 
+std::span<const syntax::Token> lex::Lexer::getTokens() const noexcept {
+    return tokens;
+}
+
+std::vector<uint16_t> lex::Lexer::getSourceOrder() const {
+    std::vector<uint16_t> sourceIds;
+    sourceIds.reserve(sources.size());
+    for(const auto& source : sources){
+        sourceIds.push_back(source.getSourceId());
+    }
+    return sourceIds;
+}
+
 bool lex::Lexer::hasErrors() const noexcept {
     return !lexicalErrors.empty();
 }
@@ -54,14 +355,39 @@ std::string lex::Lexer::getErrors() const noexcept {
 
 void lex::Lexer::addToken(
     std::string_view val, 
-    size_t lineNumber, 
-    size_t col, 
     syntax::TokenType type, 
     syntax::GeneralTokenType gtype
 ){
-    tokens.emplace_back(
-        syntax::Token{ val, lineNumber, col, type, gtype }
-    );
+    const syntax::Token token{ val, sourceId, type, gtype };
+    previousType = type;
+
+    if(preprocessor){
+        trackInclude(val, type);
+    }
+
+    if(ring){
+        ring->push(token);
+        return;
+    }
+    tokens.push_back(token);
+}
+
+void lex::Lexer::trackInclude(std::string_view value, syntax::TokenType type){
+    // DIR : HASH INCLUDE COLON ID
+    constexpr std::array<syntax::TokenType, 4> directive{
+        syntax::TokenType::HASH, syntax::TokenType::INCLUDE, syntax::TokenType::COLON, syntax::TokenType::ID
+    };
+
+    if(type != directive[includeProgress]){
+        includeProgress = type == syntax::TokenType::HASH ? 1 : 0;
+        return;
+    }
+
+    if(++includeProgress == directive.size()){
+        includeProgress = 0;
+        includes.push_back(value);
+        preprocessor->include(value);
+    }
 }
 
 void lex::Lexer::handleError(std::string_view msg, size_t lineNumber, size_t col){
@@ -85,8 +411,8 @@ bool lex::Lexer::handleWhitespace() noexcept {
     char c{ getRelativeChar() };
     assert(c != '\n');
 
-    if(std::isspace(static_cast<unsigned char>(c))){
-        advance();
+    if(isWhitespace(c)){
+        advanceTo(scan::skipWhitespace(input[fileIndex], position));
         return true;
     }
     return false;
@@ -98,26 +424,21 @@ bool lex::Lexer::handleIdentifier(){
     }
 
     size_t start{ position };
-    size_t col{ column() };
-    while(isValidIndex() && isIdentifierSequence(getRelativeChar())){
-        advance();
-    }
+    advanceTo(scan::skipIdentifier(input[fileIndex], position));
 
     std::string_view value{ getSequence(start, sequenceLength(start)) };
 
-    if(!handleKeyword(value, line, col)){
-        tokens.emplace_back(syntax::Token{
-            value, line, col, syntax::TokenType::ID, syntax::GeneralTokenType::VALUE
-        });
+    if(!handleKeyword(value)){
+        addToken(value, syntax::TokenType::ID, syntax::GeneralTokenType::VALUE);
     }
 
     return true;
 }
 
-bool lex::Lexer::handleKeyword(std::string_view keyword, size_t lineNumber, size_t col){
+bool lex::Lexer::handleKeyword(std::string_view keyword){
     if(auto optKwd{ tryGetKeyword(keyword) }){
         auto [type, gtype]{ *optKwd };
-        addToken(keyword, lineNumber, col, type, gtype);
+        addToken(keyword, type, gtype);
         return true;
     }
 
@@ -130,16 +451,13 @@ bool lex::Lexer::handleNumber(){
         return false;
     }
 
-    size_t col{ column() };
     size_t start{ position };
 
     if(sign){
         advance();
     }
 
-    while(isValidIndex() && isDigit(getRelativeChar())){
-        advance();
-    }
+    advanceTo(scan::skipDigits(input[fileIndex], position));
 
     if(isValidIndex() && getRelativeChar() == 'u'){
         advance();
@@ -151,8 +469,6 @@ bool lex::Lexer::handleNumber(){
 
     addToken(
         getSequence(start, sequenceLength(start)),
-        line,
-        col,
         syntax::TokenType::LITERAL,
         syntax::GeneralTokenType::VALUE
     );
@@ -178,9 +494,7 @@ bool lex::Lexer::handleSingleLineComment() noexcept {
     }
 
     advance(2);
-    while (isValidIndex() && !isNewLine(getRelativeChar())){
-        advance();
-    }
+    advanceTo(scan::findNewline(input[fileIndex], position));
 
     return true;
 }
@@ -195,6 +509,12 @@ bool lex::Lexer::handleMultiLineComment(){
 
     advance(2);
     while(isValidIndex(1)){
+        // jumps to the next '*' or new line, the last character is never consumed by the body
+        advanceTo(std::min(scan::findCommentStop(input[fileIndex], position), fileLength - 1));
+        if(!isValidIndex(1)){
+            break;
+        }
+
         if(isMultiLineCommentEnd()){
             advance(2);
             return true;
@@ -283,10 +603,8 @@ bool lex::Lexer::handleArithmeticOperator(){
 }
 
 void lex::Lexer::emitOperator(lex::Lexeme operatorLexeme, syntax::GeneralTokenType gtype){
-    addToken(getRelativeSequence(
-        operatorLexeme.length), 
-        line, 
-        column(), 
+    addToken(
+        getRelativeSequence(operatorLexeme.length), 
         operatorLexeme.type, 
         gtype
     );
@@ -294,38 +612,37 @@ void lex::Lexer::emitOperator(lex::Lexeme operatorLexeme, syntax::GeneralTokenTy
 }
 
 bool lex::Lexer::handlePunctuation(){
-    size_t col{ column() };
     switch(getRelativeChar()){
         case '(': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::LPAREN); 
+            addToken(getRelativeSequence(1), syntax::TokenType::LPAREN); 
             break;
 
         case ')': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::RPAREN); 
+            addToken(getRelativeSequence(1), syntax::TokenType::RPAREN); 
             break;
 
         case '{': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::LBRACE); 
+            addToken(getRelativeSequence(1), syntax::TokenType::LBRACE); 
             break;
 
         case '}': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::RBRACE); 
+            addToken(getRelativeSequence(1), syntax::TokenType::RBRACE); 
             break;
 
         case ',': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::COMMA); 
+            addToken(getRelativeSequence(1), syntax::TokenType::COMMA); 
             break;
 
         case ';': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::SEMICOLON); 
+            addToken(getRelativeSequence(1), syntax::TokenType::SEMICOLON); 
             break;
 
         case ':': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::COLON); 
+            addToken(getRelativeSequence(1), syntax::TokenType::COLON); 
             break;
 
         case '#': 
-            addToken(getRelativeSequence(1), line, col, syntax::TokenType::HASH); 
+            addToken(getRelativeSequence(1), syntax::TokenType::HASH); 
             break;
 
         default: 
@@ -345,6 +662,6 @@ void lex::Lexer::handleInvalid(){
         line, 
         col
     );
-    addToken(getRelativeSequence(1), line, col, syntax::TokenType::INVALID);
+    addToken(getRelativeSequence(1), syntax::TokenType::INVALID);
     advance();
 }
@@ -1,14 +1,28 @@
 #ifndef LEXER_HPP
 #define LEXER_HPP
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 #include <string_view>
 #include <optional>
+#include <memory>
+#include <latch>
 
 #include "../common/token/token.hpp"
+#include "../common/source/source_registry.hpp"
 #include "defs/lexeme.hpp"
+#include "defs/char_class.hpp"
+#include "defs/keywords.hpp"
+#include "scan/scan_kernels.hpp"
+#include "stream/token_ring.hpp"
+#include "../thread-pool/thread_pool.hpp"
+
+namespace preprocessing {
+    class Preprocessor;
+}
 
 /**
  * @namespace lex
@@ -23,35 +37,97 @@ namespace lex {
     public:
         /** 
          * @brief Creates the instance of the lexer
-         * @param input - source code that needs to be tokenized
+         * @param input - views of the source code that needs to be tokenized, have to outlive the tokens
+        */
+        Lexer(const std::vector<std::string_view>& input);
+
+        /**
+         * @brief Creates the instance of the lexer that resolves the include directives
+         * @param source - view of the source code that needs to be tokenized, has to outlive the tokens
+         * @param preprocessor - reference to the preprocessor the included libraries are requested from
+         * @details library is requested as soon as its include directive is tokenized,
+         * tokens of the library precede the tokens of the file that included it first
         */
-        Lexer(const std::vector<std::string>& input);
+        Lexer(std::string_view source, preprocessing::Preprocessor& preprocessor);
+
+        /**
+         * @brief waits for the streaming producer, if there is one
+        */
+        ~Lexer();
+
+        /// deleted copy constructor
+        Lexer(const Lexer&) = delete;
+
+        /// deleted copy assignment operator
+        Lexer& operator=(const Lexer&) = delete;
+
+        /// move constructor
+        Lexer(Lexer&&) noexcept = default;
+
+        /// deleted move assignment operator
+        Lexer& operator=(Lexer&&) = delete;
 
         /**
          * @brief translating input into a sequence of tokens
         */
         void tokenize();
 
+        /**
+         * @brief translating input into a sequence of tokens, files are tokenized concurrently
+         * @param threadPool - thread pool on which files are tokenized
+         * @details every file is tokenized into its own buffer, buffers are merged in file order,
+         * so tokens and errors are the same as with serial tokenization,
+         * included libraries are tokenized as soon as the files including them are
+        */
+        void tokenize(util::concurrency::ThreadPool& threadPool);
+
+        /**
+         * @brief starts tokenization on the thread pool, tokens are streamed through a bounded ring
+         * @param threadPool - thread pool on which the lexer runs
+         * @param ringCapacity - number of tokens buffered between the lexer and the parser
+         * @details next(), peek() and current() read from the ring, so parsing overlaps with lexing,
+         * errors can be read only after finishStreaming(),
+         * tokens of the included libraries follow the source, in the order the libraries were included
+        */
+        void startStreaming(util::concurrency::ThreadPool& threadPool, size_t ringCapacity = defaultRingCapacity);
+
+        /**
+         * @brief abandons the rest of the stream and waits until the lexer stops
+        */
+        void finishStreaming() noexcept;
+
         /**
          * @brief increases nextTokenIdx
         */
         inline void next() noexcept {
             ++nextTokenIdx;
+
+            // tokens before the current one are not read again, producer may reuse their slots
+            if(ring && nextTokenIdx - 1 - releasedTokens >= releaseBatch){
+                releasedTokens = nextTokenIdx - 1;
+                ring->release(releasedTokens);
+            }
         }
 
         /**
          * @brief gets the token that is next in line for parsing
-         * @returns const reference of the next token
+         * @returns copy of the next token
         */
-        inline const syntax::Token& peek() const noexcept {
+        inline syntax::Token peek() const noexcept {
+            if(ring){
+                return ring->at(nextTokenIdx);
+            }
             return nextTokenIdx >= tokens.size() ? tokens.back() : tokens[nextTokenIdx];
         }
 
         /**
          * @brief gets the token that should be parsed at the moment
-         * @returns const reference of the current token
+         * @returns copy of the current token
         */
-        inline const syntax::Token& current() const noexcept {
+        inline syntax::Token current() const noexcept {
+            if(ring){
+                return ring->at(nextTokenIdx - 1);
+            }
             return nextTokenIdx >= tokens.size() ? tokens.back() : tokens[nextTokenIdx - 1];
         }
 
@@ -61,6 +137,20 @@ namespace lex {
         */
         bool completedTokenization() const noexcept;
 
+        /**
+         * @brief getter for the tokens of the input
+         * @returns view of all tokens, ending with eof
+         * @note valid only after tokenize()
+        */
+        std::span<const syntax::Token> getTokens() const noexcept;
+
+        /**
+         * @brief getter for the ids of the tokenized files
+         * @returns source ids of the files, every library precedes the file that included it first, source is the last one
+         * @note valid only after tokenization, streamed files are ordered the same as the tokenized ones
+        */
+        std::vector<uint16_t> getSourceOrder() const;
+
         /** 
          * @brief checks if any lexical error has been caught
          * @returns false if there are no lexical errors, true otherwise
@@ -74,8 +164,17 @@ namespace lex {
         std::string getErrors() const noexcept;
 
     private:
-        /// code that needs to be tokenized
-        const std::vector<std::string>& input;
+        /// views of the code that needs to be tokenized
+        std::vector<std::string_view> input;
+
+        /// preprocessor the included libraries are requested from, null if includes are not resolved
+        preprocessing::Preprocessor* preprocessor{ nullptr };
+
+        /// names of the libraries included by the tokenized files, in the order of the directives
+        std::vector<std::string_view> includes;
+
+        /// number of leading tokens of the include directive matched so far
+        uint8_t includeProgress{ 0 };
         
         /// index of the current file
         size_t fileIndex;
@@ -83,13 +182,22 @@ namespace lex {
         // length of the current file
         size_t fileLength;
 
+        /// id under which the current file is registered in the source registry
+        uint16_t sourceId;
+
+        /// registrations of the tokenized files, tokens decode their positions only while the lexer lives
+        std::vector<util::io::SourceRegistration> sources;
+
+        /// type of the previous token in the current file
+        std::optional<syntax::TokenType> previousType;
+
         /// current position in the input
         size_t position;
 
         /// current line in the input
         size_t line;
 
-        /// position at which previous line ended, used to determine the column of a token: column = position - prevLineLen
+        /// position at which previous line ended, used to determine the column of an error: column = position - prevLineLen
         size_t prevLineLen;
 
         /// index of a token that should be processed by the parser next
@@ -98,20 +206,76 @@ namespace lex {
         /// vector of lexical errors
         std::vector<std::string> lexicalErrors;
 
+        /// default number of tokens buffered in streaming mode
+        static constexpr size_t defaultRingCapacity{ 4096 };
+
+        /// ring between the lexer and the parser, null unless streaming
+        std::unique_ptr<TokenRing> ring;
+
+        /// released when the streaming producer stops
+        std::unique_ptr<std::latch> producerDone;
+
+        /// number of tokens released back to the producer
+        size_t releasedTokens{ 0 };
+
+        /// number of consumed tokens after which they are released in one go
+        size_t releaseBatch{ 1 };
+
     protected:
         /// vector of tokens generated from the input
         std::vector<syntax::Token> tokens;
 
     private:
 
+        /**
+         * @brief tokenizes the file at fileIndex, eof token is not added
+        */
+        void tokenizeFile();
+
+        /**
+         * @brief adds the eof token after the last file
+        */
+        void addEofToken();
+
+        /**
+         * @brief takes over the source registrations of the file lexer, its tokens are merged into this lexer
+         * @param fileLexer - reference to the lexer of a single file
+        */
+        void adoptSources(Lexer& fileLexer);
+
+        /**
+         * @brief tokenizes the source and the libraries it includes into per file buffers
+         * @param threadPool - thread pool on which files are tokenized, null for the calling thread
+         * @details buffers are merged so every library precedes the file that included it first,
+         * same order the source would have with the libraries spliced in front of it
+        */
+        void tokenizeWithIncludes(util::concurrency::ThreadPool* threadPool);
+
+        /**
+         * @brief tokenizes the source and then the libraries in the order they were included
+         * @details used while streaming, tokens already in the ring can't be preceded by the libraries,
+         * files are reordered afterwards, so getSourceOrder() is the same as without streaming
+        */
+        void streamWithIncludes();
+
+        /**
+         * @brief matches the token against the include directive, requests the library once the name is matched
+         * @param value - value of the token
+         * @param type - type of the token
+        */
+        void trackInclude(std::string_view value, syntax::TokenType type);
+
         /**
          * @brief resets the lexer state for currently processed file
          */
-        inline void resetState() noexcept {
+        inline void resetState(){
             position = 0;
             line = 1;
             prevLineLen = 0;
             fileLength = input[fileIndex].length();
+            sourceId = sources.emplace_back(input[fileIndex]).getSourceId();
+            previousType.reset();
+            includeProgress = 0;
         }
 
         /**
@@ -177,6 +341,14 @@ namespace lex {
             position += n;
         }
 
+        /**
+         * @brief moves the position forward to the end of a scanned run
+         * @param runEnd - position returned by one of the scan kernels
+        */
+        inline void advanceTo(size_t runEnd) noexcept {
+            position = runEnd;
+        }
+
         /**
          * @brief increments position, increments lineNumber and sets prevLineLen to position
         */
@@ -188,16 +360,12 @@ namespace lex {
 
         /**
          * @brief creates a new token
-         * @param val - value of the token
-         * @param lineNumber - line where token starts
-         * @param column - column where token starts
+         * @param val - value of the token, view into the current file
          * @param type - type of the token
          * @param gtype - general type of the token, defaults to GeneralTokenType::OTHER
         */
         void addToken(
             std::string_view val, 
-            size_t lineNumber, 
-            size_t col, 
             syntax::TokenType type, 
             syntax::GeneralTokenType gtype = syntax::GeneralTokenType::OTHER
         );
@@ -231,11 +399,9 @@ namespace lex {
         /**
          * @brief handles keywords
          * @param keyword - identifier of the keyword
-         * @param lineNumber - line where keyword appears
-         * @param col - column where keyword starts
          * @returns true if sequence is a keyword, false otherwise
         */
-        bool handleKeyword(std::string_view keyword, size_t lineNumber, size_t col);
+        bool handleKeyword(std::string_view keyword);
 
         /**
          * @brief handles numbers, updates position
@@ -326,117 +492,9 @@ namespace lex {
         */
         inline std::optional<std::pair<syntax::TokenType, syntax::GeneralTokenType>> 
         tryGetKeyword(std::string_view value) const noexcept {
-            const size_t length{ value.size() };
-            if(length < 2 || length > 8){
-                return std::nullopt;
+            if(auto keyword{ Keywords::find(value) }){
+                return std::make_pair(keyword->type, keyword->gtype);
             }
-
-            switch(length){
-                case 2:
-                    if(value == "if") 
-                        return std::make_pair(
-                            syntax::TokenType::IF, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "do")
-                        return std::make_pair(
-                            syntax::TokenType::DO, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-                    break;
-
-                case 3:
-                    if(value == "for")
-                        return std::make_pair(
-                            syntax::TokenType::FOR, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "int")
-                        return std::make_pair(
-                            syntax::TokenType::INT, 
-                            syntax::GeneralTokenType::TYPE
-                        );
-                    break;
-
-                case 4:
-                    if(value == "else")
-                        return std::make_pair(
-                            syntax::TokenType::ELSE, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "case")
-                        return std::make_pair(
-                            syntax::TokenType::CASE, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "void")
-                        return std::make_pair(
-                            syntax::TokenType::VOID, 
-                            syntax::GeneralTokenType::TYPE
-                        );
-
-                    if(value == "auto")
-                        return std::make_pair(
-                            syntax::TokenType::AUTO, 
-                            syntax::GeneralTokenType::TYPE
-                        );
-                    break;
-
-                case 5:
-                    if(value == "while")
-                        return std::make_pair(
-                            syntax::TokenType::WHILE, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "break")
-                        return std::make_pair(
-                            syntax::TokenType::BREAK, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-                    break;
-
-                case 6:
-                    if(value == "return")
-                        return std::make_pair(
-                            syntax::TokenType::RETURN, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "switch")
-                        return std::make_pair(
-                            syntax::TokenType::SWITCH, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-                    break;
-
-                case 7:
-                    if(value == "default")
-                        return std::make_pair(
-                            syntax::TokenType::DEFAULT, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-
-                    if(value == "include")
-                        return std::make_pair(
-                            syntax::TokenType::INCLUDE, 
-                            syntax::GeneralTokenType::OTHER
-                        );
-                    break;
-
-                case 8:
-                    if(value == "unsigned")
-                        return std::make_pair(
-                            syntax::TokenType::UNSIGNED, 
-                            syntax::GeneralTokenType::TYPE
-                        );
-                    break;
-            }
-
             return std::nullopt;
         }
 
@@ -468,7 +526,8 @@ namespace lex {
             if(!isValidIndex(1)) return false;
             if(!isDigit(getChar(position + 1))) return false;
 
-            return !tokens.empty() && canPrecedeSignedLiteral(tokens.back().type);
+            // tokens of the previous files are not considered, so files can be tokenized independently
+            return previousType && canPrecedeSignedLiteral(*previousType);
         }
 
         /** 
@@ -629,7 +688,7 @@ namespace lex {
          * @returns true if character is a part of id sequence, false otherwise
         */
         inline constexpr bool isIdentifierSequence(char c) const noexcept {
-            return isAlpha(c) || isDigit(c) || c == '_';
+            return hasCharClass(c, char_class::IDENTIFIER);
         }
 
         /**
@@ -638,7 +697,7 @@ namespace lex {
          * @returns true if character is a letter, false otherwise
         */
         inline constexpr bool isAlpha(char c) const noexcept {
-            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            return hasCharClass(c, char_class::ALPHA);
         }
 
         /**
@@ -647,7 +706,7 @@ namespace lex {
          * @returns true if character is a digit, false otherwise
         */
         inline constexpr bool isDigit(char c) const noexcept {
-            return c >= '0' && c <= '9';
+            return hasCharClass(c, char_class::DIGIT);
         }
 
         /**
@@ -680,9 +739,18 @@ namespace lex {
          * @returns true if character is a new line, false otherwise
         */
         inline bool isNewLine(char c) const noexcept {
-            return c == '\n';
+            return hasCharClass(c, char_class::NEWLINE);
         };
 
+        /**
+         * @brief checks if the character is a whitespace other than the new line
+         * @param c - current character
+         * @returns true if character is a whitespace, false otherwise
+        */
+        inline bool isWhitespace(char c) const noexcept {
+            return hasCharClass(c, char_class::SPACE);
+        }
+
     };
 
 }
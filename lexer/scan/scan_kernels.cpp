@@ -0,0 +1,264 @@
+#include "scan_kernels.hpp"
+
+#include <cstdint>
+
+#include "../defs/char_class.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+    /**
+     * @enum Run
+     * @brief kinds of character runs the kernels skip
+    */
+    enum class Run {
+        WHITESPACE,     //< whitespaces except the new line
+        IDENTIFIER,     //< letters, digits and underscores
+        DIGITS,         //< digits
+        LINE,           //< everything up to the new line
+        COMMENT_BODY    //< everything up to '*' or the new line
+    };
+
+    /// signature shared by all kernels: data, start position, size -> end of the run
+    using Kernel = size_t (*)(const char*, size_t, size_t) noexcept;
+
+    /**
+     * @struct Kernels
+     * @brief set of kernels implemented with the same instruction set
+    */
+    struct Kernels {
+        Kernel whitespace;
+        Kernel identifier;
+        Kernel digits;
+        Kernel line;
+        Kernel commentBody;
+        std::string_view name;
+    };
+
+    /**
+     * @brief checks if the character continues the run
+     * @param c - character
+     * @returns true if character belongs to the run, false otherwise
+    */
+    template<Run run>
+    constexpr bool continuesRun(char c) noexcept {
+        if constexpr(run == Run::WHITESPACE){
+            return lex::hasCharClass(c, lex::char_class::SPACE);
+        }
+        else if constexpr(run == Run::IDENTIFIER){
+            return lex::hasCharClass(c, lex::char_class::IDENTIFIER);
+        }
+        else if constexpr(run == Run::DIGITS){
+            return lex::hasCharClass(c, lex::char_class::DIGIT);
+        }
+        else if constexpr(run == Run::LINE){
+            return c != '\n';
+        }
+        else {
+            return c != '\n' && c != '*';
+        }
+    }
+
+    template<Run run>
+    size_t scanScalar(const char* data, size_t position, size_t size) noexcept {
+        while(position < size && continuesRun<run>(data[position])){
+            ++position;
+        }
+        return position;
+    }
+
+#if defined(__x86_64__)
+    // range checks are moved into the signed domain, since SSE2/AVX2 only compare signed bytes:
+    // c in [low, low + count) <=> (int8_t)(c - low - 128) < -128 + count
+
+    inline __m128i inRange128(__m128i chunk, char low, char count) noexcept {
+        const __m128i shifted{ _mm_add_epi8(chunk, _mm_set1_epi8(static_cast<char>(-128 - low))) };
+        return _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + count)));
+    }
+
+    /**
+     * @brief marks bytes of the chunk that end the run
+     * @param chunk - 16 bytes of the input
+     * @returns bit mask, bit i is set if byte i ends the run
+    */
+    template<Run run>
+    inline uint32_t runEnds128(__m128i chunk) noexcept {
+        if constexpr(run == Run::WHITESPACE){
+            const __m128i space{ _mm_or_si128(
+                _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                _mm_or_si128(
+                    inRange128(chunk, '\t', 1),
+                    inRange128(chunk, '\v', 3)
+                )
+            ) };
+            return ~static_cast<uint32_t>(_mm_movemask_epi8(space)) & 0xFFFFu;
+        }
+        else if constexpr(run == Run::IDENTIFIER){
+            const __m128i lower{ _mm_or_si128(chunk, _mm_set1_epi8(0x20)) };
+            const __m128i identifier{ _mm_or_si128(
+                _mm_or_si128(inRange128(lower, 'a', 26), inRange128(chunk, '0', 10)),
+                _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'))
+            ) };
+            return ~static_cast<uint32_t>(_mm_movemask_epi8(identifier)) & 0xFFFFu;
+        }
+        else if constexpr(run == Run::DIGITS){
+            return ~static_cast<uint32_t>(_mm_movemask_epi8(inRange128(chunk, '0', 10))) & 0xFFFFu;
+        }
+        else if constexpr(run == Run::LINE){
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))));
+        }
+        else {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(
+                _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')),
+                _mm_cmpeq_epi8(chunk, _mm_set1_epi8('*'))
+            )));
+        }
+    }
+
+    template<Run run>
+    size_t scanSse2(const char* data, size_t position, size_t size) noexcept {
+        while(position + 16 <= size){
+            const __m128i chunk{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position)) };
+            if(uint32_t ends{ runEnds128<run>(chunk) }; ends != 0){
+                return position + static_cast<size_t>(__builtin_ctz(ends));
+            }
+            position += 16;
+        }
+        return scanScalar<run>(data, position, size);
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256i inRange256(__m256i chunk, char low, char count) noexcept {
+        const __m256i shifted{ _mm256_add_epi8(chunk, _mm256_set1_epi8(static_cast<char>(-128 - low))) };
+        return _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + count)), shifted);
+    }
+
+    /**
+     * @brief marks bytes of the chunk that end the run
+     * @param chunk - 32 bytes of the input
+     * @returns bit mask, bit i is set if byte i ends the run
+    */
+    template<Run run>
+    __attribute__((target("avx2")))
+    inline uint32_t runEnds256(__m256i chunk) noexcept {
+        if constexpr(run == Run::WHITESPACE){
+            const __m256i space{ _mm256_or_si256(
+                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')),
+                _mm256_or_si256(
+                    inRange256(chunk, '\t', 1),
+                    inRange256(chunk, '\v', 3)
+                )
+            ) };
+            return ~static_cast<uint32_t>(_mm256_movemask_epi8(space));
+        }
+        else if constexpr(run == Run::IDENTIFIER){
+            const __m256i lower{ _mm256_or_si256(chunk, _mm256_set1_epi8(0x20)) };
+            const __m256i identifier{ _mm256_or_si256(
+                _mm256_or_si256(inRange256(lower, 'a', 26), inRange256(chunk, '0', 10)),
+                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_'))
+            ) };
+            return ~static_cast<uint32_t>(_mm256_movemask_epi8(identifier));
+        }
+        else if constexpr(run == Run::DIGITS){
+            return ~static_cast<uint32_t>(_mm256_movemask_epi8(inRange256(chunk, '0', 10)));
+        }
+        else if constexpr(run == Run::LINE){
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'))));
+        }
+        else {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(
+                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')),
+                _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('*'))
+            )));
+        }
+    }
+
+    template<Run run>
+    __attribute__((target("avx2")))
+    size_t scanAvx2(const char* data, size_t position, size_t size) noexcept {
+        while(position + 32 <= size){
+            const __m256i chunk{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position)) };
+            if(uint32_t ends{ runEnds256<run>(chunk) }; ends != 0){
+                return position + static_cast<size_t>(__builtin_ctz(ends));
+            }
+            position += 32;
+        }
+        // remaining tail is shorter than 32 bytes, SSE2 handles up to one more chunk
+        return scanSse2<run>(data, position, size);
+    }
+#endif
+
+    /**
+     * @brief picks the kernels for the machine the compiler runs on
+     * @returns the widest supported set of kernels
+    */
+    Kernels selectKernels() noexcept {
+#if defined(__x86_64__)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")){
+            return Kernels{
+                scanAvx2<Run::WHITESPACE>,
+                scanAvx2<Run::IDENTIFIER>,
+                scanAvx2<Run::DIGITS>,
+                scanAvx2<Run::LINE>,
+                scanAvx2<Run::COMMENT_BODY>,
+                "avx2"
+            };
+        }
+
+        // SSE2 is part of the x86-64 baseline
+        return Kernels{
+            scanSse2<Run::WHITESPACE>,
+            scanSse2<Run::IDENTIFIER>,
+            scanSse2<Run::DIGITS>,
+            scanSse2<Run::LINE>,
+            scanSse2<Run::COMMENT_BODY>,
+            "sse2"
+        };
+#else
+        return Kernels{
+            scanScalar<Run::WHITESPACE>,
+            scanScalar<Run::IDENTIFIER>,
+            scanScalar<Run::DIGITS>,
+            scanScalar<Run::LINE>,
+            scanScalar<Run::COMMENT_BODY>,
+            "scalar"
+        };
+#endif
+    }
+
+    /**
+     * @brief getter for the selected kernels
+     * @returns kernels selected on the first call
+    */
+    const Kernels& kernels() noexcept {
+        static const Kernels selected{ selectKernels() };
+        return selected;
+    }
+}
+
+size_t lex::scan::skipWhitespace(std::string_view input, size_t position) noexcept {
+    return kernels().whitespace(input.data(), position, input.size());
+}
+
+size_t lex::scan::skipIdentifier(std::string_view input, size_t position) noexcept {
+    return kernels().identifier(input.data(), position, input.size());
+}
+
+size_t lex::scan::skipDigits(std::string_view input, size_t position) noexcept {
+    return kernels().digits(input.data(), position, input.size());
+}
+
+size_t lex::scan::findNewline(std::string_view input, size_t position) noexcept {
+    return kernels().line(input.data(), position, input.size());
+}
+
+size_t lex::scan::findCommentStop(std::string_view input, size_t position) noexcept {
+    return kernels().commentBody(input.data(), position, input.size());
+}
+
+std::string_view lex::scan::activeKernels() noexcept {
+    return kernels().name;
+}
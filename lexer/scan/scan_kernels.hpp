@@ -0,0 +1,62 @@
+#ifndef SCAN_KERNELS_HPP
+#define SCAN_KERNELS_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @namespace lex::scan
+ * @brief kernels that skip runs of characters of the same class
+ * @details on x86-64 the AVX2 or SSE2 implementation is picked once at runtime,
+ * other targets use the scalar implementation driven by the character class table
+*/
+namespace lex::scan {
+    /**
+     * @brief skips whitespaces that are not new lines
+     * @param input - scanned input
+     * @param position - position where skipping starts
+     * @returns position of the first character that is not a whitespace, or input size
+    */
+    size_t skipWhitespace(std::string_view input, size_t position) noexcept;
+
+    /**
+     * @brief skips characters that can appear inside of an identifier
+     * @param input - scanned input
+     * @param position - position where skipping starts
+     * @returns position of the first character that is not a part of an identifier, or input size
+    */
+    size_t skipIdentifier(std::string_view input, size_t position) noexcept;
+
+    /**
+     * @brief skips digits
+     * @param input - scanned input
+     * @param position - position where skipping starts
+     * @returns position of the first character that is not a digit, or input size
+    */
+    size_t skipDigits(std::string_view input, size_t position) noexcept;
+
+    /**
+     * @brief finds the next new line, used for single line comment bodies
+     * @param input - scanned input
+     * @param position - position where search starts
+     * @returns position of the next new line, or input size
+    */
+    size_t findNewline(std::string_view input, size_t position) noexcept;
+
+    /**
+     * @brief finds the next character that can end or split a multi line comment body
+     * @param input - scanned input
+     * @param position - position where search starts
+     * @returns position of the next '*' or new line, or input size
+    */
+    size_t findCommentStop(std::string_view input, size_t position) noexcept;
+
+    /**
+     * @brief getter for the name of the kernels selected for this machine
+     * @returns "avx2", "sse2" or "scalar"
+    */
+    std::string_view activeKernels() noexcept;
+
+}
+
+#endif
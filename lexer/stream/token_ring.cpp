@@ -0,0 +1,65 @@
+#include "token_ring.hpp"
+
+#include <algorithm>
+#include <bit>
+
+lex::TokenRing::TokenRing(size_t capacity)
+    : slots(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity)), 
+      mask{ slots.size() - 1 }, 
+      publishBatch{ std::max<size_t>(1, slots.size() / 8) } {}
+
+bool lex::TokenRing::push(const syntax::Token& token) noexcept {
+    size_t released{ tail.load(std::memory_order_acquire) };
+    while((released & flagBit) == 0 && pushed - released > mask){
+        // consumer can only free slots of the tokens it has seen
+        publish();
+        tail.wait(released, std::memory_order_acquire);
+        released = tail.load(std::memory_order_acquire);
+    }
+
+    if((released & flagBit) != 0){
+        return false;
+    }
+
+    slots[pushed & mask] = token;
+    ++pushed;
+
+    if(pushed - head.load(std::memory_order_relaxed) >= publishBatch){
+        publish();
+    }
+    return true;
+}
+
+void lex::TokenRing::finish() noexcept {
+    head.store(pushed | flagBit, std::memory_order_release);
+    head.notify_one();
+}
+
+void lex::TokenRing::publish() noexcept {
+    head.store(pushed, std::memory_order_release);
+    head.notify_one();
+}
+
+syntax::Token lex::TokenRing::at(size_t index) const noexcept {
+    size_t produced{ head.load(std::memory_order_acquire) };
+    while((produced & ~flagBit) <= index){
+        if((produced & flagBit) != 0){
+            // stream ended, reading past the end yields the last token, same as the lexer does
+            return slots[((produced & ~flagBit) - 1) & mask];
+        }
+        head.wait(produced, std::memory_order_acquire);
+        produced = head.load(std::memory_order_acquire);
+    }
+
+    return slots[index & mask];
+}
+
+void lex::TokenRing::release(size_t index) noexcept {
+    tail.store(index, std::memory_order_release);
+    tail.notify_one();
+}
+
+void lex::TokenRing::close() noexcept {
+    tail.fetch_or(flagBit, std::memory_order_release);
+    tail.notify_one();
+}
@@ -0,0 +1,104 @@
+#ifndef TOKEN_RING_HPP
+#define TOKEN_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "../../common/token/token.hpp"
+
+namespace lex {
+    /**
+     * @class TokenRing
+     * @brief bounded single-producer/single-consumer ring of tokens
+     * @details lexer pushes tokens from one thread, parser reads them by absolute index from another,
+     * slots are reused once the consumer releases them, waiting is done on the atomic counters,
+     * tokens are published in batches to keep the counters from bouncing between cores on every token
+    */
+    class TokenRing {
+    public:
+        /**
+         * @brief creates the ring
+         * @param capacity - minimal number of slots, rounded up to a power of two
+        */
+        explicit TokenRing(size_t capacity);
+
+        /**
+         * @brief appends the token, waits while the ring is full
+         * @param token - token produced by the lexer
+         * @returns false if consumer closed the ring, true otherwise
+         * @note producer only
+        */
+        bool push(const syntax::Token& token) noexcept;
+
+        /**
+         * @brief marks that no more tokens will be pushed
+         * @note producer only
+        */
+        void finish() noexcept;
+
+        /**
+         * @brief getter for the token at the absolute index, waits until it is produced
+         * @param index - index of the token in the whole stream
+         * @returns copy of the token, last token of the stream if index is past the end
+         * @note consumer only, index must not be released
+        */
+        syntax::Token at(size_t index) const noexcept;
+
+        /**
+         * @brief allows producer to reuse slots of the tokens before the index
+         * @param index - index of the first token consumer may still read
+         * @note consumer only
+        */
+        void release(size_t index) noexcept;
+
+        /**
+         * @brief abandons the stream, producer stops on the next push
+         * @note consumer only
+        */
+        void close() noexcept;
+
+        /**
+         * @brief checks if the consumer abandoned the stream
+         * @returns true if ring is closed, false otherwise
+        */
+        inline bool isClosed() const noexcept {
+            return (tail.load(std::memory_order_acquire) & flagBit) != 0;
+        }
+
+    private:
+        /**
+         * @brief makes pushed tokens visible to the consumer
+        */
+        void publish() noexcept;
+
+        /// size of the cache line, counters are kept on separate lines to avoid false sharing
+        static constexpr size_t cacheLine{ 64 };
+
+        /// highest bit of a counter, marks finished stream in head and closed stream in tail
+        /// flags live in the counters so that a waiter on the counter is woken by them
+        static constexpr size_t flagBit{ size_t{ 1 } << (sizeof(size_t) * 8 - 1) };
+
+        /// storage of the tokens
+        std::vector<syntax::Token> slots;
+
+        /// capacity - 1, used for wrapping indices
+        size_t mask;
+
+        /// number of pushed tokens after which they are made visible to the consumer
+        size_t publishBatch;
+
+        /// number of pushed tokens, including the ones not yet published, producer only
+        size_t pushed{ 0 };
+
+        /// number of published tokens and finished flag, written by the producer
+        alignas(cacheLine) std::atomic<size_t> head{ 0 };
+
+        /// number of released tokens and closed flag, written by the consumer
+        alignas(cacheLine) std::atomic<size_t> tail{ 0 };
+
+    };
+
+}
+
+#endif
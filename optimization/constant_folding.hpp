@@ -8,6 +8,7 @@
 
 #include "../common/defs/types.hpp"
 #include "../common/abstract-syntax-tree/ast_binary_expr.hpp"
+#include "../common/intermediate-representation-tree/ir_arena.hpp"
 #include "../common/intermediate-representation-tree/ir_expr.hpp"
 #include "../common/intermediate-representation-tree/ir_literal_expr.hpp"
 
@@ -132,9 +133,9 @@ namespace optimization::constant_folding {
     template<typename T>
     T getOperandValue(const ir::IRLiteralExpr* operand) {
         if (std::is_same<T, int>::value) {
-            return static_cast<T>(std::stoi(operand->getValue()));
+            return static_cast<T>(std::stoi(std::string{ operand->getValue() }));
         } else {
-            return static_cast<T>(std::stoul(operand->getValue()));
+            return static_cast<T>(std::stoul(std::string{ operand->getValue() }));
         }
     }
     
@@ -144,13 +145,15 @@ namespace optimization::constant_folding {
      * @param leftOperand - const pointer to the irt literal expression
      * @param rightOperand - const pointer to the irt literal expression
      * @param binExp - const pointer to the ast binary expression, contains operation
+     * @param arena - reference to the arena of the function the folded literal is placed into
      * @returns result of the merge operation
     */
     template<typename T>
-    MergeResult<std::unique_ptr<ir::IRExpr>> mergeLiterals(
+    MergeResult<ir::IRPtr<ir::IRExpr>> mergeLiterals(
         const ir::IRLiteralExpr* leftOperand, 
         const ir::IRLiteralExpr* rightOperand, 
-        const syntax::ast::ASTBinaryExpr* binExp
+        const syntax::ast::ASTBinaryExpr* binExp,
+        ir::IRArena& arena
     ){
         T lval{ getOperandValue<T>(leftOperand) };
         T rval{ getOperandValue<T>(rightOperand) };
@@ -161,15 +164,15 @@ namespace optimization::constant_folding {
             lval, 
             rval, 
             binExp->getOperator(), 
-            binExpToken.line, 
-            binExpToken.column
+            binExpToken.line(), 
+            binExpToken.column()
         ) };
 
         auto type{ binExp->getType() };
         std::string suffix{ type == types::Type::UNSIGNED ? "u" : "" };
 
-        MergeResult<std::unique_ptr<ir::IRExpr>> foldedExpr {
-            .result = std::make_unique<ir::IRLiteralExpr>(std::to_string(res.result) + suffix, type),
+        MergeResult<ir::IRPtr<ir::IRExpr>> foldedExpr {
+            .result = arena.make<ir::IRLiteralExpr>(std::to_string(res.result) + suffix, type),
             .error = res.error
         };
 
@@ -1,7 +1,7 @@
 #ifndef DEAD_CODE_ELIMINATOR_HPP
 #define DEAD_CODE_ELIMINATOR_HPP
 
-#include "../common/visitor/ir_visitor.hpp"
+#include "../common/visitor/ir_static_visitor.hpp"
 #include "../common/intermediate-representation-tree/ir_program.hpp"
 #include "../common/intermediate-representation-tree/ir_function.hpp"
 #include "../common/intermediate-representation-tree/ir_variable_decl_stmt.hpp"
@@ -26,7 +26,7 @@ namespace optimization::dce {
      * @class DeadCodeEliminator
      * @brief eliminates unreachable code
     */
-    class DeadCodeEliminator final : public ir::IRVisitor {
+    class DeadCodeEliminator final : public ir::IRStaticVisitor<DeadCodeEliminator> {
     public:
         /**
          * @brief creates the instance of the dead code eliminator
@@ -38,127 +38,127 @@ namespace optimization::dce {
          * @brief starts the dead code elimination for all functions
          * @param program - pointer to the program
         */
-        void visit(ir::IRProgram* program) override;
+        void visit(ir::IRProgram* program);
 
         /**
          * @brief eliminates the dead code of the function
          * @param function - pointer to the function
         */
-        void visit(ir::IRFunction* function) override;
+        void visit(ir::IRFunction* function);
 
         /**
          * @brief intentionally empty, cannot return
          * @param parameter - pointer to the parameter
         */
-        void visit([[maybe_unused]] ir::IRParameter* parameter) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRParameter* parameter) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param variableDecl - pointer to the variable declaration
         */
-        void visit([[maybe_unused]] ir::IRVariableDeclStmt* variableDecl) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRVariableDeclStmt* variableDecl) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param assignStmt - pointer to the assign statement
         */
-        void visit([[maybe_unused]] ir::IRAssignStmt* assignStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRAssignStmt* assignStmt) { /*empty*/ };
 
         /**
          * @brief eliminates the dead code of the compound statement
          * @param compoundStmt - pointer to the compound statement
         */
-        void visit(ir::IRCompoundStmt* compoundStmt) override;
+        void visit(ir::IRCompoundStmt* compoundStmt);
 
         /**
          * @brief intentionally empty, cannot return (compile-time condition evaluation is not available yet)
          * @param forStmt - pointer to the for statement
         */
-        void visit([[maybe_unused]] ir::IRForStmt* forStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRForStmt* forStmt) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param callStmt - pointer to the function call statement
         */
-        void visit([[maybe_unused]] ir::IRFunctionCallStmt* callStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRFunctionCallStmt* callStmt) { /*empty*/ };
 
         /**
          * @brief eliminates the dead code of the if statement
          * @param ifStmt - pointer to the if statement
         */
-        void visit(ir::IRIfStmt* ifStmt) override;
+        void visit(ir::IRIfStmt* ifStmt);
 
         /**
          * @brief always returns
          * @param returnStmt - pointer to the return statement
         */
-        void visit([[maybe_unused]] ir::IRReturnStmt* returnStmt) override;
+        void visit([[maybe_unused]] ir::IRReturnStmt* returnStmt);
 
         /**
          * @brief intentionally empty, cannot return (compile-time condition evaluation is not available yet)
          * @param whileStmt - pointer to the while statement
         */
-        void visit([[maybe_unused]] ir::IRWhileStmt* whileStmt) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRWhileStmt* whileStmt) { /*empty*/ };
 
         /**
          * @brief eliminates the dead code of the do-while statement
          * @param dowhileStmt - pointer to the do-while statement
         */
-        void visit(ir::IRDoWhileStmt* dowhileStmt) override;
+        void visit(ir::IRDoWhileStmt* dowhileStmt);
 
         /**
          * @brief eliminates the dead code of the switch statement
          * @param switchStmt - pointer to the switch statement
         */
-        void visit(ir::IRSwitchStmt* switchStmt) override;
+        void visit(ir::IRSwitchStmt* switchStmt);
 
         /**
          * @brief eliminates the dead code of the case statement
          * @param caseStmt - pointer to the case statement
         */
-        void visit(ir::IRCaseStmt* caseStmt) override;
+        void visit(ir::IRCaseStmt* caseStmt);
 
         /**
          * @brief eliminates the dead code of the default statement
          * @param defaultStmt - pointer to the default statement
         */
-        void visit(ir::IRDefaultStmt* defaultStmt) override;
+        void visit(ir::IRDefaultStmt* defaultStmt);
 
         /**
          * @brief eliminates the dead code of the switch-block statement
          * @param switchBlockStmt - pointer to the switch-block statement
         */
-        void visit(ir::IRSwitchBlockStmt* switchBlockStmt) override;
+        void visit(ir::IRSwitchBlockStmt* switchBlockStmt);
 
         /**
          * @brief intentionally empty, cannot return
          * @param binaryExpr - pointer to the binary expression
         */
-        void visit([[maybe_unused]] ir::IRBinaryExpr* binaryExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRBinaryExpr* binaryExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param callExpr - pointer to the function call expression
         */
-        void visit([[maybe_unused]] ir::IRFunctionCallExpr* callExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRFunctionCallExpr* callExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param idExpr - pointer to the id expression
         */
-        void visit([[maybe_unused]] ir::IRIdExpr* idExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRIdExpr* idExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param literalExpr - pointer to the literal expression
         */
-        void visit([[maybe_unused]] ir::IRLiteralExpr* literalExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRLiteralExpr* literalExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, cannot return
          * @param tempExpr - pointer to the temporary expression
         */
-        void visit([[maybe_unused]] ir::IRTemporaryExpr* tempExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRTemporaryExpr* tempExpr) { /*empty*/ };
 
     private:
         /// reference to a thread pool for parallel dead code elimination
@@ -1,6 +1,6 @@
 #include "../dead_code_eliminator.hpp"
 
-#include <latch>
+#include "../../thread-pool/task_group.hpp"
 
 optimization::dce::DeadCodeEliminator::DeadCodeEliminator(util::concurrency::ThreadPool& threadPool) 
     : threadPool{threadPool} {}
@@ -8,20 +8,13 @@ optimization::dce::DeadCodeEliminator::DeadCodeEliminator(util::concurrency::Thr
 thread_local bool optimization::dce::DeadCodeEliminator::alwaysReturns{ false };
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRProgram* program){
-    std::latch doneLatch{ 
-        static_cast<std::ptrdiff_t>(program->getFunctionCount()) 
-    };
-
-    for(const auto& function : program->getFunctions()){
-        threadPool.enqueue(
-            [this, function=function.get(), &doneLatch] -> void {
-                function->accept(*this);
-                doneLatch.count_down();
-            }
-        );
-    }
-
-    doneLatch.wait();
+    const auto& functions{ program->getFunctions() };
+    util::concurrency::parallelForByCost(threadPool, functions.size(),
+        [&functions](size_t i) -> size_t { return functions[i]->getCost(); },
+        [this, &functions](size_t i) -> void {
+            visitNode(functions[i].get());
+        }
+    );
 }
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRFunction* function){
@@ -29,7 +22,7 @@ void optimization::dce::DeadCodeEliminator::visit(ir::IRFunction* function){
 
     size_t stmtIdx{ 0 };
     for(const auto& stmt : function->getBody()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             function->eliminateDeadStmts(stmtIdx + 1);
             return;
@@ -43,7 +36,7 @@ void optimization::dce::DeadCodeEliminator::visit(ir::IRCompoundStmt* compoundSt
 
     size_t stmtIdx{ 0 };
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             compoundStmt->eliminateDeadStmts(stmtIdx + 1);
             return;
@@ -57,7 +50,7 @@ void optimization::dce::DeadCodeEliminator::visit(ir::IRIfStmt* ifStmt){
 
     for(const auto& stmt : ifStmt->getStmts()){
         alwaysReturns = false;
-        stmt->accept(*this);
+        visitNode(stmt);
         ifStmtAlwaysReturns = ifStmtAlwaysReturns && alwaysReturns;
     }
     alwaysReturns = ifStmtAlwaysReturns && ifStmt->hasElseStmt();
@@ -69,31 +62,31 @@ void optimization::dce::DeadCodeEliminator::visit([[maybe_unused]] ir::IRReturnS
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRDoWhileStmt* dowhileStmt){
     alwaysReturns = false;
-    dowhileStmt->getStmt()->accept(*this);
+    visitNode(dowhileStmt->getStmt());
 }
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRSwitchStmt* switchStmt){
     bool switchStmtAlwaysReturns{ true };
 
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this); 
+        visitNode(caseStmt); 
         switchStmtAlwaysReturns = switchStmtAlwaysReturns && 
             (alwaysReturns || (!alwaysReturns && !caseStmt->hasBreakStmt()));
     }
     switchStmtAlwaysReturns = switchStmtAlwaysReturns && switchStmt->hasDefaultStmt();
     
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
     alwaysReturns = switchStmtAlwaysReturns && alwaysReturns;
 }
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRCaseStmt* caseStmt){
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getSwitchBlockStmt());
 }
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRDefaultStmt* defaultStmt){
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void optimization::dce::DeadCodeEliminator::visit(ir::IRSwitchBlockStmt* switchBlockStmt){
@@ -101,7 +94,7 @@ void optimization::dce::DeadCodeEliminator::visit(ir::IRSwitchBlockStmt* switchB
 
     size_t stmtIdx{ 0 };
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
         if(alwaysReturns){
             switchBlockStmt->eliminateDeadStmts(stmtIdx + 1);
             return;
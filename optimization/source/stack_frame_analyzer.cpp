@@ -1,34 +1,28 @@
 #include "../stack_frame_analyzer.hpp"
 
-#include <latch>
 #include <string>
 
+#include "../../thread-pool/task_group.hpp"
+
 optimization::sfa::StackFrameAnalyzer::StackFrameAnalyzer(util::concurrency::ThreadPool& threadPool) 
     : threadPool{threadPool} {}
 
 thread_local size_t optimization::sfa::StackFrameAnalyzer::variableCounter{};
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRProgram* program){
-    std::latch doneLatch{ 
-        static_cast<std::ptrdiff_t>(program->getFunctionCount()) 
-    };
-
-    for(const auto& function : program->getFunctions()){
-        threadPool.enqueue(
-            [this, function=function.get(), &doneLatch] -> void {
-                function->accept(*this);
-                doneLatch.count_down();
-            }
-        );
-    }
-
-    doneLatch.wait();
+    const auto& functions{ program->getFunctions() };
+    util::concurrency::parallelForByCost(threadPool, functions.size(),
+        [&functions](size_t i) -> size_t { return functions[i]->getCost(); },
+        [this, &functions](size_t i) -> void {
+            visitNode(functions[i].get());
+        }
+    );
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRFunction* function){
     variableCounter = 0;
     for(const auto& stmt : function->getBody()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 
     function->setRequiredMemory(std::to_string(regSize * variableCounter));
@@ -37,93 +31,93 @@ void optimization::sfa::StackFrameAnalyzer::visit(ir::IRFunction* function){
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRVariableDeclStmt* variableDecl){
     ++variableCounter;
     if(variableDecl->hasTemporaryExpr()){
-        variableDecl->getTemporaryExpr()->accept(*this);
+        visitNode(variableDecl->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRAssignStmt* assignStmt){
     if(assignStmt->hasTemporaryExpr()){
-        assignStmt->getTemporaryExpr()->accept(*this);
+        visitNode(assignStmt->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRCompoundStmt* compoundStmt){
     for(const auto& stmt : compoundStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRForStmt* forStmt){
-    forStmt->getStmt()->accept(*this);
+    visitNode(forStmt->getStmt());
     if(forStmt->hasTemporaryExpr()){
-        forStmt->getTemporaryExpr()->accept(*this);
+        visitNode(forStmt->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRFunctionCallStmt* callStmt){
-    callStmt->getFunctionCallExpr()->accept(*this);
+    visitNode(callStmt->getFunctionCallExpr());
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRIfStmt* ifStmt){
     for(const auto& stmt : ifStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 
     for(const auto& tempExpr : ifStmt->getTemporaryExprs()){
         if(tempExpr){
-            tempExpr->accept(*this);
+            visitNode(tempExpr);
         }
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRReturnStmt* returnStmt){
     if(returnStmt->hasTemporaryExpr()){
-        returnStmt->getTemporaryExpr()->accept(*this);
+        visitNode(returnStmt->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRWhileStmt* whileStmt){
-    whileStmt->getStmt()->accept(*this);
+    visitNode(whileStmt->getStmt());
     if(whileStmt->hasTemporaryExpr()){
-        whileStmt->getTemporaryExpr()->accept(*this);
+        visitNode(whileStmt->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRDoWhileStmt* dowhileStmt){
-    dowhileStmt->getStmt()->accept(*this);
+    visitNode(dowhileStmt->getStmt());
     if(dowhileStmt->hasTemporaryExpr()){
-        dowhileStmt->getTemporaryExpr()->accept(*this);
+        visitNode(dowhileStmt->getTemporaryExpr());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRSwitchStmt* switchStmt){
     for(const auto& caseStmt : switchStmt->getCaseStmts()){
-        caseStmt->accept(*this);
+        visitNode(caseStmt);
     }
 
     if(switchStmt->hasDefaultStmt()){
-        switchStmt->getDefaultStmt()->accept(*this);
+        visitNode(switchStmt->getDefaultStmt());
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRCaseStmt* caseStmt){
-    caseStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(caseStmt->getSwitchBlockStmt());
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRDefaultStmt* defaultStmt){
-    defaultStmt->getSwitchBlockStmt()->accept(*this);
+    visitNode(defaultStmt->getSwitchBlockStmt());
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRSwitchBlockStmt* switchBlockStmt){
     for(const auto& stmt : switchBlockStmt->getStmts()){
-        stmt->accept(*this);
+        visitNode(stmt);
     }
 }
 
 void optimization::sfa::StackFrameAnalyzer::visit(ir::IRFunctionCallExpr* callExpr){
     for(const auto& tempExpr : callExpr->getTemporaryExprs()){
         if(tempExpr){
-            tempExpr->accept(*this);
+            visitNode(tempExpr);
         }
     }
 }
@@ -132,7 +126,7 @@ void optimization::sfa::StackFrameAnalyzer::visit(ir::IRTemporaryExpr* tempExpr)
     for(const auto& expr : tempExpr->getTemporaryExprs()){
         ++variableCounter;
         if(expr->getNodeType() == ir::IRNodeType::CALL){
-            expr->accept(*this);
+            visitNode(expr);
         }
     }
 }
@@ -1,7 +1,7 @@
 #ifndef STACK_FRAME_ANALYZER_HPP
 #define STACK_FRAME_ANALYZER_HPP
 
-#include "../common/visitor/ir_visitor.hpp"
+#include "../common/visitor/ir_static_visitor.hpp"
 #include "../common/intermediate-representation-tree/ir_program.hpp"
 #include "../common/intermediate-representation-tree/ir_function.hpp"
 #include "../common/intermediate-representation-tree/ir_variable_decl_stmt.hpp"
@@ -26,7 +26,7 @@ namespace optimization::sfa {
     * @class StackFrameAnalyzer
     * @brief calculates the size of the stack for each function
     */
-    class StackFrameAnalyzer final : public ir::IRVisitor {
+    class StackFrameAnalyzer final : public ir::IRStaticVisitor<StackFrameAnalyzer> {
     public:
         /**
          * @brief creates the instance of the stack frame analyzer
@@ -38,127 +38,127 @@ namespace optimization::sfa {
          * @brief starts the stack analysis for all functions
          * @param program - pointer to the program
         */
-        void visit(ir::IRProgram* program) override;
+        void visit(ir::IRProgram* program);
 
         /**
          * @brief calculates the size of the stack required for the function
          * @param function - pointer to the function
         */
-        void visit(ir::IRFunction* function) override;
+        void visit(ir::IRFunction* function);
 
         /**
          * @brief intentionally empty, not used for stack size evaluation
          * @param parameter - pointer to the parameter
         */
-        void visit([[maybe_unused]] ir::IRParameter* parameter) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRParameter* parameter) { /*empty*/ };
 
         /**
          * @brief calculates the size of the stack required for the variable declaration
          * @param variableDecl - pointer to the variable declaration
         */
-        void visit(ir::IRVariableDeclStmt* variableDecl) override;
+        void visit(ir::IRVariableDeclStmt* variableDecl);
 
         /**
          * @brief calculates the size of the stack required for the assign statement
          * @param assignStmt - pointer to the assign statement
         */
-        void visit(ir::IRAssignStmt* assignStmt) override;
+        void visit(ir::IRAssignStmt* assignStmt);
 
         /**
          * @brief calculates the size of the stack required for the compound statement
          * @param compoundStmt - pointer to the compound statement
         */
-        void visit(ir::IRCompoundStmt* compoundStmt) override;
+        void visit(ir::IRCompoundStmt* compoundStmt);
 
         /**
          * @brief calculates the size of the stack required for the for statement
          * @param forStmt - pointer to the for statement
         */
-        void visit(ir::IRForStmt* forStmt) override;
+        void visit(ir::IRForStmt* forStmt);
 
         /**
          * @brief calculates the size of the stack required for the function call statement
          * @param callStmt - pointer to the function call statement
         */
-        void visit(ir::IRFunctionCallStmt* callStmt) override;
+        void visit(ir::IRFunctionCallStmt* callStmt);
 
         /**
          * @brief calculates the size of the stack required for the if statement
          * @param ifStmt - pointer to the if statement
         */
-        void visit(ir::IRIfStmt* ifStmt) override;
+        void visit(ir::IRIfStmt* ifStmt);
 
         /**
          * @brief calculates the size of the stack required for the return statement
          * @param returnStmt - pointer to the return statement
         */
-        void visit(ir::IRReturnStmt* returnStmt) override;
+        void visit(ir::IRReturnStmt* returnStmt);
 
         /**
          * @brief calculates the size of the stack required for the while statement
          * @param whileStmt - pointer to the while statement
         */
-        void visit(ir::IRWhileStmt* whileStmt) override;
+        void visit(ir::IRWhileStmt* whileStmt);
 
         /**
          * @brief calculates the size of the stack required for the do-while statement
          * @param dowhileStmt - pointer to the do-while statement
         */
-        void visit(ir::IRDoWhileStmt* dowhileStmt) override;
+        void visit(ir::IRDoWhileStmt* dowhileStmt);
 
         /**
          * @brief calculates the size of the stack required for the switch statement
          * @param switchStmt - pointer to the switch statement
         */
-        void visit(ir::IRSwitchStmt* switchStmt) override;
+        void visit(ir::IRSwitchStmt* switchStmt);
 
         /**
          * @brief calculates the size of the stack required for the case statement
          * @param caseStmt - pointer to the case statement
         */
-        void visit(ir::IRCaseStmt* caseStmt) override;
+        void visit(ir::IRCaseStmt* caseStmt);
 
         /**
          * @brief calculates the size of the stack required for the default statement
          * @param defaultStmt - pointer to the default statement
         */
-        void visit(ir::IRDefaultStmt* defaultStmt) override;
+        void visit(ir::IRDefaultStmt* defaultStmt);
 
         /**
          * @brief calculates the size of the stack required for the switch-block statement
          * @param switchBlockStmt - pointer to the switch-block statement
         */
-        void visit(ir::IRSwitchBlockStmt* switchBlockStmt) override;
+        void visit(ir::IRSwitchBlockStmt* switchBlockStmt);
 
         /**
          * @brief intentionally empty, not used for stack size evaluation
          * @param binaryExpr - pointer to the binary expression
         */
-        void visit([[maybe_unused]] ir::IRBinaryExpr* binaryExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRBinaryExpr* binaryExpr) { /*empty*/ };
 
         /**
          * @brief calculates the size of the stack required for the function call expression
          * @param callExpr - pointer to the function call expression
         */
-        void visit(ir::IRFunctionCallExpr* callExpr) override;
+        void visit(ir::IRFunctionCallExpr* callExpr);
 
         /**
          * @brief intentionally empty, not used for stack size evaluation
          * @param idExpr - pointer to the id expression
         */
-        void visit([[maybe_unused]] ir::IRIdExpr* idExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRIdExpr* idExpr) { /*empty*/ };
 
         /**
          * @brief intentionally empty, not used for stack size evaluation
          * @param literalExpr - pointer to the literal expression
         */
-        void visit([[maybe_unused]] ir::IRLiteralExpr* literalExpr) override { /*empty*/ };
+        void visit([[maybe_unused]] ir::IRLiteralExpr* literalExpr) { /*empty*/ };
 
         /**
          * @brief calculates the size of the stack required for the temporary expression
          * @param tempExpr - pointer to the temporary expression
         */
-        void visit(ir::IRTemporaryExpr* tempExpr) override;
+        void visit(ir::IRTemporaryExpr* tempExpr);
 
     private:
         /// reference to a thread pool for parallel function stack analysis
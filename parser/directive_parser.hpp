@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "token_consumer.hpp"
+#include "../common/abstract-syntax-tree/ast_arena.hpp"
 #include "../common/abstract-syntax-tree/ast_dir.hpp"
 #include "../common/abstract-syntax-tree/ast_include_dir.hpp"
 
@@ -17,25 +18,29 @@ namespace syntax {
         /** 
          * @brief Creates the instance of the parser specialized for directives
          * @param tokenConsumer - reference to a token handler wrapped around the lexer
+         * @param arena - reference to the arena the parsed nodes are placed into
         */
-        DirectiveParser(TokenConsumer& tokenConsumer);
+        DirectiveParser(TokenConsumer& tokenConsumer, ast::ASTArena& arena);
 
         /** 
          * @brief parses directives
          * @returns pointer to the directive
         */
-        std::unique_ptr<ast::ASTDir> parseDir();
+        ast::ASTPtr<ast::ASTDir> parseDir();
 
         /** 
          * @brief parses the include directive
          * @returns pointer to the include directive
         */
-        std::unique_ptr<ast::ASTIncludeDir> parseIncludeDir();
+        ast::ASTPtr<ast::ASTIncludeDir> parseIncludeDir();
 
     private:
         /// reference to a token handler wrapped around the lexer
         TokenConsumer& tokenConsumer;
 
+        /// reference to the arena the parsed nodes are placed into
+        ast::ASTArena& arena;
+
     };
 
 }
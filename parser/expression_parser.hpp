@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "../common/abstract-syntax-tree/ast_arena.hpp"
 #include "../common/abstract-syntax-tree/ast_expr.hpp"
 #include "../common/abstract-syntax-tree/ast_function_call_expr.hpp"
 #include "../common/abstract-syntax-tree/ast_literal_expr.hpp"
@@ -21,36 +22,37 @@ namespace syntax {
         /** 
          * @brief Creates new instance of the parser specialized for expressions
          * @param consumer - reference to token handler wrapped around the lexer 
+         * @param arena - reference to the arena the parsed nodes are placed into
         */
-        ExpressionParser(TokenConsumer& consumer);
+        ExpressionParser(TokenConsumer& consumer, ast::ASTArena& arena);
 
         /** 
          * @brief parses arithmetic expression
          * @details EXPRESSION : EXPRESSION (OPERATOR EXPRESSION)*
          * @returns pointer to an expression node
         */
-        std::unique_ptr<ast::ASTExpr> parseExpr();
+        ast::ASTPtr<ast::ASTExpr> parseExpr();
 
         /** 
          * @brief parses id expression
          * @details ID : ID
          * @returns pointer to an id node
         */
-        std::unique_ptr<ast::ASTIdExpr> parseIdExpr();
+        ast::ASTPtr<ast::ASTIdExpr> parseIdExpr();
 
         /** 
          * @brief parses literal expression
          * @details LITERAL : LITERAL(unsigned) | LITERAL(int)
          * @returns pointer to a literal node
         */
-        std::unique_ptr<ast::ASTLiteralExpr> parseLiteralExpr();
+        ast::ASTPtr<ast::ASTLiteralExpr> parseLiteralExpr();
 
         /** 
          * @brief parses function call
          * @details FUNCTION_CALL : ID LPAREN (ARGUMENT)? RPAREN
          * @returns pointer to a function call node
         */
-        std::unique_ptr<ast::ASTFunctionCallExpr> parseFunctionCallExpr();
+        ast::ASTPtr<ast::ASTFunctionCallExpr> parseFunctionCallExpr();
 
         /** 
          * @brief parses expression
@@ -67,7 +69,7 @@ namespace syntax {
          * | LPAREN EXPRESSION RPAREN
          * @returns pointer to an expression node
         */
-        std::unique_ptr<ast::ASTExpr> parsePrimaryExpr();
+        ast::ASTPtr<ast::ASTExpr> parsePrimaryExpr();
 
         /** 
          * @brief parses argument of the function call
@@ -80,12 +82,15 @@ namespace syntax {
          * @brief parses the root of the binary expression node (only operator)
          * @returns pointer to a binary expression node
         */
-        std::unique_ptr<ast::ASTBinaryExpr> parseOperator();
+        ast::ASTPtr<ast::ASTBinaryExpr> parseOperator();
 
     private:
         /// reference to a token handler wrapped around the lexer
         TokenConsumer& tokenConsumer;
 
+        /// reference to the arena the parsed nodes are placed into
+        ast::ASTArena& arena;
+
     };
 
 }
@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "../common/abstract-syntax-tree/ast_arena.hpp"
 #include "../common/abstract-syntax-tree/ast_function.hpp"
 #include "statement_parser.hpp"
 #include "token_consumer.hpp"
@@ -17,15 +18,16 @@ namespace syntax {
         /** 
          * @brief Creates new instance of the parser specialized for functions
          * @param consumer - reference to token handler wrapped around the lexer 
+         * @param arena - reference to the arena the parsed nodes are placed into
         */
-        FunctionParser(TokenConsumer& consumer);
+        FunctionParser(TokenConsumer& consumer, ast::ASTArena& arena);
 
         /** 
          * @brief parses function
          * @details FUNCTION : TYPE ID LPAREN (PARAMETER (COMMA PARAMETER)*)? RPAREN BODY
          * @returns pointer to a function node
         */
-        std::unique_ptr<ast::ASTFunction> parseFunction();
+        ast::ASTPtr<ast::ASTFunction> parseFunction();
 
         /** 
          * @brief parses parameters of the function
@@ -48,6 +50,9 @@ namespace syntax {
         /// reference to a token handler wrapped around the lexer
         TokenConsumer& tokenConsumer;
 
+        /// reference to the arena the parsed nodes are placed into
+        ast::ASTArena& arena;
+
     };
 
 }
@@ -0,0 +1,79 @@
+#ifndef PARALLEL_PARSER_HPP
+#define PARALLEL_PARSER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "../common/abstract-syntax-tree/ast_program.hpp"
+#include "../lexer/lexer.hpp"
+#include "../thread-pool/thread_pool.hpp"
+
+namespace syntax {
+    /**
+     * @class ParallelParser
+     * @brief syntax analysis of the tokenized input, functions are parsed concurrently
+     * @details pre-scan splits the tokens into directive and function ranges by matching the braces,
+     * functions are parsed in batches on the thread pool, every batch into its own arena of the program,
+     * and assembled in source order, when the pre-scan or any range fails the input is parsed serially,
+     * so the reported syntax error is always the one Parser reports
+    */
+    class ParallelParser {
+    public:
+        /**
+         * @brief Creates new instance of the parser
+         * @param lexer - reference to the lexer that has completed tokenization
+         * @param threadPool - reference to a thread pool the functions are parsed on
+        */
+        ParallelParser(lex::Lexer& lexer, util::concurrency::ThreadPool& threadPool);
+
+        /**
+         * @brief entry point for the parsing of the program
+         * @returns pointer to the root of the ast of the program
+         * @throws std::runtime_error on syntax error
+        */
+        [[nodiscard]] std::unique_ptr<ast::ASTProgram> parseProgram();
+
+    private:
+        /**
+         * @struct TopLevelRange
+         * @brief range of tokens of a directive or a function
+        */
+        struct TopLevelRange {
+            /// index of the first token
+            size_t begin;
+
+            /// index following the last token
+            size_t end;
+
+            /// true for function, false for directive
+            bool isFunction;
+        };
+
+        /// number of batches per worker thread, smaller batches balance uneven functions
+        static constexpr size_t batchesPerWorker{ 4 };
+
+        /// reference to the lexer holding the tokens
+        lex::Lexer& lexer;
+
+        /// reference to a thread pool the functions are parsed on
+        util::concurrency::ThreadPool& threadPool;
+
+        /**
+         * @brief splits the tokens into top level ranges
+         * @returns ranges in source order, nullopt if the tokens do not split cleanly
+        */
+        std::optional<std::vector<TopLevelRange>> split() const;
+
+        /**
+         * @brief parses the whole input with a single parser
+         * @returns pointer to the root of the ast of the program
+        */
+        std::unique_ptr<ast::ASTProgram> parseSerially();
+
+    };
+
+}
+
+#endif
@@ -32,10 +32,14 @@ namespace syntax {
          * @brief entry point for the parsing of the program
          * @details PROGRAM : (FUNCTION)+
          * @returns pointer to the root of the ast of the program
+         * @note called once, program is handed over to the caller together with its arena
         */
         [[nodiscard]] std::unique_ptr<ast::ASTProgram> parseProgram();
 
     private:
+        /// program being parsed, its arena is shared by the specialized parsers
+        std::unique_ptr<ast::ASTProgram> program;
+
         /// parser specialized for functions
         FunctionParser funcParser;
 
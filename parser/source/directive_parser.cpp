@@ -3,10 +3,11 @@
 #include <stdexcept>
 #include <format>
 
-syntax::DirectiveParser::DirectiveParser(TokenConsumer& tokenConsumer) 
-    : tokenConsumer{ tokenConsumer } {}
+syntax::DirectiveParser::DirectiveParser(TokenConsumer& tokenConsumer, syntax::ast::ASTArena& arena) 
+    : tokenConsumer{ tokenConsumer }, 
+      arena{ arena } {}
 
-std::unique_ptr<syntax::ast::ASTDir> 
+syntax::ast::ASTPtr<syntax::ast::ASTDir> 
 syntax::DirectiveParser::parseDir() {
     tokenConsumer.consume(syntax::TokenType::HASH);
     const auto& token{ tokenConsumer.getToken() };
@@ -18,21 +19,21 @@ syntax::DirectiveParser::parseDir() {
     throw std::runtime_error(
         std::format(
             "Line {}, Column {}: SYNTAX ERROR -> near '{}'",
-            token.line, token.column, token.value
+            token.line(), token.column(), token.value()
         )
     );
 }
 
-std::unique_ptr<syntax::ast::ASTIncludeDir> 
+syntax::ast::ASTPtr<syntax::ast::ASTIncludeDir> 
 syntax::DirectiveParser::parseIncludeDir() {
-    std::unique_ptr<syntax::ast::ASTIncludeDir> includeDir{ 
-        std::make_unique<syntax::ast::ASTIncludeDir>(syntax::Token{ tokenConsumer.getToken() }) 
+    syntax::ast::ASTPtr<syntax::ast::ASTIncludeDir> includeDir{ 
+        arena.make<syntax::ast::ASTIncludeDir>(syntax::Token{ tokenConsumer.getToken() }) 
     };
 
     tokenConsumer.consume(syntax::TokenType::INCLUDE);
     tokenConsumer.consume(syntax::TokenType::COLON);
 
-    const std::string libName{ tokenConsumer.getToken().value };
+    const std::string libName{ tokenConsumer.getToken().value() };
     tokenConsumer.consume(syntax::TokenType::ID);
 
     includeDir->setLibName(libName);
@@ -6,13 +6,14 @@
 
 #include "../defs/parser_defs.hpp"
 
-syntax::ExpressionParser::ExpressionParser(TokenConsumer& consumer) 
-    : tokenConsumer{ consumer } {}
+syntax::ExpressionParser::ExpressionParser(TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+    : tokenConsumer{ consumer }, 
+      arena{ arena } {}
 
-std::unique_ptr<syntax::ast::ASTExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTExpr> 
 syntax::ExpressionParser::parseExpr(){
-    std::stack<std::unique_ptr<syntax::ast::ASTExpr>> values;
-    std::stack<std::unique_ptr<syntax::ast::ASTBinaryExpr>> operators;
+    std::stack<syntax::ast::ASTPtr<syntax::ast::ASTExpr>> values;
+    std::stack<syntax::ast::ASTPtr<syntax::ast::ASTBinaryExpr>> operators;
 
     auto reduce {
         [&values, &operators]() -> void {
@@ -54,7 +55,7 @@ syntax::ExpressionParser::parseExpr(){
     return std::move(values.top());
 }
 
-std::unique_ptr<syntax::ast::ASTExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTExpr> 
 syntax::ExpressionParser::parsePrimaryExpr(){
     const auto& token{ tokenConsumer.getToken() };
     switch(token.type){
@@ -80,15 +81,15 @@ syntax::ExpressionParser::parsePrimaryExpr(){
     throw std::runtime_error(
         std::format(
             "Line {}, Column {}: SYNTAX ERROR -> expected 'EXPRESSION', got '{} {}'",
-            token.line, token.column, syntax::tokenTypeToStr(token.type), token.value
+            token.line(), token.column(), syntax::tokenTypeToStr(token.type), token.value()
         )
     );
 }
 
-std::unique_ptr<syntax::ast::ASTFunctionCallExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTFunctionCallExpr> 
 syntax::ExpressionParser::parseFunctionCallExpr(){
-    std::unique_ptr<syntax::ast::ASTFunctionCallExpr> callExpr{ 
-        std::make_unique<syntax::ast::ASTFunctionCallExpr>(tokenConsumer.getToken()) 
+    syntax::ast::ASTPtr<syntax::ast::ASTFunctionCallExpr> callExpr{ 
+        arena.make<syntax::ast::ASTFunctionCallExpr>(tokenConsumer.getToken(), types::Type::NO_TYPE) 
     };
     tokenConsumer.consume(syntax::TokenType::ID);
     
@@ -111,29 +112,29 @@ void syntax::ExpressionParser::parseArguments(syntax::ast::ASTFunctionCallExpr*
     }
 }
 
-std::unique_ptr<syntax::ast::ASTIdExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTIdExpr> 
 syntax::ExpressionParser::parseIdExpr(){
     const auto& token{ tokenConsumer.getToken() };
     tokenConsumer.consume(syntax::TokenType::ID);
 
-    return std::make_unique<syntax::ast::ASTIdExpr>(token);
+    return arena.make<syntax::ast::ASTIdExpr>(token);
 }
 
-std::unique_ptr<syntax::ast::ASTLiteralExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTLiteralExpr> 
 syntax::ExpressionParser::parseLiteralExpr(){
     const auto& token{ tokenConsumer.getToken() };
     tokenConsumer.consume(syntax::TokenType::LITERAL);
-    if(token.value.back() == 'u'){
-        return std::make_unique<syntax::ast::ASTLiteralExpr>(token, types::Type::UNSIGNED);
+    if(token.value().back() == 'u'){
+        return arena.make<syntax::ast::ASTLiteralExpr>(token, types::Type::UNSIGNED);
     }
-    return std::make_unique<syntax::ast::ASTLiteralExpr>(token, types::Type::INT);
+    return arena.make<syntax::ast::ASTLiteralExpr>(token, types::Type::INT);
 }
 
-std::unique_ptr<syntax::ast::ASTBinaryExpr> 
+syntax::ast::ASTPtr<syntax::ast::ASTBinaryExpr> 
 syntax::ExpressionParser::parseOperator(){
     const auto& token{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTBinaryExpr> op{ 
-        std::make_unique<syntax::ast::ASTBinaryExpr>(token)
+    syntax::ast::ASTPtr<syntax::ast::ASTBinaryExpr> op{ 
+        arena.make<syntax::ast::ASTBinaryExpr>(token)
     };
     op->setOperator(syntax::tokenTypeToOperator(token.type));
 
@@ -2,19 +2,21 @@
 
 #include "../../common/defs/type_mapping.hpp"
 
-syntax::FunctionParser::FunctionParser(TokenConsumer& consumer) 
-    : stmtParser{ consumer }, 
-      tokenConsumer{ consumer } {}
+syntax::FunctionParser::FunctionParser(TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+    : stmtParser{ consumer, arena }, 
+      tokenConsumer{ consumer }, 
+      arena{ arena } {}
 
-std::unique_ptr<syntax::ast::ASTFunction> syntax::FunctionParser::parseFunction(){
+syntax::ast::ASTPtr<syntax::ast::ASTFunction> syntax::FunctionParser::parseFunction(){
+    const size_t firstToken{ tokenConsumer.getConsumedCount() };
     auto type{ syntax::tokenTypeToType(tokenConsumer.getToken().type) };
     tokenConsumer.consume(syntax::GeneralTokenType::TYPE);
 
     const syntax::Token& token{ tokenConsumer.getToken() };
     tokenConsumer.consume(syntax::TokenType::ID);
     
-    std::unique_ptr<syntax::ast::ASTFunction> function{ 
-        std::make_unique<syntax::ast::ASTFunction>(token, type) 
+    syntax::ast::ASTPtr<syntax::ast::ASTFunction> function{ 
+        arena.make<syntax::ast::ASTFunction>(token, type) 
     };
 
     tokenConsumer.consume(syntax::TokenType::LPAREN);
@@ -24,10 +26,12 @@ std::unique_ptr<syntax::ast::ASTFunction> syntax::FunctionParser::parseFunction(
     if(tokenConsumer.getToken().type == syntax::TokenType::SEMICOLON){
         tokenConsumer.consume(syntax::TokenType::SEMICOLON);
         function->setPredefined(true);
+        function->setCost(tokenConsumer.getConsumedCount() - firstToken);
         return function;
     }
 
     parseBody(function.get());
+    function->setCost(tokenConsumer.getConsumedCount() - firstToken);
     
     return function;
 }
@@ -45,7 +49,7 @@ void syntax::FunctionParser::parseParameters(syntax::ast::ASTFunction* function)
             const auto& token{ tokenConsumer.getToken() };
             tokenConsumer.consume(syntax::TokenType::ID);
 
-            function->addParameter(std::make_unique<syntax::ast::ASTParameter>(token, type));
+            function->addParameter(arena.make<syntax::ast::ASTParameter>(token, type));
         }
     };
 
@@ -0,0 +1,170 @@
+#include "../parallel_parser.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <span>
+
+#include "../parser.hpp"
+#include "../function_parser.hpp"
+#include "../directive_parser.hpp"
+#include "../token_consumer.hpp"
+#include "../../thread-pool/task_group.hpp"
+
+syntax::ParallelParser::ParallelParser(lex::Lexer& lexer, util::concurrency::ThreadPool& threadPool)
+    : lexer{ lexer }, threadPool{ threadPool } {}
+
+std::unique_ptr<syntax::ast::ASTProgram> syntax::ParallelParser::parseProgram(){
+    // without workers the split would only add a pass over the tokens
+    if(threadPool.size() == 0){
+        return parseSerially();
+    }
+
+    const auto ranges{ split() };
+    if(!ranges){
+        return parseSerially();
+    }
+
+    const std::span<const syntax::Token> tokens{ lexer.getTokens() };
+    const syntax::Token& eofToken{ tokens.back() };
+    auto program{ std::make_unique<syntax::ast::ASTProgram>(syntax::Token{}) };
+
+    // directives are few and short, they are parsed on the calling thread
+    std::vector<TopLevelRange> functionRanges;
+    size_t functionTokens{ 0 };
+    for(const auto& range : *ranges){
+        if(range.isFunction){
+            functionRanges.push_back(range);
+            functionTokens += range.end - range.begin;
+            continue;
+        }
+
+        try{
+            syntax::TokenConsumer consumer{ tokens.subspan(range.begin, range.end - range.begin), eofToken };
+            syntax::DirectiveParser dirParser{ consumer, program->getArena() };
+            program->addDir(dirParser.parseDir());
+            if(!consumer.consumedRange()){
+                return parseSerially();
+            }
+        }
+        catch(const std::exception&){
+            return parseSerially();
+        }
+    }
+
+    // consecutive functions are grouped into batches of roughly the same number of tokens
+    const size_t batchCount{ std::min(functionRanges.size(), std::max<size_t>(threadPool.size(), 1) * batchesPerWorker) };
+    std::vector<size_t> batchEnds;
+    batchEnds.reserve(batchCount);
+    size_t batchTokens{ 0 };
+    for(size_t i{ 0 }; i < functionRanges.size(); ++i){
+        batchTokens += functionRanges[i].end - functionRanges[i].begin;
+        if(batchTokens * batchCount >= functionTokens * (batchEnds.size() + 1) || i + 1 == functionRanges.size()){
+            batchEnds.push_back(i + 1);
+        }
+    }
+
+    std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>> functions(functionRanges.size());
+    std::vector<char> batchFailed(batchEnds.size(), false);
+
+    // arenas are added up front, the program is not touched by the batches
+    std::vector<syntax::ast::ASTArena*> arenas;
+    arenas.reserve(batchEnds.size());
+    for(size_t batch{ 0 }; batch < batchEnds.size(); ++batch){
+        arenas.push_back(&program->addArena());
+    }
+
+    util::concurrency::parallelFor(threadPool, 0, batchEnds.size(), 1,
+        [&](size_t batch) -> void {
+            const size_t first{ batch == 0 ? 0 : batchEnds[batch - 1] };
+            try{
+                for(size_t i{ first }; i < batchEnds[batch] && !batchFailed[batch]; ++i){
+                    const auto& range{ functionRanges[i] };
+                    syntax::TokenConsumer consumer{ tokens.subspan(range.begin, range.end - range.begin), eofToken };
+                    syntax::FunctionParser funcParser{ consumer, *arenas[batch] };
+                    functions[i] = funcParser.parseFunction();
+                    batchFailed[batch] = !consumer.consumedRange();
+                }
+            }
+            catch(const std::exception&){
+                batchFailed[batch] = true;
+            }
+        }
+    );
+
+    // error is reported by the serial parser, so it does not depend on the order the batches failed in
+    if(std::ranges::any_of(batchFailed, [](char failed) -> bool { return failed; })){
+        return parseSerially();
+    }
+
+    for(auto& function : functions){
+        program->addFunction(std::move(function));
+    }
+
+    return program;
+}
+
+std::optional<std::vector<syntax::ParallelParser::TopLevelRange>> syntax::ParallelParser::split() const {
+    const std::span<const syntax::Token> tokens{ lexer.getTokens() };
+    std::vector<TopLevelRange> ranges;
+
+    size_t i{ 0 };
+    while(i < tokens.size() && tokens[i].type != syntax::TokenType::_EOF){
+        const size_t begin{ i };
+
+        if(tokens[i].type == syntax::TokenType::HASH){
+            // DIR : HASH INCLUDE COLON ID
+            constexpr size_t directiveLength{ 4 };
+            if(i + directiveLength >= tokens.size()){
+                return std::nullopt;
+            }
+            ranges.push_back({ .begin = begin, .end = i + directiveLength, .isFunction = false });
+            i += directiveLength;
+            continue;
+        }
+
+        if(tokens[i].gtype != syntax::GeneralTokenType::TYPE){
+            return std::nullopt;
+        }
+
+        // function ends with the semicolon of a declaration or with the brace matching the opening one
+        while(tokens[i].type != syntax::TokenType::LBRACE && tokens[i].type != syntax::TokenType::SEMICOLON){
+            if(tokens[i].type == syntax::TokenType::_EOF){
+                return std::nullopt;
+            }
+            ++i;
+        }
+
+        if(tokens[i].type == syntax::TokenType::LBRACE){
+            size_t depth{ 0 };
+            do {
+                if(tokens[i].type == syntax::TokenType::LBRACE){
+                    ++depth;
+                }
+                else if(tokens[i].type == syntax::TokenType::RBRACE){
+                    --depth;
+                }
+                else if(tokens[i].type == syntax::TokenType::_EOF){
+                    return std::nullopt;
+                }
+                ++i;
+            } while(depth > 0);
+        }
+        else {
+            ++i;
+        }
+
+        ranges.push_back({ .begin = begin, .end = i, .isFunction = true });
+    }
+
+    if(i >= tokens.size()){
+        return std::nullopt;
+    }
+
+    return ranges;
+}
+
+std::unique_ptr<syntax::ast::ASTProgram> syntax::ParallelParser::parseSerially(){
+    syntax::TokenConsumer tokenConsumer{ lexer };
+    syntax::Parser parser{ tokenConsumer };
+    return parser.parseProgram();
+}
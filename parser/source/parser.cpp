@@ -1,19 +1,17 @@
 #include "../parser.hpp"
 
 #include <memory>
+#include <utility>
 
 #include "../token_consumer.hpp"
 
 syntax::Parser::Parser(TokenConsumer& consumer) 
-    : funcParser{ consumer }, 
-      dirParser{ consumer }, 
+    : program{ std::make_unique<syntax::ast::ASTProgram>(syntax::Token{}) }, 
+      funcParser{ consumer, program->getArena() }, 
+      dirParser{ consumer, program->getArena() }, 
       tokenConsumer{ consumer } {}
 
 std::unique_ptr<syntax::ast::ASTProgram> syntax::Parser::parseProgram(){
-    std::unique_ptr<syntax::ast::ASTProgram> program{ 
-        std::make_unique<syntax::ast::ASTProgram>(syntax::Token{"program", 0, 0})
-    };
-    
     while(true) {
         const auto& token{ tokenConsumer.getToken() };
 
@@ -31,5 +29,5 @@ std::unique_ptr<syntax::ast::ASTProgram> syntax::Parser::parseProgram(){
     // check if input ends correctly
     tokenConsumer.consume(syntax::TokenType::_EOF);
 
-    return program;
+    return std::move(program);
 }
\ No newline at end of file
@@ -5,11 +5,12 @@
 #include "../token_consumer.hpp"
 #include "../../common/defs/type_mapping.hpp"
 
-syntax::StatementParser::StatementParser(TokenConsumer& consumer) 
-    : exprParser{ consumer }, 
-      tokenConsumer{ consumer } {}
+syntax::StatementParser::StatementParser(TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+    : exprParser{ consumer, arena }, 
+      tokenConsumer{ consumer }, 
+      arena{ arena } {}
 
-std::unique_ptr<syntax::ast::ASTStmt> syntax::StatementParser::parseStmt(){
+syntax::ast::ASTPtr<syntax::ast::ASTStmt> syntax::StatementParser::parseStmt(){
     const auto& token{ tokenConsumer.getToken() };
     if(token.gtype == syntax::GeneralTokenType::TYPE){
         return parseVariableDeclStmt();
@@ -52,18 +53,18 @@ std::unique_ptr<syntax::ast::ASTStmt> syntax::StatementParser::parseStmt(){
     
     throw std::runtime_error(
         std::format("Line {}, Column {}: SYNTAX ERROR -> near '{}'",
-            token.line, token.column, token.value
+            token.line(), token.column(), token.value()
         )
     );
 }
 
-std::unique_ptr<syntax::ast::ASTVariableDeclStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTVariableDeclStmt> 
 syntax::StatementParser::parseVariableDeclStmt(){
     auto type{ syntax::tokenTypeToType(tokenConsumer.getToken().type) };
     tokenConsumer.consume(syntax::GeneralTokenType::TYPE);
 
-    std::unique_ptr<syntax::ast::ASTVariableDeclStmt> variableDecl{ 
-        std::make_unique<syntax::ast::ASTVariableDeclStmt>(tokenConsumer.getToken(), type)
+    syntax::ast::ASTPtr<syntax::ast::ASTVariableDeclStmt> variableDecl{ 
+        arena.make<syntax::ast::ASTVariableDeclStmt>(tokenConsumer.getToken(), type)
     };
     tokenConsumer.consume(syntax::TokenType::ID);
     
@@ -76,14 +77,10 @@ syntax::StatementParser::parseVariableDeclStmt(){
     return variableDecl;
 }
 
-std::unique_ptr<syntax::ast::ASTCompoundStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTCompoundStmt> 
 syntax::StatementParser::parseCompoundStmt(){
-    std::unique_ptr<syntax::ast::ASTCompoundStmt> compoundStmt{ 
-        std::make_unique<syntax::ast::ASTCompoundStmt>(syntax::Token{
-            "compound_stmt", 
-            tokenConsumer.getToken().line, 
-            tokenConsumer.getToken().column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTCompoundStmt> compoundStmt{ 
+        arena.make<syntax::ast::ASTCompoundStmt>(syntax::Token{ tokenConsumer.getToken() })
     };
 
     tokenConsumer.consume(syntax::TokenType::LBRACE);
@@ -95,16 +92,12 @@ syntax::StatementParser::parseCompoundStmt(){
     return compoundStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTAssignStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTAssignStmt> 
 syntax::StatementParser::parseAssignStmt(bool expectsSemicolon){
-    std::unique_ptr<syntax::ast::ASTIdExpr> variableExpr{ exprParser.parseIdExpr() };
+    syntax::ast::ASTPtr<syntax::ast::ASTIdExpr> variableExpr{ exprParser.parseIdExpr() };
     
-    std::unique_ptr<syntax::ast::ASTAssignStmt> assignStmt{ 
-        std::make_unique<syntax::ast::ASTAssignStmt>(syntax::Token{
-            "=", 
-            tokenConsumer.getToken().line, 
-            tokenConsumer.getToken().column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTAssignStmt> assignStmt{ 
+        arena.make<syntax::ast::ASTAssignStmt>(syntax::Token{ tokenConsumer.getToken() })
     };
     tokenConsumer.consume(syntax::TokenType::ASSIGN);
     
@@ -117,15 +110,11 @@ syntax::StatementParser::parseAssignStmt(bool expectsSemicolon){
     return assignStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTReturnStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTReturnStmt> 
 syntax::StatementParser::parseReturnStmt(){
     const auto& returnToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTReturnStmt> returnStmt{ 
-        std::make_unique<syntax::ast::ASTReturnStmt>(syntax::Token{
-            "return_stmt", 
-            returnToken.line, 
-            returnToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTReturnStmt> returnStmt{ 
+        arena.make<syntax::ast::ASTReturnStmt>(syntax::Token{ returnToken })
     };
     tokenConsumer.consume(syntax::TokenType::RETURN);
 
@@ -137,15 +126,11 @@ syntax::StatementParser::parseReturnStmt(){
     return returnStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTIfStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTIfStmt> 
 syntax::StatementParser::parseIfStmt(){
     const auto& ifToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTIfStmt> ifStmt{ 
-        std::make_unique<syntax::ast::ASTIfStmt>(syntax::Token{
-            "if_stmt", 
-            ifToken.line, 
-            ifToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTIfStmt> ifStmt{ 
+        arena.make<syntax::ast::ASTIfStmt>(syntax::Token{ ifToken })
     };
     tokenConsumer.consume(syntax::TokenType::IF);
 
@@ -174,15 +159,11 @@ syntax::StatementParser::parseIfStmt(){
     return ifStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTWhileStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTWhileStmt> 
 syntax::StatementParser::parseWhileStmt(){
     const auto& whileToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTWhileStmt> whileStmt{ 
-        std::make_unique<syntax::ast::ASTWhileStmt>(syntax::Token{
-            "while_stmt", 
-            whileToken.line, 
-            whileToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTWhileStmt> whileStmt{ 
+        arena.make<syntax::ast::ASTWhileStmt>(syntax::Token{ whileToken })
     };
     tokenConsumer.consume(syntax::TokenType::WHILE);
     
@@ -195,20 +176,16 @@ syntax::StatementParser::parseWhileStmt(){
     return whileStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTForStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTForStmt> 
 syntax::StatementParser::parseForStmt(){
     const auto& forToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTForStmt> forStmt{ 
-        std::make_unique<syntax::ast::ASTForStmt>(syntax::Token{
-            "for_stmt", 
-            forToken.line, 
-            forToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTForStmt> forStmt{ 
+        arena.make<syntax::ast::ASTForStmt>(syntax::Token{ forToken })
     };
     tokenConsumer.consume(syntax::TokenType::FOR);
 
-    std::unique_ptr<syntax::ast::ASTAssignStmt> forInitializer{ nullptr }, forIncrementer{ nullptr };
-    std::unique_ptr<syntax::ast::ASTExpr> condition{ nullptr };
+    syntax::ast::ASTPtr<syntax::ast::ASTAssignStmt> forInitializer{ nullptr }, forIncrementer{ nullptr };
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> condition{ nullptr };
 
     tokenConsumer.consume(syntax::TokenType::LPAREN);
     // optional initializer
@@ -238,19 +215,15 @@ syntax::StatementParser::parseForStmt(){
     return forStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTDoWhileStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTDoWhileStmt> 
 syntax::StatementParser::parseDoWhileStmt(){
     const auto& dowhileToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTDoWhileStmt> dowhileStmt{
-        std::make_unique<syntax::ast::ASTDoWhileStmt>(syntax::Token{
-            "dowhile_statement", 
-            dowhileToken.line, 
-            dowhileToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTDoWhileStmt> dowhileStmt{
+        arena.make<syntax::ast::ASTDoWhileStmt>(syntax::Token{ dowhileToken })
     };
     tokenConsumer.consume(syntax::TokenType::DO);
 
-    std::unique_ptr<syntax::ast::ASTStmt> stmt{ parseStmt() };
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> stmt{ parseStmt() };
 
     tokenConsumer.consume(syntax::TokenType::WHILE);
     tokenConsumer.consume(syntax::TokenType::LPAREN);
@@ -261,15 +234,11 @@ syntax::StatementParser::parseDoWhileStmt(){
     return dowhileStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTFunctionCallStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTFunctionCallStmt> 
 syntax::StatementParser::parseFunctionCallStmt(){
     const auto& callToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTFunctionCallStmt> callStmt{ 
-        std::make_unique<syntax::ast::ASTFunctionCallStmt>(syntax::Token{
-            "call_stmt", 
-            callToken.line, 
-            callToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTFunctionCallStmt> callStmt{ 
+        arena.make<syntax::ast::ASTFunctionCallStmt>(syntax::Token{ callToken })
     };
     callStmt->setFunctionCallStmt(exprParser.parseFunctionCallExpr());
     tokenConsumer.consume(syntax::TokenType::SEMICOLON);
@@ -277,15 +246,11 @@ syntax::StatementParser::parseFunctionCallStmt(){
     return callStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTSwitchStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTSwitchStmt> 
 syntax::StatementParser::parseSwitchStmt(){
     const auto& switchToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTSwitchStmt> switchStmt{ 
-        std::make_unique<syntax::ast::ASTSwitchStmt>(syntax::Token{
-            "switch_stmt", 
-            switchToken.line, 
-            switchToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTSwitchStmt> switchStmt{ 
+        arena.make<syntax::ast::ASTSwitchStmt>(syntax::Token{ switchToken })
     };
     tokenConsumer.consume(syntax::TokenType::SWITCH);
 
@@ -308,15 +273,11 @@ syntax::StatementParser::parseSwitchStmt(){
     return switchStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTSwitchBlockStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTSwitchBlockStmt> 
 syntax::StatementParser::parseSwitchBlockStmt(){
     const auto& swBlockToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTSwitchBlockStmt> switchBlockStmt{ 
-        std::make_unique<syntax::ast::ASTSwitchBlockStmt>(syntax::Token{
-            "switch_block_stmt", 
-            swBlockToken.line, 
-            swBlockToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTSwitchBlockStmt> switchBlockStmt{ 
+        arena.make<syntax::ast::ASTSwitchBlockStmt>(syntax::Token{ swBlockToken })
     };
     
     while(true){
@@ -335,23 +296,19 @@ syntax::StatementParser::parseSwitchBlockStmt(){
     return switchBlockStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTCaseStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTCaseStmt> 
 syntax::StatementParser::parseCaseStmt(){
     bool hasBreak{ false };
     const auto& caseToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTCaseStmt> caseStmt{ 
-        std::make_unique<syntax::ast::ASTCaseStmt>(syntax::Token{
-            "case", 
-            caseToken.line, 
-            caseToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTCaseStmt> caseStmt{ 
+        arena.make<syntax::ast::ASTCaseStmt>(syntax::Token{ caseToken })
     };
     
     tokenConsumer.consume(syntax::TokenType::CASE);
-    std::unique_ptr<syntax::ast::ASTLiteralExpr> literalExpr{ exprParser.parseLiteralExpr() };
+    syntax::ast::ASTPtr<syntax::ast::ASTLiteralExpr> literalExpr{ exprParser.parseLiteralExpr() };
     tokenConsumer.consume(syntax::TokenType::COLON);
     
-    std::unique_ptr<syntax::ast::ASTSwitchBlockStmt> switchBlockStmt{ parseSwitchBlockStmt() };
+    syntax::ast::ASTPtr<syntax::ast::ASTSwitchBlockStmt> switchBlockStmt{ parseSwitchBlockStmt() };
     if(tokenConsumer.getToken().type == syntax::TokenType::BREAK){
         hasBreak = true;
         parseBreakStmt();
@@ -362,15 +319,11 @@ syntax::StatementParser::parseCaseStmt(){
     return caseStmt;
 }
 
-std::unique_ptr<syntax::ast::ASTDefaultStmt> 
+syntax::ast::ASTPtr<syntax::ast::ASTDefaultStmt> 
 syntax::StatementParser::parseDefaultStmt(){
     const auto& defaultToken{ tokenConsumer.getToken() };
-    std::unique_ptr<syntax::ast::ASTDefaultStmt> defaultStmt{ 
-        std::make_unique<syntax::ast::ASTDefaultStmt>(syntax::Token{
-            "default", 
-            defaultToken.line, 
-            defaultToken.column
-        })
+    syntax::ast::ASTPtr<syntax::ast::ASTDefaultStmt> defaultStmt{ 
+        arena.make<syntax::ast::ASTDefaultStmt>(syntax::Token{ defaultToken })
     };
     tokenConsumer.consume(syntax::TokenType::DEFAULT);
     tokenConsumer.consume(syntax::TokenType::COLON);
@@ -3,18 +3,22 @@
 #include <format>
 #include <stdexcept>
 
-syntax::TokenConsumer::TokenConsumer(lex::Lexer& lexer) : lexer{ lexer } {} 
+syntax::TokenConsumer::TokenConsumer(lex::Lexer& lexer) 
+    : lexer{ &lexer }, nextTokenIdx{ 1 } {}
+
+syntax::TokenConsumer::TokenConsumer(std::span<const syntax::Token> tokens, const syntax::Token& endToken) 
+    : lexer{ nullptr }, tokens{ tokens }, endToken{ endToken }, nextTokenIdx{ 1 } {}
 
 void syntax::TokenConsumer::consume(syntax::TokenType expectedType) {
     const auto& token{ getToken() };
     if(token.type != expectedType){
         throw std::runtime_error(
             std::format("Line {}, Column {}: SYNTAX ERROR -> expected '{}', got '{} {}'",
-            token.line, 
-            token.column, 
+            token.line(), 
+            token.column(), 
             syntax::tokenTypeToStr(expectedType), 
             syntax::tokenTypeToStr(token.type), 
-            token.value
+            token.value()
         ));
     }
     next();
@@ -25,11 +29,11 @@ void syntax::TokenConsumer::consume(syntax::GeneralTokenType expectedGType) {
     if(token.gtype != expectedGType){
         throw std::runtime_error(
             std::format("Line {}, Column {}: SYNTAX ERROR -> expected '{}', got '{} {}'",
-            token.line, 
-            token.column, 
+            token.line(), 
+            token.column(), 
             syntax::generalTokenTypeToStr(expectedGType), 
             syntax::generalTokenTypeToStr(token.gtype), 
-            token.value
+            token.value()
         ));
     }
     next();
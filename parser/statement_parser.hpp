@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include "../common/abstract-syntax-tree/ast_arena.hpp"
 #include "../common/abstract-syntax-tree/ast_stmt.hpp"
 #include "../common/abstract-syntax-tree/ast_variable_decl_stmt.hpp"
 #include "../common/abstract-syntax-tree/ast_compound_stmt.hpp"
@@ -28,8 +29,9 @@ namespace syntax {
         /** 
          * @brief Creates new instance of the parser specialized for statements
          * @param consumer - reference to token handler wrapped around the lexer 
+         * @param arena - reference to the arena the parsed nodes are placed into
         */
-        StatementParser(TokenConsumer& consumer);
+        StatementParser(TokenConsumer& consumer, ast::ASTArena& arena);
 
         /** 
          * @brief parses statement
@@ -56,21 +58,21 @@ namespace syntax {
          * | SWITCH_STATEMENT
          * @return pointer to the statement node
         */
-        std::unique_ptr<ast::ASTStmt> parseStmt();
+        ast::ASTPtr<ast::ASTStmt> parseStmt();
 
         /** 
          * @brief parses variable declaration
          * @details VARIABLE_DECL : TYPE ID (ASSIGN EXPRESSION)? SEMICOLON
          * @returns pointer to a variable declaration node
         */
-        std::unique_ptr<ast::ASTVariableDeclStmt> parseVariableDeclStmt();
+        ast::ASTPtr<ast::ASTVariableDeclStmt> parseVariableDeclStmt();
 
         /** 
          * @brief parses compound statement
          * @details COMPOUND_STATEMENT : LBRACE (STATEMENT)? RBRACE
          * @returns pointer to a compound statement node
         */
-        std::unique_ptr<ast::ASTCompoundStmt> parseCompoundStmt();
+        ast::ASTPtr<ast::ASTCompoundStmt> parseCompoundStmt();
 
         /** 
          * @brief parses assignment statement
@@ -78,14 +80,14 @@ namespace syntax {
          * @details ASSIGNMENT_STATEMENT : ID ASSIGN EXPRESSION SEMICOLON
          * @returns pointer to an assignment statement node
         */
-        std::unique_ptr<ast::ASTAssignStmt> parseAssignStmt(bool expectsSemicolon = true);
+        ast::ASTPtr<ast::ASTAssignStmt> parseAssignStmt(bool expectsSemicolon = true);
 
         /** 
          * @brief parses return statement
          * @details RETURN_STATEMENT : RETURN (EXPRESSION)? SEMICOLON
          * @returns pointer to a return statement node
         */
-        std::unique_ptr<ast::ASTReturnStmt> parseReturnStmt();
+        ast::ASTPtr<ast::ASTReturnStmt> parseReturnStmt();
 
         /** 
         * @brief parses if statement
@@ -100,63 +102,63 @@ namespace syntax {
         * | IF_STATEMENT ELSE STATEMENT
         * @returns pointer to an if statement node
         */
-        std::unique_ptr<ast::ASTIfStmt> parseIfStmt();
+        ast::ASTPtr<ast::ASTIfStmt> parseIfStmt();
 
         /** 
         * @brief parses while statement
         * @details WHILE_STATEMENT : WHILE LPAREN EXPRESSION RPAREN STATEMENT
         * @returns pointer to a while statement node
         */
-        std::unique_ptr<ast::ASTWhileStmt> parseWhileStmt();
+        ast::ASTPtr<ast::ASTWhileStmt> parseWhileStmt();
 
         /** 
         * @brief parses for statement
         * @details FOR_STATEMENT : FOR LPAREN (ASSIGN_STATEMENT SEMICOLON)? (EXPRESSION SEMICOLON)? (ASSIGNMENT_STATEMENT)? RPAREN STATEMENT
         * @returns pointer to a for statement node
         */
-        std::unique_ptr<ast::ASTForStmt> parseForStmt();
+        ast::ASTPtr<ast::ASTForStmt> parseForStmt();
 
         /** 
         * @brief parses do-while statement
         * @details DO_WHILE_STATEMENT : DO STATEMENT WHILE LPAREN EXPRESSION RPAREN SEMICOLON
         * @returns pointer to a do-while statement node
         */
-        std::unique_ptr<ast::ASTDoWhileStmt> parseDoWhileStmt();
+        ast::ASTPtr<ast::ASTDoWhileStmt> parseDoWhileStmt();
 
         /** 
         * @brief parses function-call statement
         * @details FUNCTION_CALL_STATEMENT : FUNCTION_CALL SEMICOLON
         * @returns pointer to a function-call statement node
         */
-        std::unique_ptr<ast::ASTFunctionCallStmt> parseFunctionCallStmt();
+        ast::ASTPtr<ast::ASTFunctionCallStmt> parseFunctionCallStmt();
 
         /** 
         * @brief parses switch statement
         * @details SWITCH_STATEMENT : SWITCH LPAREN ID RPAREN LBRACE (_CASE)+ (_DEFAULT)? RBRACE
         * @returns pointer to a switch statement node
         */
-        std::unique_ptr<ast::ASTSwitchStmt> parseSwitchStmt();
+        ast::ASTPtr<ast::ASTSwitchStmt> parseSwitchStmt();
 
         /** 
         * @brief parses swtich-case block
         * @details SWITCH_CASE_BLOCK : (STATEMENT)*
         * @returns pointer to a switch-case block node
         */
-        std::unique_ptr<ast::ASTSwitchBlockStmt> parseSwitchBlockStmt();
+        ast::ASTPtr<ast::ASTSwitchBlockStmt> parseSwitchBlockStmt();
 
         /** 
         * @brief parses case of the switch statement
         * @details _CASE : CASE LITERAL COLON SWITCH_CASE_BLOCK (_BREAK)?
         * @returns pointer to a case statement node
         */
-        std::unique_ptr<ast::ASTCaseStmt> parseCaseStmt();
+        ast::ASTPtr<ast::ASTCaseStmt> parseCaseStmt();
 
         /** 
         * @brief parses default case of the switch statement
         * @details _DEFAULT : DEFAULT COLON SWITCH_CASE_BLOCK (_BREAK)?
         * @returns pointer to a default statement node
         */
-        std::unique_ptr<ast::ASTDefaultStmt> parseDefaultStmt();
+        ast::ASTPtr<ast::ASTDefaultStmt> parseDefaultStmt();
 
         /** 
         * @brief parses break statement
@@ -171,6 +173,9 @@ namespace syntax {
         /// reference to a token handler wrapped around the lexer
         TokenConsumer& tokenConsumer;
 
+        /// reference to the arena the parsed nodes are placed into
+        ast::ASTArena& arena;
+
     };
 
 }
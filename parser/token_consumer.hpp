@@ -1,12 +1,16 @@
 #ifndef TOKEN_CONSUMER_HPP
 #define TOKEN_CONSUMER_HPP
 
+#include <cstddef>
+#include <span>
+
 #include "../lexer/lexer.hpp"
 
 namespace syntax {
     /**
      * @class TokenConsumer
      * @brief Lexer wrapper, shared across parsers, non-owning
+     * @details reads either through the lexer or from a range of already tokenized input
     */
     class TokenConsumer {
     public:
@@ -16,20 +20,36 @@ namespace syntax {
          * @note token consumer is a wrapper around the lexer
         */
         TokenConsumer(lex::Lexer& lexer);
+
+        /** 
+         * @brief Creates instance of the token consumer reading a range of tokens
+         * @param tokens - range of tokens, has to outlive the consumer
+         * @param endToken - token returned after the end of the range
+         * @note consumers of distinct ranges can be used concurrently
+        */
+        TokenConsumer(std::span<const Token> tokens, const Token& endToken);
         
         /** 
          * @brief moving on to the next token
         */
         inline void next() noexcept {
-            lexer.next();
+            ++consumedCount;
+            if(lexer){
+                lexer->next();
+                return;
+            }
+            ++nextTokenIdx;
         }
 
         /** 
          * @brief peeking at the next token
-         * @returns const reference to the next token
+         * @returns copy of the next token
         */
-        inline const Token& peek() const noexcept {
-            return lexer.peek();
+        inline Token peek() const noexcept {
+            if(lexer){
+                return lexer->peek();
+            }
+            return nextTokenIdx < tokens.size() ? tokens[nextTokenIdx] : endToken;
         }
 
         /** 
@@ -48,15 +68,48 @@ namespace syntax {
 
         /** 
          * @brief getter for the token currently processed
-         * @return const reference to a currently processed token
+         * @return copy of the currently processed token
+         * @note tokens are returned by value, in streaming mode their slot in the ring is reused
+        */
+        inline Token getToken() const noexcept {
+            if(lexer){
+                return lexer->current();
+            }
+            return nextTokenIdx - 1 < tokens.size() ? tokens[nextTokenIdx - 1] : endToken;
+        }
+
+        /**
+         * @brief checks if the whole range has been consumed
+         * @returns true if the current token is past the end of the range, false otherwise
+         * @note meaningful only for a consumer reading a range
         */
-        inline const Token& getToken() const noexcept {
-            return lexer.current();
+        inline bool consumedRange() const noexcept {
+            return nextTokenIdx - 1 == tokens.size();
+        }
+
+        /**
+         * @brief getter for the number of consumed tokens
+         * @returns number of tokens moved past by this consumer
+        */
+        inline size_t getConsumedCount() const noexcept {
+            return consumedCount;
         }
 
     private:
-        /// reference to a lexer containing tokenized input
-        lex::Lexer& lexer;
+        /// pointer to a lexer containing tokenized input, null when reading a range
+        lex::Lexer* lexer;
+
+        /// range of tokens read when there is no lexer
+        std::span<const Token> tokens;
+
+        /// token returned after the end of the range
+        Token endToken;
+
+        /// index of a token in the range that should be processed next
+        size_t nextTokenIdx;
+
+        /// number of tokens moved past by this consumer
+        size_t consumedCount{ 0 };
 
     };
 
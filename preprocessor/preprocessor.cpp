@@ -1,97 +1,161 @@
 #include "preprocessor.hpp"
 
-#include <cassert>
-#include <cctype>
-#include <fstream>
+#include <format>
 #include <sstream>
+#include <utility>
 
 #include "../common/preprocessing/preprocessing_libs.hpp"
 
-void preprocessing::Preprocessor::preprocess(const std::string& source) {
-    size_t index{0};
-    size_t len{ source.length() };
+preprocessing::Preprocessor::Preprocessor(util::concurrency::ThreadPool& threadPool, util::timing::PassTimer* timer)
+    : threadPool{ &threadPool }, timer{ timer } {}
 
-    while(index < len){
-        if(source[index] == '#'){
-            handleDirective(source, index);
+preprocessing::Preprocessor::~Preprocessor(){
+    // queued tasks refer to the preprocessor even when their library was loaded by another thread
+    std::unique_lock<std::mutex> lock(mtx);
+    progress.wait(lock, [this] -> bool { return pendingTasks == 0; });
+}
+
+void preprocessing::Preprocessor::include(std::string_view libName){
+    Library* library;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto [entry, inserted]{ libraries.try_emplace(std::string{ libName }) };
+        if(!inserted){
+            return;
         }
-        else {
-            ++index;
+        library = &entry->second;
+        libName = entry->first;
+        if(threadPool){
+            ++pendingTasks;
         }
     }
 
-    preprocessed.push_back(std::move(source));
-}
+    if(!threadPool){
+        ensureLoaded(libName, *library);
+        return;
+    }
 
-const std::vector<std::string>& 
-preprocessing::Preprocessor::getPreprocessed() const noexcept {
-    return preprocessed;
+    // name and entry are owned by the map, they outlive the task
+    threadPool->enqueue(
+        [this, libName, library] -> void {
+            ensureLoaded(libName, *library);
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                --pendingTasks;
+            }
+            progress.notify_all();
+        }
+    );
 }
 
-bool preprocessing::Preprocessor::hasErrors() const noexcept {
-    return !preprocessErrors.empty();
+void preprocessing::Preprocessor::wait(){
+    std::vector<std::pair<std::string_view, Library*>> requested;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        requested.reserve(libraries.size());
+        for(auto& [name, library] : libraries){
+            requested.emplace_back(name, &library);
+        }
+    }
+
+    for(const auto& [name, library] : requested){
+        ensureLoaded(name, *library);
+    }
 }
 
-std::string preprocessing::Preprocessor::getPreprocessErrors() const noexcept {
-    if(preprocessErrors.empty()){
-        return "";
+std::optional<std::string_view> preprocessing::Preprocessor::getSource(std::string_view libName){
+    Library* library;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto entry{ libraries.find(libName) };
+        if(entry == libraries.end()){
+            return std::nullopt;
+        }
+        library = &entry->second;
+        libName = entry->first;
     }
 
-    std::stringstream errors{"Preprocessing failed:\n"};
-    for(const auto& error : preprocessErrors){
-        errors << error << "\n";
+    ensureLoaded(libName, *library);
+    if(library->failed || library->interface){
+        return std::nullopt;
     }
 
-    return errors.str();
+    // view stays valid, mapping itself is not relocated
+    return library->source.view();
 }
 
-void preprocessing::Preprocessor::handleDirective(const std::string& source, size_t& idx){
-    size_t start{++idx};
-    while(std::isalpha(source[idx])){
-        ++idx;
-    }
-
-    if(start == idx){
-        return;
+std::vector<const preprocessing::LibraryInterface*> preprocessing::Preprocessor::getInterfaces() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<const preprocessing::LibraryInterface*> interfaces;
+    for(const auto& [name, library] : libraries){
+        if(library.interface){
+            interfaces.push_back(&*library.interface);
+        }
     }
+    return interfaces;
+}
 
-    std::string directive{ source.substr(start, idx - start) };
-    if(directive == "include"){
-        handleInclude(source, idx);
+bool preprocessing::Preprocessor::hasErrors() const noexcept {
+    std::lock_guard<std::mutex> lock(mtx);
+    for(const auto& [name, library] : libraries){
+        if(library.failed){
+            return true;
+        }
     }
+    return false;
 }
 
-void preprocessing::Preprocessor::handleInclude(const std::string& source, size_t& idx){
-    if(source[idx] != ':'){
-        return;
+std::string preprocessing::Preprocessor::getPreprocessErrors() const noexcept {
+    if(!hasErrors()){
+        return "";
     }
 
-    size_t start{ ++idx };
-    while(std::isalnum(source[idx])){
-        ++idx;
+    std::lock_guard<std::mutex> lock(mtx);
+    std::stringstream errors{"Preprocessing failed:\n"};
+    for(const auto& [name, library] : libraries){
+        if(library.failed){
+            errors << std::format("Failed to load library \"{}\"\n", name) << "\n";
+        }
     }
 
-    if(start == idx){
+    return errors.str();
+}
+
+void preprocessing::Preprocessor::load(std::string_view libName, Library& library){
+    // declarations of the up to date interface replace the library source
+    if(auto interface{ preprocessing::LibraryInterface::load(libName) }){
+        library.interface = std::move(interface);
         return;
     }
 
-    std::string includeLib{ source.substr(start, idx - start) };
-    std::string includeLibPath{ preprocessing::generateLibSourcePath(includeLib) };
-
-    if(!includedLibraries.contains(includeLib)){
-        includedLibraries.insert(includeLib);
-        std::ifstream inputFileStream(includeLibPath);
+    library.source = util::io::MappedFile{ preprocessing::generateLibSourcePath(libName) };
+    library.failed = !library.source.isOpen();
+}
 
-        if(!inputFileStream.is_open()){
-            preprocessErrors.push_back(std::format("Failed to load library \"{}\"\n", includeLib));
+void preprocessing::Preprocessor::ensureLoaded(std::string_view libName, Library& library){
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if(library.state == LoadState::LOADING){
+            progress.wait(lock, [&library] -> bool { return library.state == LoadState::LOADED; });
+        }
+        if(library.state == LoadState::LOADED){
             return;
         }
-
-        std::stringstream input;
-        input << inputFileStream.rdbuf();
-        inputFileStream.close();
-
-        preprocess(input.str());
+        library.state = LoadState::LOADING;
     }
 
-}
+    // load is claimed, it runs outside the lock so other libraries load concurrently
+    {
+        // library name is interned only for the trace
+        util::timing::PassGuard passGuard{ 
+            timer, util::timing::Pass::PREPROCESS,
+            util::tracing::enabled() ? util::text::StringInterner::intern(libName) : util::text::StringInterner::emptyId
+        };
+        load(libName, library);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        library.state = LoadState::LOADED;
+    }
+    progress.notify_all();
+}
\ No newline at end of file
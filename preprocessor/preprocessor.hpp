@@ -2,73 +2,158 @@
 #define PREPROCESSOR_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 #include <vector>
 
+#include "../common/source/mapped_file.hpp"
+#include "../common/preprocessing/library_interface.hpp"
+#include "../thread-pool/thread_pool.hpp"
+#include "../common/timing/pass_timer.hpp"
+
 /**
  * @namespace preprocessing
  * @brief module containing elements related to preprocessing
 */
 namespace preprocessing {
-    /** 
+    /**
      * @class Preprocessor
-     * @brief used for preprocessing source file
+     * @brief loads the libraries included by the source
+     * @details lexer requests a library as soon as it emits the include directive,
+     * every library is loaded once, in the background when a thread pool is given,
+     * so loading overlaps the lexing of the rest of the input,
+     * library needed before its load has started is loaded by the thread that needs it,
+     * so waiting for a library never depends on a free worker
     */
     class Preprocessor {
     public:
-        /** 
-         * @brief Creates the instance of the preprocessor
+        /**
+         * @brief Creates the instance of the preprocessor, libraries are loaded on the calling thread
         */
         Preprocessor() = default;
 
-        /** 
-         * @brief entry point for preprocessing of the source file
-         * @param source - reference to a source code
+        /**
+         * @brief Creates the instance of the preprocessor
+         * @param threadPool - reference to a thread pool the libraries are loaded on
+         * @param timer - pointer to the timer the loads are measured by, nullptr for none
+        */
+        explicit Preprocessor(util::concurrency::ThreadPool& threadPool, util::timing::PassTimer* timer = nullptr);
+
+        /**
+         * @brief waits for the scheduled loads
+        */
+        ~Preprocessor();
+
+        /// deleted copy constructor
+        Preprocessor(const Preprocessor&) = delete;
+
+        /// deleted copy assignment operator
+        Preprocessor& operator=(const Preprocessor&) = delete;
+
+        /**
+         * @brief requests the library, repeated requests are ignored
+         * @param libName - name of the included library
+         * @note thread-safe
+        */
+        void include(std::string_view libName);
+
+        /**
+         * @brief waits until every requested library is loaded
         */
-        void preprocess(const std::string& source);
+        void wait();
 
-        /** 
-         * @brief getter for the vector of preprocessed files
-         * @returns vector of preprocessed files containing the source code of each
+        /**
+         * @brief getter for the source of the library, waits until the library is loaded
+         * @param libName - name of the requested library
+         * @returns view of the source that has to be tokenized, nullopt if the library has an interface, failed to load or was not requested
+         * @note view is valid for the lifetime of the preprocessor
         */
-        const std::vector<std::string>& getPreprocessed() const noexcept;
+        std::optional<std::string_view> getSource(std::string_view libName);
 
-        /** 
+        /**
+         * @brief getter for the precompiled interfaces
+         * @returns interfaces of the included libraries, ordered by the name of the library
+         * @note valid after wait(), interfaces live as long as the preprocessor
+        */
+        std::vector<const LibraryInterface*> getInterfaces() const;
+
+        /**
          * @brief flag if any error were caught in preprocessing phase
          * @returns false if no errors were found, true otherwise
         */
         bool hasErrors() const noexcept;
 
-        /** 
+        /**
          * @brief getter for the preprocessing errors
          * @returns errors merged into a string
         */
         std::string getPreprocessErrors() const noexcept;
 
     private:
-        /// vector of preprocessed files containing the source code of each
-        std::vector<std::string> preprocessed;
-
-        /// unordered_set of included libraries
-        std::unordered_set<std::string> includedLibraries;
-        
-        /// errors of the preprocessing phase
-        std::vector<std::string> preprocessErrors;
-
-        /** 
-         * @brief handles the directive
-         * @param source - reference to a source code
-         * @param idx - current index in the source code
+        /**
+         * @enum LoadState
+         * @brief progress of the load of the library
         */
-        void handleDirective(const std::string& source, size_t& idx);
-        
-        /** 
-         * @brief handles the include directive
-         * @param source - reference to a source code
-         * @param idx - current index in the source code
+        enum class LoadState : uint8_t {
+            QUEUED,     //< load has not started
+            LOADING,    //< load is in progress
+            LOADED      //< source or interface is available, or the load failed
+        };
+
+        /**
+         * @struct Library
+         * @brief loaded library, either its source or its interface
+        */
+        struct Library {
+            /// progress of the load
+            LoadState state{ LoadState::QUEUED };
+
+            /// memory mapped source, used when there is no up to date interface
+            util::io::MappedFile source;
+
+            /// precompiled interface of the library
+            std::optional<LibraryInterface> interface;
+
+            /// flag if the library could not be loaded
+            bool failed{ false };
+        };
+
+        /// thread pool the libraries are loaded on, null for loading on the calling thread
+        util::concurrency::ThreadPool* threadPool{ nullptr };
+
+        /// timer the loads are measured by, null for none
+        util::timing::PassTimer* timer{ nullptr };
+
+        /// mutex for the requested libraries
+        mutable std::mutex mtx;
+
+        /// notified when a load or a scheduled task completes
+        std::condition_variable progress;
+
+        /// number of scheduled tasks that have not completed
+        size_t pendingTasks{ 0 };
+
+        /// requested libraries by name, entries are never relocated
+        std::map<std::string, Library, std::less<>> libraries;
+
+        /**
+         * @brief loads the library unless its load has already started, then waits until it is loaded
+         * @param libName - name of the library
+         * @param library - reference to the entry of the library
+        */
+        void ensureLoaded(std::string_view libName, Library& library);
+
+        /**
+         * @brief loads the source or the interface of the library
+         * @param libName - name of the library
+         * @param library - reference to the entry of the library
         */
-        void handleInclude(const std::string& source, size_t& idx);
+        static void load(std::string_view libName, Library& library);
 
     };
 
@@ -0,0 +1,173 @@
+#include "function_table.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#include "../../thread-pool/task_group.hpp"
+
+std::vector<size_t> semantic::FunctionTable::registerFunctions(
+    const std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>>& newFunctions,
+    util::concurrency::ThreadPool& threadPool
+){
+    const size_t first{ functions.size() };
+    const size_t count{ newFunctions.size() };
+    functions.resize(first + count);
+    reserve(first + count);
+
+    // small programs are registered on the calling thread
+    const size_t batchCount{
+        std::clamp<size_t>(count / minBatchSize, 1, std::max<size_t>(threadPool.size(), 1) * batchesPerWorker)
+    };
+    auto forEachBatch{
+        [&](auto&& work) -> void {
+            util::concurrency::parallelFor(threadPool, 0, batchCount, 1,
+                [&work, count, batchCount](size_t batch) -> void {
+                    work(batch, count * batch / batchCount, count * (batch + 1) / batchCount);
+                }
+            );
+        }
+    };
+
+    // signatures are copied first, so every batch knows where its parameter types start
+    std::vector<size_t> batchParameters(batchCount, 0);
+    forEachBatch(
+        [&](size_t batch, size_t begin, size_t end) -> void {
+            for(size_t i{ begin }; i < end; ++i){
+                const auto& function{ newFunctions[i] };
+                const auto parameterCount{ static_cast<uint32_t>(function->getParameters().size()) };
+                functions[first + i] = FunctionEntry{ function->getSymbolId(), function->getType(), 0, parameterCount };
+                batchParameters[batch] += parameterCount;
+            }
+        }
+    );
+
+    size_t parametersEnd{ parameterTypes.size() };
+    for(auto& parameters : batchParameters){
+        parametersEnd += std::exchange(parameters, parametersEnd);
+    }
+    parameterTypes.resize(parametersEnd);
+
+    forEachBatch(
+        [&](size_t batch, size_t begin, size_t end) -> void {
+            size_t nextParameter{ batchParameters[batch] };
+            for(size_t i{ begin }; i < end; ++i){
+                auto& entry{ functions[first + i] };
+                entry.parametersBegin = static_cast<uint32_t>(nextParameter);
+                for(const auto& parameter : newFunctions[i]->getParameters()){
+                    parameterTypes[nextParameter++] = parameter->getType();
+                }
+                index(static_cast<uint32_t>(first + i));
+            }
+        }
+    );
+
+    // index keeps the first declaration of every name, the rest are redefinitions regardless of the batch order
+    std::vector<size_t> redefinitions;
+    for(size_t i{ 0 }; i < count; ++i){
+        if(slots[findSlot(functions[first + i].id)] != first + i + 1){
+            redefinitions.push_back(i);
+        }
+    }
+
+    return redefinitions;
+}
+
+bool semantic::FunctionTable::declare(util::text::SymbolId id, types::Type type, std::span<const types::Type> parameters){
+    reserve(functions.size() + 1);
+    if(lookup(id)){
+        return false;
+    }
+
+    functions.push_back(
+        FunctionEntry{ id, type, static_cast<uint32_t>(parameterTypes.size()), static_cast<uint32_t>(parameters.size()) }
+    );
+    parameterTypes.insert(parameterTypes.end(), parameters.begin(), parameters.end());
+    index(static_cast<uint32_t>(functions.size() - 1));
+    return true;
+}
+
+const semantic::FunctionEntry* semantic::FunctionTable::lookup(util::text::SymbolId id) const noexcept {
+    if(slots.empty()){
+        return nullptr;
+    }
+
+    const uint32_t slot{ slots[findSlot(id)] };
+    return slot == emptySlot ? nullptr : &functions[slot - 1];
+}
+
+const semantic::FunctionEntry& semantic::FunctionTable::getFunction(util::text::SymbolId id) const {
+    const auto* function{ lookup(id) };
+    if(!function){
+        throw std::out_of_range(std::format("function '{}' not found", util::text::StringInterner::name(id)));
+    }
+    return *function;
+}
+
+std::span<const types::Type> semantic::FunctionTable::getParameterTypes(const semantic::FunctionEntry& function) const noexcept {
+    return std::span<const types::Type>{ parameterTypes }.subspan(function.parametersBegin, function.parameterCount);
+}
+
+size_t semantic::FunctionTable::findSlot(util::text::SymbolId id) const noexcept {
+    // ids are dense, odd multiplier spreads the consecutive ones over the index
+    const size_t mask{ slots.size() - 1 };
+    size_t slot{ static_cast<size_t>(id * 0x9E3779B9u) & mask };
+    while(slots[slot] != emptySlot && functions[slots[slot] - 1].id != id){
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void semantic::FunctionTable::index(uint32_t position) noexcept {
+    const util::text::SymbolId id{ functions[position].id };
+    const size_t mask{ slots.size() - 1 };
+    size_t slot{ static_cast<size_t>(id * 0x9E3779B9u) & mask };
+
+    // slot only changes from empty to a function, or to an earlier function of the same name,
+    // so the probe sequences seen by the other threads stay valid
+    while(true){
+        std::atomic_ref<uint32_t> occupant{ slots[slot] };
+        uint32_t current{ occupant.load(std::memory_order_acquire) };
+        if(current == emptySlot){
+            if(occupant.compare_exchange_weak(current, position + 1, std::memory_order_acq_rel)){
+                return;
+            }
+            continue;
+        }
+
+        if(functions[current - 1].id == id){
+            if(current <= position + 1){
+                return;
+            }
+            if(occupant.compare_exchange_weak(current, position + 1, std::memory_order_acq_rel)){
+                return;
+            }
+            continue;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+void semantic::FunctionTable::reserve(size_t functionCount){
+    // index is kept at most half full, so probe sequences stay short
+    if(functionCount * 2 <= slots.size()){
+        return;
+    }
+
+    std::vector<uint32_t> indexed;
+    indexed.reserve(slots.size());
+    for(const uint32_t slot : slots){
+        if(slot != emptySlot){
+            indexed.push_back(slot - 1);
+        }
+    }
+
+    slots.assign(std::max(minSlots, std::bit_ceil(functionCount * 2)), emptySlot);
+    for(const uint32_t position : indexed){
+        index(position);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#ifndef FUNCTION_TABLE_HPP
+#define FUNCTION_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../../common/defs/types.hpp"
+#include "../../common/symbol/string_interner.hpp"
+#include "../../common/abstract-syntax-tree/ast_function.hpp"
+#include "../../thread-pool/thread_pool.hpp"
+
+namespace semantic {
+    /**
+     * @struct FunctionEntry
+     * @brief signature of the function registered in the function table
+    */
+    struct FunctionEntry {
+        /// interned name of the function
+        util::text::SymbolId id;
+
+        /// return type of the function
+        types::Type type;
+
+        /// position of the first parameter type in the table
+        uint32_t parametersBegin;
+
+        /// number of parameters
+        uint32_t parameterCount;
+    };
+
+    /**
+     * @class FunctionTable
+     * @brief table of the functions visible from every function of the program
+     * @details signatures are registered in parallel before the functions are checked,
+     * after that the table is only read, so lookups take no locks,
+     * parameter types are stored inline next to each other instead of behind the parameters of the ast
+    */
+    class FunctionTable {
+    public:
+        /**
+         * @brief Creates the instance of the empty function table
+        */
+        FunctionTable() = default;
+
+        /**
+         * @brief registers the signatures of the functions
+         * @param newFunctions - functions of the program in declaration order
+         * @param threadPool - reference to a thread pool the signatures are registered on
+         * @returns positions of the functions that redefine an earlier declared function, in ascending order
+         * @note not thread-safe, the table must not be read while the functions are registered
+        */
+        std::vector<size_t> registerFunctions(
+            const std::vector<syntax::ast::ASTPtr<syntax::ast::ASTFunction>>& newFunctions,
+            util::concurrency::ThreadPool& threadPool
+        );
+
+        /**
+         * @brief registers the signature of a single function
+         * @param id - interned name of the function
+         * @param type - return type of the function
+         * @param parameterTypes - types of the parameters
+         * @returns true if the function is registered, false if the function already exists
+         * @note not thread-safe
+        */
+        bool declare(util::text::SymbolId id, types::Type type, std::span<const types::Type> parameterTypes = {});
+
+        /**
+         * @brief looks up the function
+         * @param id - interned name of the function
+         * @returns const pointer to the function if it exists, nullptr otherwise
+        */
+        const FunctionEntry* lookup(util::text::SymbolId id) const noexcept;
+
+        /**
+         * @brief gets the function
+         * @param id - interned name of the function
+         * @returns const reference to the function
+         * @throws std::out_of_range - when the function doesn't exist
+        */
+        const FunctionEntry& getFunction(util::text::SymbolId id) const;
+
+        /**
+         * @brief getter for the parameter types of the function
+         * @param function - const reference to the function of this table
+         * @returns types of the parameters in declaration order
+        */
+        std::span<const types::Type> getParameterTypes(const FunctionEntry& function) const noexcept;
+
+    private:
+        /// marks the empty slot of the index
+        static constexpr uint32_t emptySlot{ 0 };
+
+        /// minimal number of the slots in the index
+        static constexpr size_t minSlots{ 16 };
+
+        /// number of functions below which a batch is not worth a task
+        static constexpr size_t minBatchSize{ 256 };
+
+        /// number of batches per worker thread, so uneven batches still keep every worker busy
+        static constexpr size_t batchesPerWorker{ 4 };
+
+        /// registered functions, redefinitions included, in registration order
+        std::vector<FunctionEntry> functions;
+
+        /// parameter types of the registered functions
+        std::vector<types::Type> parameterTypes;
+
+        /// linear probing index, slot holds position of the function + 1, size is a power of two
+        std::vector<uint32_t> slots;
+
+        /**
+         * @brief finds the slot of the function
+         * @param id - interned name of the function
+         * @returns index of the slot holding the function, or of the empty slot the function would be placed in
+        */
+        size_t findSlot(util::text::SymbolId id) const noexcept;
+
+        /**
+         * @brief places the function into the index, earlier registered function of the same name wins
+         * @param position - position of the function
+         * @note safe to call concurrently for different functions
+        */
+        void index(uint32_t position) noexcept;
+
+        /**
+         * @brief resizes the index for the number of functions and places the indexed functions into it again
+         * @param functionCount - number of functions the index has to hold
+        */
+        void reserve(size_t functionCount);
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -4,44 +4,34 @@ semantic::ScopeManager::ScopeManager(semantic::SymbolTable& symTab)
     : symbolTable{ symTab } {}
 
 void semantic::ScopeManager::pushScope(){
-    scope.push({});
+    scopeBegins.push_back(symbolTable.size());
 }
 
 void semantic::ScopeManager::popScope(){
-    auto& out{ scope.top() };
-    // deleting symbols that went out of scope from symbol table
-    while(!out.empty()){
-        symbolTable.deleteSymbol(out.top());
-        out.pop();
-    }
-    scope.pop();
+    // symbols declared in the scope are the newest ones in the table
+    symbolTable.truncate(scopeBegins.back());
+    scopeBegins.pop_back();
 }
 
 bool semantic::ScopeManager::pushSymbol(const semantic::Symbol& symbol){
-    if(symbolTable.insertSymbol(symbol.getName(), symbol)){
-        scope.top().push(symbol.getName());
-        return true;
-    }
-    return false;
+    return symbolTable.insertSymbol(symbol);
 }
 
 const semantic::SymbolTable& semantic::ScopeManager::getSymbolTable() const noexcept {
     return symbolTable;
 }
 
-semantic::Symbol& semantic::ScopeManager::getSymbol(const std::string& name) const {
-    return symbolTable.getSymbol(name);
+semantic::Symbol& semantic::ScopeManager::getSymbol(util::text::SymbolId id) const {
+    return symbolTable.getSymbol(id);
 }
 
 const semantic::Symbol* semantic::ScopeManager::lookupSymbol(
-    const std::string& name, std::initializer_list<semantic::Kind> kinds
+    util::text::SymbolId id, std::initializer_list<semantic::Kind> kinds
 ) const {
-    return symbolTable.lookupSymbol(name, kinds);
+    return symbolTable.lookupSymbol(id, kinds);
 }
 
 void semantic::ScopeManager::clear() noexcept {
-    while(!scope.empty()){
-        scope.pop();
-    }
+    scopeBegins.clear();
     symbolTable.clearSymbols();
 }
\ No newline at end of file
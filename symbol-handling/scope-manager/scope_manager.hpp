@@ -1,7 +1,8 @@
 #ifndef SCOPE_MANAGER_HPP
 #define SCOPE_MANAGER_HPP
 
-#include <stack>
+#include <cstddef>
+#include <vector>
 #include <initializer_list>
 
 #include "../symbol-table/symbol_table.hpp"
@@ -20,17 +21,17 @@ namespace semantic {
         ScopeManager(SymbolTable& symTab);
 
         /** 
-         * @brief adding an empty stack when new scope is entered
+         * @brief marks the beginning of the new scope
         */
         void pushScope();
 
         /** 
-         * @brief removing a stack when scope is exited and clearing symbols that are expired
+         * @brief removes the symbols declared since the beginning of the innermost scope
         */
         void popScope();
 
         /** 
-         * @brief inserts symbol into symbol table, and adds its key to the most recent scope
+         * @brief inserts symbol into symbol table, it belongs to the most recent scope
          * @param symbol - symbol that is being inserted into symbol table
          * @returns true if symbol is inserted, false if symbol already exists
         */
@@ -44,19 +45,19 @@ namespace semantic {
 
         /**
          * @brief gets the symbol from the symbol table
-         * @param name - name of the requested symbol
-         * @returns reference to a symbol with a given name
+         * @param id - interned name of the requested symbol
+         * @returns reference to a symbol with a given id
         */
-        semantic::Symbol& getSymbol(const std::string& name) const;
+        semantic::Symbol& getSymbol(util::text::SymbolId id) const;
 
         /** 
          * @brief checks if symbol exists in a table
-         * @param name - name of the symbol
+         * @param id - interned name of the symbol
          * @param kinds - list of kinds that symbol is allowed to have
          * @returns const pointer to symbol if symbol exists, nullptr otherwise
         */
         const semantic::Symbol* 
-        lookupSymbol(const std::string& name, std::initializer_list<Kind> kinds) const;
+        lookupSymbol(util::text::SymbolId id, std::initializer_list<Kind> kinds) const;
 
         /**
          * @brief clears all scopes
@@ -67,8 +68,8 @@ namespace semantic {
         /// table of active symbols
         SymbolTable& symbolTable;
         
-        /// stack of scopes
-        std::stack<std::stack<std::string>> scope;
+        /// number of symbols in the table when each of the open scopes began
+        std::vector<size_t> scopeBegins;
 
     };
 
@@ -1,32 +1,85 @@
 #include "symbol_table.hpp"
 
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
 const semantic::Symbol* semantic::SymbolTable::lookupSymbol(
-    const std::string& name, std::initializer_list<semantic::Kind> kinds
+    util::text::SymbolId id, std::initializer_list<semantic::Kind> kinds
 ) const {
-    auto it{ symbolTable.find(name) };
-    if(it != symbolTable.end()){
+    if(symbols.empty()){
+        return nullptr;
+    }
+
+    const uint32_t slot{ slots[findSlot(id)] };
+    if(slot != emptySlot){
+        const auto& symbol{ symbols[slot - 1] };
         for(const auto& kind : kinds){
-            if(it->second.getKind() == kind){
-                return &it->second;
+            if(symbol.getKind() == kind){
+                return &symbol;
             }
         }
     }
     return nullptr;
 }
 
-bool semantic::SymbolTable::insertSymbol(const std::string& name, const semantic::Symbol& symbol){
-    auto result{ symbolTable.insert({name, symbol}) };
-    return result.second; // false if symbol was already in symbol table
+bool semantic::SymbolTable::insertSymbol(const semantic::Symbol& symbol){
+    // index is kept at most half full, so probe sequences stay short
+    if((symbols.size() + 1) * 2 > slots.size()){
+        grow();
+    }
+
+    const size_t slot{ findSlot(symbol.getId()) };
+    if(slots[slot] != emptySlot){
+        return false; // symbol was already in symbol table
+    }
+
+    symbols.push_back(symbol);
+    slots[slot] = static_cast<uint32_t>(symbols.size());
+    return true;
+}
+
+semantic::Symbol& semantic::SymbolTable::getSymbol(util::text::SymbolId id){
+    const uint32_t slot{ symbols.empty() ? emptySlot : slots[findSlot(id)] };
+    if(slot == emptySlot){
+        throw std::out_of_range(std::format("symbol '{}' not found", util::text::StringInterner::name(id)));
+    }
+    return symbols[slot - 1];
 }
 
-semantic::Symbol& semantic::SymbolTable::getSymbol(const std::string& name){
-    return symbolTable.at(name);
+size_t semantic::SymbolTable::size() const noexcept {
+    return symbols.size();
 }
 
-void semantic::SymbolTable::deleteSymbol(const std::string& name){
-    symbolTable.erase(name);
+void semantic::SymbolTable::truncate(size_t symbolCount) noexcept {
+    // probe sequence of a symbol never passes over the slot of a newer one,
+    // so emptying the slots newest first leaves the remaining symbols reachable
+    while(symbols.size() > symbolCount){
+        slots[findSlot(symbols.back().getId())] = emptySlot;
+        symbols.pop_back();
+    }
 }
 
 void semantic::SymbolTable::clearSymbols() noexcept {
-    symbolTable.clear();
+    symbols.clear();
+    std::fill(slots.begin(), slots.end(), emptySlot);
+}
+
+size_t semantic::SymbolTable::findSlot(util::text::SymbolId id) const noexcept {
+    // ids are dense, fibonacci hashing spreads the consecutive ones over the index
+    const size_t mask{ slots.size() - 1 };
+    size_t slot{ static_cast<size_t>(id * 0x9E3779B9u) & mask };
+    while(slots[slot] != emptySlot && symbols[slots[slot] - 1].getId() != id){
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void semantic::SymbolTable::grow(){
+    slots.assign(std::max(minSlots, slots.size() * 2), emptySlot);
+
+    // symbols are placed in insertion order, so truncation stays valid in the new index
+    for(size_t i{ 0 }; i < symbols.size(); ++i){
+        slots[findSlot(symbols[i].getId())] = static_cast<uint32_t>(i + 1);
+    }
 }
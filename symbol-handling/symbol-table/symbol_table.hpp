@@ -1,15 +1,22 @@
 #ifndef SYMBOL_TABLE_HPP
 #define SYMBOL_TABLE_HPP
 
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 #include <initializer_list>
 
 #include "../../common/symbol/symbol.hpp"
+#include "../../common/symbol/string_interner.hpp"
 
 namespace semantic {
     /** 
      * @class SymbolTable
      * @brief maintaining the table of symbols
+     * @details symbols are stored in insertion order, which is also the order they go out of scope in,
+     * open addressing index maps the interned name to the position of the symbol,
+     * so leaving a scope truncates the symbols instead of erasing them one by one,
+     * memory is kept when symbols are removed, so a reused table stops allocating
     */
     class SymbolTable {
     public:
@@ -20,32 +27,38 @@ namespace semantic {
 
         /** 
          * @brief checks if symbol exists in a table
-         * @param name - name of the symbol
+         * @param id - interned name of the symbol
          * @param kinds - list of kinds that symbol is allowed to have
          * @returns const pointer to symbol if symbol exists, nullptr otherwise
         */
-        const semantic::Symbol* lookupSymbol(const std::string& name, std::initializer_list<Kind> kinds) const;
+        const semantic::Symbol* lookupSymbol(util::text::SymbolId id, std::initializer_list<Kind> kinds) const;
 
         /** 
-         * @brief inserts symbol into the symbol table if the symbol with the given name doesn't exist
-         * @param name - name of the symbol
+         * @brief inserts symbol into the symbol table if the symbol with the same id doesn't exist
          * @param symbol - constant reference to a symbol that should be inserted
          * @returns true if insertion is successful, false if symbol already exists
         */
-        bool insertSymbol(const std::string& name, const semantic::Symbol& symbol);
+        bool insertSymbol(const semantic::Symbol& symbol);
 
         /** 
          * @brief gets the symbol from the symbol table
-         * @param name - name of the requested symbol
-         * @returns reference to a symbol with the given name
+         * @param id - interned name of the requested symbol
+         * @returns reference to a symbol with the given id
+         * @throws std::out_of_range - when the symbol doesn't exist
         */
-        semantic::Symbol& getSymbol(const std::string& name);
+        semantic::Symbol& getSymbol(util::text::SymbolId id);
+
+        /**
+         * @brief getter for the number of symbols
+         * @returns number of symbols in the table
+        */
+        size_t size() const noexcept;
 
         /** 
-         * @brief removes symbol from symbol table
-         * @param name - name of the symbol that should be deleted
+         * @brief removes the most recently inserted symbols
+         * @param symbolCount - number of the oldest symbols that are kept
         */
-        void deleteSymbol(const std::string& name);
+        void truncate(size_t symbolCount) noexcept;
 
         /** 
          * @brief removes all symbols from the symbol table
@@ -53,8 +66,29 @@ namespace semantic {
         void clearSymbols() noexcept;
 
     private:
-        /// mapping symbol name to symbol
-        std::unordered_map<std::string, semantic::Symbol> symbolTable;
+        /// marks the empty slot of the index
+        static constexpr uint32_t emptySlot{ 0 };
+
+        /// minimal number of the slots in the index
+        static constexpr size_t minSlots{ 16 };
+
+        /// symbols in insertion order
+        std::vector<semantic::Symbol> symbols;
+
+        /// linear probing index, slot holds position of the symbol + 1, size is a power of two
+        std::vector<uint32_t> slots;
+
+        /**
+         * @brief finds the slot of the symbol
+         * @param id - interned name of the symbol
+         * @returns index of the slot holding the symbol, or of the empty slot the symbol would be placed in
+        */
+        size_t findSlot(util::text::SymbolId id) const noexcept;
+
+        /**
+         * @brief doubles the index and places the symbols into it again
+        */
+        void grow();
 
     };
 
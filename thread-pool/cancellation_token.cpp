@@ -0,0 +1,81 @@
+#include "cancellation_token.hpp"
+
+#include <algorithm>
+
+util::concurrency::CancellationToken::CancellationToken(size_t maxErrors, size_t itemCount)
+    : maxErrors{ maxErrors }, itemCount{ maxErrors != 0 ? itemCount : 0 } {
+    if(this->itemCount != 0){
+        itemErrors = std::make_unique<size_t[]>(itemCount);
+        itemFinished = std::make_unique<bool[]>(itemCount);
+    }
+}
+
+void util::concurrency::CancellationToken::cancel() noexcept {
+    cancelled.store(true, std::memory_order_relaxed);
+}
+
+void util::concurrency::CancellationToken::reportErrors(size_t count) noexcept {
+    if(count == 0){
+        return;
+    }
+    // errors outside of the items would stop the items in the order they ran in
+    if(errors.fetch_add(count, std::memory_order_relaxed) + count >= maxErrors && maxErrors != 0 && itemCount == 0){
+        cancel();
+    }
+}
+
+void util::concurrency::CancellationToken::reportErrors(size_t item, size_t count){
+    if(itemCount == 0){
+        reportErrors(count);
+        return;
+    }
+    if(count == 0){
+        return;
+    }
+
+    errors.fetch_add(count, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(itemsMtx);
+    itemErrors[item] += count;
+
+    // first errors of the item right past the finished ones are final, it needs to find no more of them
+    if(item == frontier && frontierErrors + itemErrors[item] >= maxErrors){
+        cutoff.store(std::min(cutoff.load(std::memory_order_relaxed), item), std::memory_order_relaxed);
+    }
+}
+
+void util::concurrency::CancellationToken::finishItem(size_t item){
+    if(itemCount == 0){
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(itemsMtx);
+    itemFinished[item] = true;
+    advance();
+}
+
+bool util::concurrency::CancellationToken::isCancelled() const noexcept {
+    // token is only a hint to stop, results of the stopped tasks are published by the task group
+    return cancelled.load(std::memory_order_relaxed);
+}
+
+bool util::concurrency::CancellationToken::isCancelled(size_t item) const noexcept {
+    return isCancelled() || (itemCount != 0 && item >= cutoff.load(std::memory_order_relaxed));
+}
+
+size_t util::concurrency::CancellationToken::getReportedErrors() const noexcept {
+    return errors.load(std::memory_order_relaxed);
+}
+
+size_t util::concurrency::CancellationToken::getMaxErrors() const noexcept {
+    return maxErrors;
+}
+
+void util::concurrency::CancellationToken::advance() noexcept {
+    while(frontier < itemCount && itemFinished[frontier]){
+        frontierErrors += itemErrors[frontier];
+        ++frontier;
+    }
+    if(frontierErrors >= maxErrors){
+        cutoff.store(std::min(cutoff.load(std::memory_order_relaxed), frontier), std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
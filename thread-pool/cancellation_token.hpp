@@ -0,0 +1,136 @@
+#ifndef CANCELLATION_TOKEN_HPP
+#define CANCELLATION_TOKEN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace util::concurrency {
+    /**
+     * @class CancellationToken
+     * @brief flag shared by the tasks of a job, tasks check it at safe points and stop once it is set
+     * @details token is set explicitly, or once the reported errors reach the error limit,
+     * tasks that have not started when the token is set are dropped,
+     * token over ordered items stops only the items past the first ones whose errors reach the limit,
+     * so the first errors in item order are the same whatever order the items ran in
+    */
+    class CancellationToken {
+    public:
+        /**
+         * @brief Creates the instance of the token without an error limit
+        */
+        CancellationToken() = default;
+
+        /**
+         * @brief Creates the instance of the token with an error limit
+         * @param maxErrors - number of reported errors that sets the token, 0 for no limit
+         * @param itemCount - number of the ordered items the errors are reported for, 0 for unordered errors
+        */
+        explicit CancellationToken(size_t maxErrors, size_t itemCount = 0);
+
+        /// deleted copy constructor
+        CancellationToken(const CancellationToken&) = delete;
+
+        /// deleted assignment operator
+        CancellationToken& operator=(const CancellationToken&) = delete;
+
+        /**
+         * @brief sets the token, every item is stopped
+         * @note thread-safe
+        */
+        void cancel() noexcept;
+
+        /**
+         * @brief adds the errors to the reported ones, sets the token once they reach the limit
+         * @param count - number of the new errors
+         * @note thread-safe, errors are only counted when the token is over ordered items
+        */
+        void reportErrors(size_t count) noexcept;
+
+        /**
+         * @brief adds the errors of the item to the reported ones
+         * @param item - position of the item the errors were found in
+         * @param count - number of the new errors
+         * @note thread-safe, errors of the unordered token are reported as with reportErrors(count)
+        */
+        void reportErrors(size_t item, size_t count);
+
+        /**
+         * @brief marks the item as finished, its errors are complete
+         * @param item - position of the finished item
+         * @note thread-safe
+        */
+        void finishItem(size_t item);
+
+        /**
+         * @brief checks if the token is set
+         * @returns true if the work should stop, false otherwise
+         * @note thread-safe
+        */
+        bool isCancelled() const noexcept;
+
+        /**
+         * @brief checks if the item should stop
+         * @param item - position of the item
+         * @returns true if the token is set or the errors of the items up to this one already reach the limit, false otherwise
+         * @note thread-safe
+        */
+        bool isCancelled(size_t item) const noexcept;
+
+        /**
+         * @brief getter for the number of reported errors
+         * @returns number of the errors reported so far
+         * @note thread-safe
+        */
+        size_t getReportedErrors() const noexcept;
+
+        /**
+         * @brief getter for the error limit
+         * @returns number of reported errors that sets the token, 0 for no limit
+        */
+        size_t getMaxErrors() const noexcept;
+
+    private:
+        /// number of reported errors that sets the token, 0 for no limit
+        const size_t maxErrors{ 0 };
+
+        /// number of the ordered items, 0 for unordered errors
+        const size_t itemCount{ 0 };
+
+        /// number of reported errors
+        std::atomic<size_t> errors{ 0 };
+
+        /// flag if the token is set
+        std::atomic<bool> cancelled{ false };
+
+        /// first item whose work is no longer needed, items before it stop only when the token is set
+        std::atomic<size_t> cutoff{ SIZE_MAX };
+
+        /// mutex for the state of the ordered items
+        std::mutex itemsMtx;
+
+        /// errors of every item
+        std::unique_ptr<size_t[]> itemErrors;
+
+        /// flag of every item if it is finished
+        std::unique_ptr<bool[]> itemFinished;
+
+        /// first item that is not finished, every item before it is
+        size_t frontier{ 0 };
+
+        /// errors of the items before the frontier
+        size_t frontierErrors{ 0 };
+
+        /**
+         * @brief moves the frontier past the finished items and sets the cutoff once their errors reach the limit
+         * @note itemsMtx has to be held
+        */
+        void advance() noexcept;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "task_group.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+util::concurrency::TaskGroup::TaskGroup(ThreadPool& threadPool, const CancellationToken* cancellation)
+    : threadPool{ threadPool }, cancellation{ cancellation } {}
+
+util::concurrency::TaskGroup::~TaskGroup(){
+    // queued tasks refer to the group
+    join();
+}
+
+void util::concurrency::TaskGroup::wait(){
+    join();
+
+    std::exception_ptr caught;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        caught = std::exchange(error, nullptr);
+    }
+    if(caught){
+        std::rethrow_exception(caught);
+    }
+}
+
+void util::concurrency::TaskGroup::finish() noexcept {
+    // notified under the lock, waiting thread cannot see the group finished before the notification is done
+    std::lock_guard<std::mutex> lock(mtx);
+    if(pending.fetch_sub(1) == 1){
+        done.notify_all();
+    }
+}
+
+void util::concurrency::TaskGroup::join() noexcept {
+    while(pending.load() > 0){
+        if(threadPool.runPendingTask()){
+            continue;
+        }
+
+        // nothing left to help with, remaining tasks of the group are running on other threads
+        std::unique_lock<std::mutex> lock(mtx);
+        done.wait(lock, [this] -> bool { return pending.load() == 0; });
+    }
+
+    // last task may still hold the lock it finished under
+    std::lock_guard<std::mutex> lock(mtx);
+}
+
+util::concurrency::CostSchedule util::concurrency::scheduleByCost(std::span<const size_t> costs, size_t threadCount){
+    CostSchedule schedule;
+    schedule.indices.resize(costs.size());
+    std::iota(schedule.indices.begin(), schedule.indices.end(), 0);
+    if(costs.empty()){
+        return schedule;
+    }
+
+    // every index costs at least the overhead of its call
+    auto weight{ [costs](size_t i) -> size_t { return costs[i] + 1; } };
+    std::ranges::stable_sort(
+        schedule.indices, 
+        [&weight](size_t lhs, size_t rhs) -> bool { return weight(lhs) > weight(rhs); }
+    );
+
+    size_t totalCost{ 0 };
+    for(size_t i{ 0 }; i < costs.size(); ++i){
+        totalCost += weight(i);
+    }
+    const size_t taskShare{ std::max<size_t>(totalCost / (std::max<size_t>(threadCount, 1) * chunksPerThread), 1) };
+
+    size_t taskCost{ 0 };
+    size_t taskBegin{ 0 };
+    for(size_t i{ 0 }; i < schedule.indices.size(); ++i){
+        taskCost += weight(schedule.indices[i]);
+        if(taskCost >= taskShare || i + 1 == schedule.indices.size()){
+            // batched indices are visited in source order
+            std::sort(
+                schedule.indices.begin() + static_cast<std::ptrdiff_t>(taskBegin), 
+                schedule.indices.begin() + static_cast<std::ptrdiff_t>(i + 1)
+            );
+            schedule.taskEnds.push_back(i + 1);
+            taskBegin = i + 1;
+            taskCost = 0;
+        }
+    }
+
+    return schedule;
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#ifndef TASK_GROUP_HPP
+#define TASK_GROUP_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "thread_pool.hpp"
+#include "cancellation_token.hpp"
+#include "../common/tracing/trace.hpp"
+
+namespace util::concurrency {
+    /**
+     * @class TaskGroup
+     * @brief group of tasks executed on the thread pool that are waited for together
+     * @details thread waiting for the group executes queued tasks of the pool instead of blocking,
+     * it blocks only when every unfinished task of the group is already running on another thread,
+     * first exception thrown by a task of the group is rethrown to the waiting thread,
+     * queued tasks that have not started when the cancellation token is set are dropped
+    */
+    class TaskGroup {
+    public:
+        /**
+         * @brief Creates the instance of the empty task group
+         * @param threadPool - reference to a thread pool the tasks are executed on
+         * @param cancellation - const pointer to the token that drops the tasks not yet started, nullptr for none
+        */
+        explicit TaskGroup(ThreadPool& threadPool, const CancellationToken* cancellation = nullptr);
+
+        /**
+         * @brief waits for the tasks of the group, their exceptions are dropped
+        */
+        ~TaskGroup();
+
+        /// deleted copy constructor
+        TaskGroup(const TaskGroup&) = delete;
+
+        /// deleted assignment operator
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        /**
+         * @brief adds the task to the group and queues it on the thread pool
+         * @tparam Fn - invocable type
+         * @param fn - added task
+         * @throws std::runtime_error - when the thread pool is stopped
+        */
+        template<std::invocable Fn>
+        void run(Fn&& fn){
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                pending.fetch_add(1);
+            }
+
+            try{
+                threadPool.enqueue(
+                    [this, fn=std::forward<Fn>(fn), queued=util::tracing::queuedAt()] mutable -> void {
+                        if(!isCancelled()){
+                            util::tracing::TaskScope taskScope{ queued };
+                            execute(fn);
+                        }
+                        finish();
+                    }
+                );
+            }
+            catch(...){
+                finish();
+                throw;
+            }
+        }
+
+        /**
+         * @brief executes the task of the group on the calling thread
+         * @tparam Fn - invocable type
+         * @param fn - executed task
+         * @note exception of the task is rethrown by wait, same as the exception of the queued task
+        */
+        template<std::invocable Fn>
+        void runHere(Fn&& fn) noexcept {
+            execute(fn);
+        }
+
+        /**
+         * @brief waits until every task of the group is finished, executing queued tasks in the meantime
+         * @throws first exception thrown by a task of the group
+        */
+        void wait();
+
+    private:
+        /// thread pool the tasks are executed on
+        ThreadPool& threadPool;
+
+        /// token that drops the tasks not yet started, null for none
+        const CancellationToken* cancellation;
+
+        /// mutex for the completion of the tasks and for the caught exception
+        std::mutex mtx;
+
+        /// notified when the last unfinished task of the group finishes
+        std::condition_variable done;
+
+        /// number of unfinished tasks, modified only under the mutex
+        std::atomic<size_t> pending{ 0 };
+
+        /// first exception thrown by a task of the group
+        std::exception_ptr error;
+
+        /**
+         * @brief executes the task, its exception is kept for the waiting thread
+         * @tparam Fn - invocable type
+         * @param fn - reference to the executed task
+        */
+        template<typename Fn>
+        void execute(Fn& fn) noexcept {
+            try{
+                fn();
+            }
+            catch(...){
+                std::lock_guard<std::mutex> lock(mtx);
+                if(!error){
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        /**
+         * @brief checks if the tasks not yet started are dropped
+         * @returns true if the cancellation token is set, false otherwise
+        */
+        bool isCancelled() const noexcept {
+            return cancellation && cancellation->isCancelled();
+        }
+
+        /**
+         * @brief marks one task of the group as finished
+         * @note group may be destroyed by the waiting thread as soon as the last task finishes
+        */
+        void finish() noexcept;
+
+        /**
+         * @brief waits until every task of the group is finished, executing queued tasks in the meantime
+        */
+        void join() noexcept;
+
+    };
+
+    /// number of chunks per thread chosen by parallelFor, so uneven chunks still keep every thread busy
+    inline constexpr size_t chunksPerThread{ 4 };
+
+    /// total estimated cost below which handing the work to other threads costs more than doing it
+    inline constexpr size_t serialCostThreshold{ 4096 };
+
+    /**
+     * @brief calls the function for every index of the range, chunks of the range run in parallel
+     * @tparam Fn - type invocable with the index
+     * @param threadPool - reference to a thread pool the chunks are executed on
+     * @param begin - first index of the range
+     * @param end - index past the last index of the range
+     * @param grain - number of indices per chunk, 0 for the grain chosen by the number of threads
+     * @param fn - function called for every index
+     * @param cancellation - const pointer to the token that stops the loop, nullptr for none
+     * @throws first exception thrown by the function, after every chunk finished
+     * @details first chunk runs on the calling thread, which then helps with the rest,
+     * indices of a chunk are visited in ascending order,
+     * pool without workers visits the whole range on the calling thread,
+     * indices not yet visited when the token stops them are skipped
+    */
+    template<typename Fn>
+    requires std::invocable<Fn&, size_t>
+    void parallelFor(
+        ThreadPool& threadPool, size_t begin, size_t end, size_t grain, Fn&& fn,
+        const CancellationToken* cancellation = nullptr
+    ){
+        if(begin >= end){
+            return;
+        }
+
+        const size_t count{ end - begin };
+        if(grain == 0){
+            // calling thread works on the chunks too
+            grain = std::max<size_t>(count / ((threadPool.size() + 1) * chunksPerThread), 1);
+        }
+
+        auto runChunk{
+            [&fn, cancellation, end, grain](size_t chunkBegin) -> void {
+                const size_t chunkEnd{ chunkBegin + std::min(grain, end - chunkBegin) };
+                for(size_t i{ chunkBegin }; i < chunkEnd; ++i){
+                    if(cancellation && cancellation->isCancelled(i)){
+                        return;
+                    }
+                    fn(i);
+                }
+            }
+        };
+
+        if(count <= grain || threadPool.size() == 0){
+            for(size_t chunkBegin{ begin }; chunkBegin < end; chunkBegin += std::min(grain, end - chunkBegin)){
+                runChunk(chunkBegin);
+            }
+            return;
+        }
+
+        TaskGroup group{ threadPool, cancellation };
+        for(size_t chunkBegin{ begin + grain }; chunkBegin < end; chunkBegin += std::min(grain, end - chunkBegin)){
+            group.run([&runChunk, chunkBegin] -> void { runChunk(chunkBegin); });
+        }
+        group.runHere([&runChunk, begin] -> void { runChunk(begin); });
+        group.wait();
+    }
+
+    /**
+     * @struct CostSchedule
+     * @brief indices of the range split into tasks, most expensive task first
+    */
+    struct CostSchedule {
+        /// indices grouped by task, indices of a task are in ascending order
+        std::vector<size_t> indices;
+
+        /// position past the last index of every task in the indices
+        std::vector<size_t> taskEnds;
+    };
+
+    /**
+     * @brief splits the indices into tasks by their estimated cost, longest processing time first
+     * @param costs - estimated cost of every index
+     * @param threadCount - number of threads executing the tasks
+     * @returns tasks ordered from the most expensive one
+     * @details index costing at least the share of a task gets a task of its own,
+     * cheaper indices are batched into shared tasks of roughly that share
+    */
+    CostSchedule scheduleByCost(std::span<const size_t> costs, size_t threadCount);
+
+    /**
+     * @brief calls the function for every index of the range, most expensive indices are started first
+     * @tparam Cost - type invocable with the index, returns the estimated cost of the index
+     * @tparam Fn - type invocable with the index
+     * @param threadPool - reference to a thread pool the tasks are executed on
+     * @param count - number of indices, range starts at 0
+     * @param cost - estimates the cost of the index
+     * @param fn - function called for every index
+     * @param cancellation - const pointer to the token that stops the loop, nullptr for none
+     * @throws first exception thrown by the function, after every task finished
+     * @details single expensive index queued last no longer becomes the tail every thread waits on,
+     * most expensive task runs on the calling thread, which then helps with the rest,
+     * range cheaper than the serial threshold is visited on the calling thread in ascending order,
+     * indices not yet visited when the token stops them are skipped
+    */
+    template<typename Cost, typename Fn>
+    requires std::invocable<Cost&, size_t> && std::invocable<Fn&, size_t>
+    void parallelForByCost(
+        ThreadPool& threadPool, size_t count, Cost&& cost, Fn&& fn,
+        const CancellationToken* cancellation = nullptr
+    ){
+        std::vector<size_t> costs(count);
+        size_t totalCost{ 0 };
+        for(size_t i{ 0 }; i < count; ++i){
+            costs[i] = cost(i);
+            totalCost += costs[i] + 1;
+        }
+
+        if(totalCost < serialCostThreshold || threadPool.size() == 0){
+            for(size_t i{ 0 }; i < count; ++i){
+                if(cancellation && cancellation->isCancelled(i)){
+                    return;
+                }
+                fn(i);
+            }
+            return;
+        }
+
+        // calling thread works on the tasks too
+        const CostSchedule schedule{ scheduleByCost(costs, threadPool.size() + 1) };
+        auto runTask{
+            [&fn, &schedule, cancellation](size_t task) -> void {
+                const size_t taskBegin{ task == 0 ? 0 : schedule.taskEnds[task - 1] };
+                for(size_t i{ taskBegin }; i < schedule.taskEnds[task]; ++i){
+                    if(cancellation && cancellation->isCancelled(schedule.indices[i])){
+                        return;
+                    }
+                    fn(schedule.indices[i]);
+                }
+            }
+        };
+
+        const size_t taskCount{ schedule.taskEnds.size() };
+        if(taskCount <= 1){
+            if(taskCount == 1){
+                runTask(0);
+            }
+            return;
+        }
+
+        TaskGroup group{ threadPool, cancellation };
+        for(size_t task{ 1 }; task < taskCount; ++task){
+            group.run([&runTask, task] -> void { runTask(task); });
+        }
+        group.runHere([&runTask] -> void { runTask(0); });
+        group.wait();
+    }
+
+}
+
+#endif
\ No newline at end of file
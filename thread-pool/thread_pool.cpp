@@ -1,39 +1,278 @@
 #include "thread_pool.hpp"
 
-util::concurrency::ThreadPool::ThreadPool(size_t n){
-    workers.reserve(n);
+#include <algorithm>
 
-    for(size_t i{0}; i < n; ++i){
-        workers.emplace_back([this]() -> void {
-            while(true){
-                std::move_only_function<void()> fn;
-                {
-                    std::unique_lock<std::mutex> lock(mtx);
-                    cv.wait(lock, [this] -> bool {
-                        return stopping || !tasks.empty();
-                    });
+#include <pthread.h>
+#include <sched.h>
+
+#include "../common/tracing/trace.hpp"
 
-                    if(stopping && tasks.empty()){
-                        return;
-                    }
+thread_local util::concurrency::ThreadPool* util::concurrency::ThreadPool::currentPool{ nullptr };
 
-                    fn = std::move(tasks.front());
-                    tasks.pop();
-                }
-                fn();
-            }
-        });
+thread_local util::concurrency::ThreadPool::Worker* util::concurrency::ThreadPool::currentWorker{ nullptr };
+
+util::concurrency::ThreadPool::ThreadPool(size_t n, bool pinThreads)
+    : pinThreads{ pinThreads } {
+    // every worker exists before any thread starts, thieves never see a partially built pool
+    workers.reserve(n);
+    for(size_t i{0}; i < n; ++i){
+        workers.push_back(std::make_unique<Worker>());
+        workers.back()->victimSeed = 0x9E3779B97F4A7C15ull * (i + 1);
     }
 }
 
 util::concurrency::ThreadPool::~ThreadPool() {
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        stopping = true;
+        // tasks injected before the flag is set are still executed
+        std::lock_guard<std::mutex> lock(injectionMtx);
+        stopping.store(true);
+    }
+    {
+        std::lock_guard<std::mutex> lock(parkMtx);
+    }
+    parkCv.notify_all();
+
+    // no thread starts after the flag is set, started workers execute the remaining tasks
+    size_t startedWorkers;
+    {
+        std::lock_guard<std::mutex> lock(startMtx);
+        startedWorkers = started.load();
+    }
+    for(size_t i{ 0 }; i < startedWorkers; ++i){
+        workers[i]->thread.join();
+    }
+}
+
+size_t util::concurrency::ThreadPool::size() const noexcept {
+    return workers.size();
+}
+
+void util::concurrency::ThreadPool::submit(std::unique_ptr<Task> task){
+    if(workers.empty()){
+        // pool without workers, task is executed by the thread that enqueued it
+        (*task)();
+        return;
+    }
+
+    if(currentPool == this){
+        // task spawned by a task stays on its worker, the other workers steal it if they are idle
+        currentWorker->tasks.push(task.get());
+        task.release();
+    }
+    else {
+        std::lock_guard<std::mutex> lock(injectionMtx);
+        if(stopping.load()){
+            throw std::runtime_error("Enqueue on stopped thread pool\n");
+        }
+        injected.push_back(task.get());
+        task.release();
+        injectedCount.fetch_add(1);
+    }
+
+    // busy workers are loaded first, every one of them is counted in the started workers loaded after
+    const size_t busyWorkers{ busy.load() };
+    const size_t startedWorkers{ started.load() };
+    const size_t demand{ currentPool == this ? 1 : injectedCount.load() };
+    if(startedWorkers < workers.size() && demand > startedWorkers - busyWorkers){
+        startWorker();
+    }
+
+    wakeOne();
+}
+
+bool util::concurrency::ThreadPool::runPendingTask(){
+    Task* found{ nullptr };
+    if(currentPool == this){
+        found = findTask(*currentWorker);
+    }
+    else {
+        // thread outside of the pool has no deque, it takes single tasks
+        static thread_local uint64_t victimSeed{ 0x9E3779B97F4A7C15ull };
+        found = injectedCount.load() > 0 ? takeInjected() : nullptr;
+        if(!found){
+            found = steal(victimSeed, nullptr);
+        }
+    }
+
+    if(!found){
+        return false;
+    }
+
+    std::unique_ptr<Task> task{ found };
+    (*task)();
+    return true;
+}
+
+void util::concurrency::ThreadPool::startWorker(){
+    std::lock_guard<std::mutex> lock(startMtx);
+    const size_t next{ started.load() };
+    if(next == workers.size() || stopping.load()){
+        return;
+    }
+
+    Worker& worker{ *workers[next] };
+    worker.thread = std::thread{
+        [this, &worker, next] -> void {
+            util::tracing::setThreadName("worker", next);
+            run(worker);
+        }
+    };
+
+    if(pinThreads){
+        // failure to pin only costs locality, worker still runs
+        const size_t cores{ std::max<size_t>(std::thread::hardware_concurrency(), 1) };
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(next % cores, &cpus);
+        pthread_setaffinity_np(worker.thread.native_handle(), sizeof(cpus), &cpus);
+    }
+
+    started.store(next + 1);
+}
+
+void util::concurrency::ThreadPool::run(Worker& worker){
+    currentPool = this;
+    currentWorker = &worker;
+
+    size_t idleRounds{ 0 };
+    while(true){
+        if(Task* found{ findTask(worker) }){
+            idleRounds = 0;
+            std::unique_ptr<Task> task{ found };
+            busy.fetch_add(1);
+            (*task)();
+            busy.fetch_sub(1);
+            continue;
+        }
+
+        if(stopping.load() && !hasQueuedTasks()){
+            return;
+        }
+
+        // new tasks usually follow shortly, spinning avoids the cost of parking and waking
+        if(++idleRounds < spinRounds){
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleRounds = 0;
+        park();
+    }
+}
+
+util::concurrency::ThreadPool::Task* util::concurrency::ThreadPool::findTask(Worker& worker){
+    if(Task* task{ worker.tasks.pop() }){
+        return task;
+    }
+    if(injectedCount.load() > 0){
+        if(Task* task{ takeInjected(worker) }){
+            return task;
+        }
+    }
+    return steal(worker.victimSeed, &worker);
+}
+
+util::concurrency::ThreadPool::Task* util::concurrency::ThreadPool::takeInjected(Worker& worker){
+    size_t taken{ 0 };
+    Task* task{ nullptr };
+    {
+        std::lock_guard<std::mutex> lock(injectionMtx);
+        if(injected.empty()){
+            return nullptr;
+        }
+
+        // rest of the batch moves to the deque, where the other workers take it without the lock,
+        // it is pushed newest first, so the worker still runs the injected tasks in their order,
+        // batch is limited to a fair share, so the tasks queued first are spread over the workers
+        taken = std::min(injectionBatch, (injected.size() + workers.size() - 1) / workers.size());
+        task = injected.front();
+        for(size_t i{ taken - 1 }; i > 0; --i){
+            worker.tasks.push(injected[i]);
+        }
+        injected.erase(injected.begin(), injected.begin() + static_cast<std::ptrdiff_t>(taken));
+        injectedCount.fetch_sub(taken);
+    }
+
+    if(taken > 1){
+        wakeOne();
+    }
+    return task;
+}
+
+util::concurrency::ThreadPool::Task* util::concurrency::ThreadPool::takeInjected(){
+    Task* task{ nullptr };
+    {
+        std::lock_guard<std::mutex> lock(injectionMtx);
+        if(injected.empty()){
+            return nullptr;
+        }
+        task = injected.front();
+        injected.pop_front();
+        injectedCount.fetch_sub(1);
+    }
+    return task;
+}
+
+util::concurrency::ThreadPool::Task* util::concurrency::ThreadPool::steal(uint64_t& seed, const Worker* thief){
+    const size_t count{ workers.size() };
+    if(count == 0 || (count == 1 && thief)){
+        return nullptr;
     }
-    cv.notify_all();
 
-    for(auto& w : workers){
-        w.join();
+    // xorshift, every worker starts from a different victim so the thieves spread out
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    const size_t first{ static_cast<size_t>(seed % count) };
+
+    for(size_t i{ 0 }; i < count; ++i){
+        Worker& victim{ *workers[(first + i) % count] };
+        if(&victim == thief){
+            continue;
+        }
+        if(Task* task{ victim.tasks.steal() }){
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+bool util::concurrency::ThreadPool::hasQueuedTasks() const noexcept {
+    if(injectedCount.load() > 0){
+        return true;
+    }
+    for(const auto& worker : workers){
+        if(!worker->tasks.empty()){
+            return true;
+        }
     }
+    return false;
 }
+
+void util::concurrency::ThreadPool::park(){
+    std::unique_lock<std::mutex> lock(parkMtx);
+
+    // announced before the last look, a task queued after the look sees the sleeper and wakes it
+    sleepers.fetch_add(1);
+    if(!hasQueuedTasks() && !stopping.load()){
+        parkCv.wait(lock, [this] -> bool { return wakeups > 0 || stopping.load(); });
+        if(wakeups > 0){
+            --wakeups;
+        }
+    }
+    sleepers.fetch_sub(1);
+}
+
+void util::concurrency::ThreadPool::wakeOne(){
+    if(sleepers.load() == 0){
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(parkMtx);
+        if(wakeups < sleepers.load()){
+            ++wakeups;
+        }
+    }
+    parkCv.notify_one();
+}
\ No newline at end of file
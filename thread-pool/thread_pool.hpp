@@ -1,14 +1,20 @@
 #ifndef THREAD_POOL_HPP
 #define THREAD_POOL_HPP
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <thread>
 #include <vector>
-#include <queue>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <concepts>
+#include <stdexcept>
+
+#include "work_stealing_deque.hpp"
 
 /**
  * @namespace util::concurrency
@@ -18,17 +24,24 @@ namespace util::concurrency {
     /** 
      * @class ThreadPool
      * @brief manages a fixed number of worker threads that execute queued tasks
+     * @details every worker owns a deque, tasks enqueued by a task go to the deque of its worker
+     * and are popped newest first, idle workers steal the oldest tasks of a random worker,
+     * tasks enqueued from outside of the pool go through a shared injection queue,
+     * worker without work spins for a while before it parks,
+     * threads are started lazily, only when queued tasks outnumber the idle workers,
+     * pool without workers executes every task on the thread that enqueues it
     */
     class ThreadPool{
     public:
         /** 
-         * @brief starts specified number of worker threads
-         * @param n - number of worker threads that handle tasks
+         * @brief creates the pool of the specified number of worker threads, threads start when tasks need them
+         * @param n - maximal number of worker threads that handle tasks, 0 for executing tasks on the enqueuing thread
+         * @param pinThreads - flag if every worker thread should be pinned to its own core
         */
-        explicit ThreadPool(size_t n);
+        explicit ThreadPool(size_t n, bool pinThreads = false);
 
         /** 
-        * @brief stopping all worker threads
+        * @brief stopping all worker threads, tasks that are already queued are executed first
         */
         ~ThreadPool();
 
@@ -44,40 +57,164 @@ namespace util::concurrency {
         /// deleted move assignment operator
         ThreadPool& operator=(ThreadPool&&) noexcept = delete;
 
+        /**
+         * @brief getter for the number of worker threads
+         * @returns maximal number of worker threads, started or not
+        */
+        size_t size() const noexcept;
+
         /** 
          * @brief adding new task to the queue
          * @tparam Fn - invocable type
          * @param fn - task that is being added to queue
          * @throws std::runtime_error - when called after all worker threads stopped working
+         * @note thread-safe, may be called from inside of a task
         */
         template<std::invocable Fn>
         void enqueue(Fn&& fn){
-            {
-                std::lock_guard<std::mutex> lock(mtx);
-                if(stopping){
-                    throw std::runtime_error("Enqueue on stopped thread pool\n");
-                }
-                tasks.emplace(std::forward<Fn>(fn));
-            }
-
-            cv.notify_one();
+            submit(std::make_unique<Task>(std::forward<Fn>(fn)));
         }
 
+        /**
+         * @brief executes one queued task on the calling thread
+         * @returns true if a task was executed, false if no task was found
+         * @details lets a thread waiting for tasks help with them instead of blocking,
+         * worker takes its own tasks first, other threads take the injected ones first
+         * @note thread-safe
+        */
+        bool runPendingTask();
+
     private:
-        /// mutex for concurrent access to tasks
-        std::mutex mtx;
+        /// type of the queued task
+        using Task = std::move_only_function<void()>;
+
+        /**
+         * @struct Worker
+         * @brief worker thread with its own deque of tasks
+        */
+        struct Worker {
+            /// tasks enqueued by the tasks of this worker
+            WorkStealingDeque<Task*> tasks;
+
+            /// state of the random victim selection
+            uint64_t victimSeed;
+
+            /// thread of the worker
+            std::thread thread;
+        };
+
+        /// number of rounds an idle worker looks for work before it parks
+        static constexpr size_t spinRounds{ 64 };
+
+        /// maximal number of tasks moved from the injection queue to the deque of the worker at once
+        static constexpr size_t injectionBatch{ 32 };
+
+        /// workers of the pool, never relocated
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        /// mutex for the injection queue
+        std::mutex injectionMtx;
+
+        /// tasks enqueued from outside of the pool
+        std::deque<Task*> injected;
+
+        /// number of tasks in the injection queue
+        std::atomic<size_t> injectedCount{ 0 };
+
+        /// mutex for parking the idle workers
+        std::mutex parkMtx;
+
+        /// condition variable the idle workers park on
+        std::condition_variable parkCv;
+
+        /// number of workers that are parked or about to park
+        std::atomic<size_t> sleepers{ 0 };
+
+        /// number of wakeups not yet consumed by the parked workers, guarded by parkMtx
+        size_t wakeups{ 0 };
 
-        /// condition variable for waiting/notifying
-        std::condition_variable cv;
-        
         /// flag that handles stoppage of worker threads
-        bool stopping{false};
+        std::atomic<bool> stopping{ false };
+
+        /// flag if the worker threads are pinned to cores
+        const bool pinThreads;
+
+        /// mutex for starting the worker threads
+        std::mutex startMtx;
+
+        /// number of started worker threads, workers are started in order
+        std::atomic<size_t> started{ 0 };
 
-        /// queue of tasks
-        std::queue<std::move_only_function<void()>> tasks;
+        /// number of workers executing a task
+        std::atomic<size_t> busy{ 0 };
 
-        /// worker threads
-        std::vector<std::thread> workers;
+        /// pool the current thread works for, null outside of the workers
+        static thread_local ThreadPool* currentPool;
+
+        /// worker the current thread runs as
+        static thread_local Worker* currentWorker;
+
+        /**
+         * @brief queues the task and wakes an idle worker
+         * @param task - queued task
+         * @throws std::runtime_error - when called after all worker threads stopped working
+        */
+        void submit(std::unique_ptr<Task> task);
+
+        /**
+         * @brief starts the thread of the next worker, unless every worker is started or the pool stops
+        */
+        void startWorker();
+
+        /**
+         * @brief executes the tasks until the pool stops
+         * @param worker - reference to the worker running on the calling thread
+        */
+        void run(Worker& worker);
+
+        /**
+         * @brief finds the next task of the worker, own tasks first, then injected ones, then stolen ones
+         * @param worker - reference to the worker looking for a task
+         * @returns task, nullptr if none was found
+        */
+        Task* findTask(Worker& worker);
+
+        /**
+         * @brief moves the batch of the injected tasks to the deque of the worker
+         * @param worker - reference to the worker taking the tasks
+         * @returns one of the taken tasks, nullptr if the injection queue is empty
+        */
+        Task* takeInjected(Worker& worker);
+
+        /**
+         * @brief takes the oldest injected task
+         * @returns task, nullptr if the injection queue is empty
+        */
+        Task* takeInjected();
+
+        /**
+         * @brief steals the task of a random worker
+         * @param seed - reference to the state of the random victim selection
+         * @param thief - const pointer to the stealing worker, null when the thief is not a worker of the pool
+         * @returns stolen task, nullptr if every other worker looked empty
+        */
+        Task* steal(uint64_t& seed, const Worker* thief);
+
+        /**
+         * @brief checks if any task is queued anywhere in the pool
+         * @returns true if a task is queued, false otherwise
+        */
+        bool hasQueuedTasks() const noexcept;
+
+        /**
+         * @brief parks the worker until a task is queued or the pool stops
+        */
+        void park();
+
+        /**
+         * @brief wakes one parked worker, if any
+        */
+        void wakeOne();
 
     };
 
@@ -0,0 +1,186 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace util::concurrency {
+    /**
+     * @class WorkStealingDeque
+     * @brief Chase-Lev deque, the owner pushes and pops at the bottom, other threads steal from the top
+     * @tparam T - pointer type of the elements, nullptr is returned when there is no element
+     * @details buffer grows when it is full, replaced buffers are kept until the deque is destroyed,
+     * so a thief still reading from an old buffer never touches freed memory
+    */
+    template<typename T>
+    requires std::is_pointer_v<T>
+    class WorkStealingDeque {
+    public:
+        /**
+         * @brief Creates the instance of the empty deque
+         * @param capacity - initial capacity, rounded up to a power of two
+        */
+        explicit WorkStealingDeque(size_t capacity = 256){
+            size_t rounded{ 1 };
+            while(rounded < capacity){
+                rounded <<= 1;
+            }
+            buffers.push_back(std::make_unique<Buffer>(rounded));
+            buffer.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        /// deleted copy constructor
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+        /// deleted assignment operator
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * @brief pushes the element to the bottom
+         * @param element - pushed element
+         * @note only the owner may push
+        */
+        void push(T element){
+            const int64_t b{ bottom.load(std::memory_order_relaxed) };
+            const int64_t t{ top.load(std::memory_order_acquire) };
+            Buffer* current{ buffer.load(std::memory_order_relaxed) };
+            if(b - t > static_cast<int64_t>(current->capacity) - 1){
+                current = grow(current, t, b);
+            }
+            current->put(b, element);
+
+            // publishes the element, thieves load the bottom before reading it
+            bottom.store(b + 1, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief pops the most recently pushed element
+         * @returns popped element, nullptr if the deque is empty or the last element was stolen
+         * @note only the owner may pop
+        */
+        T pop() noexcept {
+            const int64_t b{ bottom.load(std::memory_order_relaxed) - 1 };
+            Buffer* current{ buffer.load(std::memory_order_relaxed) };
+            bottom.store(b, std::memory_order_seq_cst);
+            int64_t t{ top.load(std::memory_order_seq_cst) };
+
+            if(t > b){
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T element{ current->get(b) };
+            if(t == b){
+                // last element, the owner races the thieves for it
+                if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)){
+                    element = nullptr;
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return element;
+        }
+
+        /**
+         * @brief steals the least recently pushed element
+         * @returns stolen element, nullptr if the deque is empty or another thread took the element first
+         * @note thread-safe
+        */
+        T steal() noexcept {
+            int64_t t{ top.load(std::memory_order_seq_cst) };
+            const int64_t b{ bottom.load(std::memory_order_seq_cst) };
+            if(t >= b){
+                return nullptr;
+            }
+
+            T element{ buffer.load(std::memory_order_acquire)->get(t) };
+            if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)){
+                return nullptr;
+            }
+            return element;
+        }
+
+        /**
+         * @brief checks if the deque has no elements
+         * @returns true if the deque looked empty at the time of the call, false otherwise
+         * @note thread-safe
+        */
+        bool empty() const noexcept {
+            return top.load(std::memory_order_seq_cst) >= bottom.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        /**
+         * @struct Buffer
+         * @brief circular buffer of the elements
+        */
+        struct Buffer {
+            /// number of the slots, power of two
+            const size_t capacity;
+
+            /// slots of the elements
+            std::unique_ptr<std::atomic<T>[]> slots;
+
+            /**
+             * @brief Creates the buffer of the given capacity
+             * @param capacity - number of the slots
+            */
+            explicit Buffer(size_t capacity)
+                : capacity{ capacity }, slots{ std::make_unique<std::atomic<T>[]>(capacity) } {}
+
+            /**
+             * @brief stores the element at the position
+             * @param position - position in the deque
+             * @param element - stored element
+            */
+            void put(int64_t position, T element) noexcept {
+                slots[static_cast<size_t>(position) & (capacity - 1)].store(element, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief loads the element at the position
+             * @param position - position in the deque
+             * @returns element at the position
+            */
+            T get(int64_t position) const noexcept {
+                return slots[static_cast<size_t>(position) & (capacity - 1)].load(std::memory_order_relaxed);
+            }
+        };
+
+        /// position of the next element to steal
+        alignas(64) std::atomic<int64_t> top{ 0 };
+
+        /// position of the next pushed element
+        alignas(64) std::atomic<int64_t> bottom{ 0 };
+
+        /// buffer in use
+        std::atomic<Buffer*> buffer;
+
+        /// every buffer the deque used, only the owner appends to it
+        std::vector<std::unique_ptr<Buffer>> buffers;
+
+        /**
+         * @brief replaces the full buffer with one of double the capacity
+         * @param current - pointer to the full buffer
+         * @param t - position of the top element
+         * @param b - position past the bottom element
+         * @returns pointer to the new buffer
+        */
+        Buffer* grow(Buffer* current, int64_t t, int64_t b){
+            buffers.push_back(std::make_unique<Buffer>(current->capacity * 2));
+            Buffer* grown{ buffers.back().get() };
+            for(int64_t i{ t }; i < b; ++i){
+                grown->put(i, current->get(i));
+            }
+            buffer.store(grown, std::memory_order_release);
+            return grown;
+        }
+
+    };
+
+}
+
+#endif
\ No newline at end of file
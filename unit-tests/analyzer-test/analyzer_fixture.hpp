@@ -9,12 +9,13 @@ protected:
     util::concurrency::ThreadPool tp{1};
     semantic::SymbolTable symtab;
     semantic::ScopeManager scopeManager{symtab};
+    semantic::FunctionTable functionTable;
     std::unique_ptr<AnalyzerTest> analyzer;
 
     void initAnalyzer() {
         initParser();
-        analyzer = std::make_unique<AnalyzerTest>(scopeManager, tp);
-        program->accept(*analyzer);
+        analyzer = std::make_unique<AnalyzerTest>(functionTable, tp);
+        analyzer->visitNode(program);
     }
 };
 
@@ -23,12 +24,13 @@ protected:
     util::concurrency::ThreadPool tp{1};
     semantic::SymbolTable symtab;
     semantic::ScopeManager scopeManager{symtab};
+    semantic::FunctionTable functionTable;
     std::unique_ptr<AnalyzerTest> analyzer;
 
     void initAnalyzer() {
         initParser();
-        analyzer = std::make_unique<AnalyzerTest>(scopeManager, tp);
-        function->accept(*analyzer);
+        analyzer = std::make_unique<AnalyzerTest>(functionTable, tp);
+        analyzer->visitNode(function);
     }
 
     void SetUp() override {
@@ -46,13 +48,14 @@ protected:
     util::concurrency::ThreadPool tp{1};
     semantic::SymbolTable symtab;
     semantic::ScopeManager scopeManager{symtab};
+    semantic::FunctionTable functionTable;
     std::unique_ptr<AnalyzerTest> analyzer;
 
     void initAnalyzer(){
         initParser();
-        analyzer = std::make_unique<AnalyzerTest>(scopeManager, tp);
-        analyzer->getContext().init("tmp", &scopeManager);
-        stmt->accept(*analyzer);
+        analyzer = std::make_unique<AnalyzerTest>(functionTable, tp);
+        analyzer->getContext().init(util::text::StringInterner::intern("tmp"), &scopeManager);
+        analyzer->visitNode(stmt);
     }
 
     void SetUp() override {
@@ -72,13 +75,14 @@ protected:
     util::concurrency::ThreadPool tp{1};
     semantic::SymbolTable symtab;
     semantic::ScopeManager scopeManager{symtab};
+    semantic::FunctionTable functionTable;
     std::unique_ptr<AnalyzerTest> analyzer;
 
     void initAnalyzer(){
         initParser();
-        analyzer = std::make_unique<AnalyzerTest>(scopeManager, tp);
-        analyzer->getContext().init("tmp", &scopeManager);
-        expr->accept(*analyzer);
+        analyzer = std::make_unique<AnalyzerTest>(functionTable, tp);
+        analyzer->getContext().init(util::text::StringInterner::intern("tmp"), &scopeManager);
+        analyzer->visitNode(expr);
     }
 
     void SetUp() override {
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <format>
+#include <latch>
+#include <string>
+#include <vector>
 
 #include "analyzer_fixture.hpp"
+#include "../../common/symbol/string_interner.hpp"
 
 TEST_F(AnalyzerFixture, SemanticCheck){
     input = {"int fun(){ return 1; } int main(){ return fun();}"};
@@ -47,6 +53,30 @@ TEST_F(AnalyzerFixture, CheckFunctionSignaturesFunctionRedefError){
     EXPECT_TRUE(analyzer->getErrors(analyzer->getGlobalErrLabel())[0].contains("redefined"));
 }
 
+TEST_F(AnalyzerFixture, CheckFunctionSignaturesManyFunctionsRedefError){
+    // enough functions for the signatures to be registered in several batches
+    std::string source;
+    for(size_t i{ 0 }; i < 600; ++i){
+        source += std::format("int f{}(int a, unsigned b){{ return a; }} ", i);
+    }
+    source += "int f5(){ return 1; } int f300(){ return 1; } int main(){ return f7(1, 2u); }";
+    input = {source};
+    initAnalyzer();
+
+    const auto& globalErrors{ analyzer->getErrors(analyzer->getGlobalErrLabel()) };
+    ASSERT_EQ(globalErrors.size(), 2u);
+    EXPECT_TRUE(globalErrors[0].contains("f5"));
+    EXPECT_TRUE(globalErrors[1].contains("f300"));
+
+    const auto* function{ functionTable.lookup(util::text::StringInterner::intern("f5")) };
+    ASSERT_TRUE(function);
+    const auto parameterTypes{ functionTable.getParameterTypes(*function) };
+    ASSERT_EQ(parameterTypes.size(), 2u);
+    EXPECT_EQ(parameterTypes[0], types::Type::INT);
+    EXPECT_EQ(parameterTypes[1], types::Type::UNSIGNED);
+    EXPECT_TRUE(analyzer->getErrors("main").empty());
+}
+
 TEST_F(AnalyzerFixture, CheckFunctionSignaturesParameterRedefError){
     input = {"int rectArea(int x, int x){ return x * x; } int main(){ return x * x; }"};
     initAnalyzer();
@@ -65,7 +95,7 @@ TEST_F(AnalyzerFixture, CheckFunctionSignaturesMainParamsError){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunction){
     input = {"int fun(){ return 1; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::INT);
     initAnalyzer();
 
     EXPECT_TRUE(analyzer->getErrors("fun").empty());
@@ -73,7 +103,7 @@ TEST_F(FunctionAnalyzerFixture, CheckFunction){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunctionNotAllIfPathsReturnError){
     input = {"int fun(int x){ if(x > 0) return 1; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::INT);
     initAnalyzer();
 
     EXPECT_FALSE(analyzer->getErrors("fun").empty());
@@ -82,7 +112,7 @@ TEST_F(FunctionAnalyzerFixture, CheckFunctionNotAllIfPathsReturnError){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunctionNotAllSwitchPathsReturnError){
     input = {"int fun(int x){ switch(x){ case 0: return 0; case 1: return 1; } }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::INT);
     initAnalyzer();
 
     EXPECT_FALSE(analyzer->getErrors("fun").empty());
@@ -91,7 +121,7 @@ TEST_F(FunctionAnalyzerFixture, CheckFunctionNotAllSwitchPathsReturnError){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunctionParameterRedefError){
     input = {"int fun(int x){ int x = 1; return 0; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::INT);
     initAnalyzer();
 
     EXPECT_FALSE(analyzer->getErrors("fun").empty());
@@ -100,7 +130,7 @@ TEST_F(FunctionAnalyzerFixture, CheckFunctionParameterRedefError){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunctionVoidReturnsTypeError){
     input = {"void fun(){ return 1; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::VOID});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::VOID);
     initAnalyzer();
 
     EXPECT_FALSE(analyzer->getErrors("fun").empty());
@@ -109,7 +139,7 @@ TEST_F(FunctionAnalyzerFixture, CheckFunctionVoidReturnsTypeError){
 
 TEST_F(FunctionAnalyzerFixture, CheckFunctionVoidTypeMismatchError){
     input = {"int fun(){ return 1u; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"fun", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("fun"), types::Type::INT);
     initAnalyzer();
 
     EXPECT_FALSE(analyzer->getErrors("fun").empty());
@@ -121,7 +151,7 @@ TEST_F(StatementAnalyzerFixture, CheckVariable){
     initAnalyzer();
     
     ASSERT_TRUE(analyzer->getContext().semanticErrors.empty());
-    EXPECT_TRUE(scopeManager.lookupSymbol("x", {semantic::Kind::VAR}));
+    EXPECT_TRUE(scopeManager.lookupSymbol(util::text::StringInterner::intern("x"), {semantic::Kind::VAR}));
 }
 
 TEST_F(StatementAnalyzerFixture, CheckVariableExitedScope){
@@ -131,6 +161,43 @@ TEST_F(StatementAnalyzerFixture, CheckVariableExitedScope){
     ASSERT_TRUE(analyzer->getContext().semanticErrors.empty());
 }
 
+TEST_F(AnalyzerFixture, MaxErrorsStopsAtNextStatement){
+    input = {"int main(){ int a = b; { int c = d; } int e = f; return 0; }"};
+    initParser();
+
+    util::concurrency::CancellationToken cancellation{ 2 };
+    analyzer = std::make_unique<AnalyzerTest>(functionTable, tp, &cancellation);
+    analyzer->visitNode(program);
+
+    EXPECT_TRUE(cancellation.isCancelled());
+    EXPECT_EQ(analyzer->getErrors("main").size(), 2);
+}
+
+TEST_F(AnalyzerFixture, ScopeExitRemovesInnerSymbols){
+    auto id{ [](size_t i) -> util::text::SymbolId { return util::text::StringInterner::intern(std::format("s{}", i)); } };
+
+    // enough symbols for the table to grow while both scopes are open
+    scopeManager.pushScope();
+    for(size_t i{ 0 }; i < 40; ++i){
+        ASSERT_TRUE(scopeManager.pushSymbol(semantic::Symbol{id(i), semantic::Kind::VAR, types::Type::INT}));
+    }
+    scopeManager.pushScope();
+    for(size_t i{ 40 }; i < 100; ++i){
+        ASSERT_TRUE(scopeManager.pushSymbol(semantic::Symbol{id(i), semantic::Kind::VAR, types::Type::INT}));
+    }
+    EXPECT_FALSE(scopeManager.pushSymbol(semantic::Symbol{id(3), semantic::Kind::VAR, types::Type::INT}));
+    scopeManager.popScope();
+
+    for(size_t i{ 0 }; i < 100; ++i){
+        EXPECT_EQ(scopeManager.lookupSymbol(id(i), {semantic::Kind::VAR}) != nullptr, i < 40);
+    }
+    EXPECT_TRUE(scopeManager.pushSymbol(semantic::Symbol{id(70), semantic::Kind::VAR, types::Type::INT}));
+    scopeManager.popScope();
+
+    EXPECT_FALSE(scopeManager.lookupSymbol(id(0), {semantic::Kind::VAR}));
+    EXPECT_EQ(scopeManager.getSymbolTable().size(), 0u);
+}
+
 TEST_F(StatementAnalyzerFixture, CheckVariableRedefError){
     input = {"int x = 5;"};
     scopeManager.pushSymbol(semantic::Symbol{"x", semantic::Kind::VAR, types::Type::INT});
@@ -153,8 +220,8 @@ TEST_F(StatementAnalyzerFixture, CheckVariableAutoType){
     initAnalyzer();
 
     ASSERT_TRUE(analyzer->getContext().semanticErrors.empty());
-    EXPECT_TRUE(analyzer->getContext().scopeManager->lookupSymbol("x", {semantic::Kind::VAR}));
-    EXPECT_EQ(analyzer->getContext().scopeManager->getSymbol("x").getType(), types::Type::UNSIGNED);
+    EXPECT_TRUE(analyzer->getContext().scopeManager->lookupSymbol(util::text::StringInterner::intern("x"), {semantic::Kind::VAR}));
+    EXPECT_EQ(analyzer->getContext().scopeManager->getSymbol(util::text::StringInterner::intern("x")).getType(), types::Type::UNSIGNED);
 }
 
 TEST_F(StatementAnalyzerFixture, CheckVariableAutoError){
@@ -223,3 +290,35 @@ TEST_F(StatementAnalyzerFixture, SwitchStatementCaseDuplicateError){
     ASSERT_FALSE(analyzer->getContext().semanticErrors.empty());
     EXPECT_TRUE(analyzer->getContext().semanticErrors[0].contains("duplicate case"));
 }
+
+TEST_F(AnalyzerFixture, InternsNamesConcurrently){
+    constexpr size_t threads{ 4 };
+    constexpr size_t names{ 4999 }; // prime, so every order below is a permutation
+
+    util::concurrency::ThreadPool threadPool{ threads };
+    std::array<std::vector<util::text::SymbolId>, threads> ids;
+    std::latch doneLatch{ threads };
+
+    // every thread interns the same names in a different order, so the threads race on the insertions
+    for(size_t t = 0; t < threads; ++t){
+        threadPool.enqueue([t, &ids, &doneLatch] -> void {
+            ids[t].resize(names);
+            for(size_t i = 0; i < names; ++i){
+                const size_t n{ (i * (2 * t + 1) + t * 977) % names };
+                ids[t][n] = util::text::StringInterner::intern("interned_name_" + std::to_string(n));
+            }
+            doneLatch.count_down();
+        });
+    }
+    doneLatch.wait();
+
+    for(size_t n = 0; n < names; ++n){
+        for(size_t t = 1; t < threads; ++t){
+            ASSERT_EQ(ids[t][n], ids[0][n]);
+        }
+        ASSERT_EQ(util::text::StringInterner::name(ids[0][n]), "interned_name_" + std::to_string(n));
+    }
+
+    EXPECT_EQ(util::text::StringInterner::intern(""), util::text::StringInterner::emptyId);
+    EXPECT_EQ(util::text::StringInterner::name(util::text::StringInterner::emptyId), "");
+}
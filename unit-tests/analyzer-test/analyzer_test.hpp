@@ -1,7 +1,9 @@
 #ifndef ANALYZER_TEST_HPP
 #define ANALYZER_TEST_HPP
 
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cassert>
 
@@ -9,20 +11,31 @@
 
 class AnalyzerTest : public semantic::Analyzer {
     public:
-        AnalyzerTest(semantic::ScopeManager& scopeManager, util::concurrency::ThreadPool& threadPool) 
-            : semantic::Analyzer{ scopeManager, threadPool }{}
-
-        semantic::ScopeManager& getScopeManager() noexcept {
-            return globalScopeManager;
+        AnalyzerTest(
+            semantic::FunctionTable& functionTable, util::concurrency::ThreadPool& threadPool,
+            util::concurrency::CancellationToken* cancellation = nullptr
+        ) 
+            : semantic::Analyzer{ functionTable, threadPool, cancellation }{}
+
+        semantic::FunctionTable& getFunctionTable() noexcept {
+            return functionTable;
         }
 
-        const char* getGlobalErrLabel() const noexcept {
+        util::text::SymbolId getGlobalErrLabel() const noexcept {
             return globalError;
         }
 
-        const std::vector<std::string>& getErrors(const std::string& func) const noexcept {
-            assert(semanticErrors.find(func) != semanticErrors.end());
-            return semanticErrors.at(func);
+        const std::vector<std::string>& getErrors(util::text::SymbolId func) const noexcept {
+            if(func == globalError){
+                return globalErrors;
+            }
+            const auto slot{ std::ranges::find(semanticErrors, func, &FunctionErrors::functionId) };
+            assert(slot != semanticErrors.end());
+            return slot->errors;
+        }
+
+        const std::vector<std::string>& getErrors(std::string_view func) const noexcept {
+            return getErrors(util::text::StringInterner::intern(func));
         }
 
         semantic::AnalyzerThreadContext& getContext() noexcept {
@@ -2,7 +2,9 @@
 #define COMPILER_FIXTURE_HPP
 
 #include <gtest/gtest.h>
+#include <filesystem>
 #include <string>
+#include <vector>
 
 #include "../../compiler/compiler.hpp"
 #include "../test-utils/test_utils.hpp"
@@ -12,11 +14,20 @@ protected:
     const std::string input{ "tmp.mcpp" };
     const std::string output{ "tmp" };
     compiler::ExitCode returnCode;
+    bool streamTokens{ false };
+    bool emitInterface{ false };
+    size_t jobs{ 0 };
+    size_t maxErrors{ 0 };
+    std::vector<std::filesystem::path> createdDirs;
 
     void initCompiler(std::string_view source){
         __test__writeSourceToFile(source, input);
         returnCode =  compiler::compile({
             .stopAfterAssembly = true, 
+            .streamTokens = streamTokens,
+            .emitInterface = emitInterface,
+            .jobs = jobs,
+            .maxErrors = maxErrors,
             .input = input, 
             .output = output
         });
@@ -25,6 +36,28 @@ protected:
     void TearDown() override {
         __test__removeFile(input);
         __test__removeFile(output + ".s");
+        __test__removeFile(output + ".mcppi");
+        for(const auto& dir : createdDirs){
+            std::filesystem::remove_all(dir);
+        }
+    }
+
+};
+
+class CompilerOptionsTest : public ::testing::Test {
+protected:
+    /**
+     * @brief parses the command line arguments
+     * @param args - arguments following the program name
+     * @returns parsed options
+    */
+    static compiler::CompileOptions parse(std::vector<std::string> args){
+        args.insert(args.begin(), "minicpp");
+        std::vector<char*> argv;
+        for(auto& arg : args){
+            argv.push_back(arg.data());
+        }
+        return compiler::parseOptions(static_cast<int>(argv.size()), argv.data());
     }
 
 };
@@ -1,4 +1,13 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "compiler_fixture.hpp"
 
@@ -26,6 +35,41 @@ TEST_F(CompilerFixture, SyntaxErr){
     ASSERT_EQ(returnCode, compiler::ExitCode::SYNTAX_ERR);
 }
 
+TEST_F(CompilerFixture, SerialNoErr){
+    jobs = 1;
+    initCompiler("int fun(int a){ return a * 2; } int main(){ int b = fun(4); return b; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+}
+
+TEST_F(CompilerFixture, ParallelNoErr){
+    jobs = 4;
+    initCompiler("int fun(int a){ return a * 2; } int main(){ int b = fun(4); return b; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+}
+
+TEST_F(CompilerFixture, StreamedNoErr){
+    streamTokens = true;
+    initCompiler("int fun(int a){ return a * 2; } int main(){ int b = fun(4); return b; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+}
+
+TEST_F(CompilerFixture, StreamedLexicalErr){
+    streamTokens = true;
+    initCompiler("int mai$n(){ return 0; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::LEXICAL_ERR);
+}
+
+TEST_F(CompilerFixture, StreamedSyntaxErr){
+    streamTokens = true;
+    initCompiler("main(){ return 0; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::SYNTAX_ERR);
+}
+
 TEST_F(CompilerFixture, SemanticErrTypeMismatch){
     initCompiler("int main(){ return 5 + 3u; }");
 
@@ -48,4 +92,271 @@ TEST_F(CompilerFixture, IRErr){
     initCompiler("int main(){ return 3/0; }");
 
     ASSERT_EQ(returnCode, compiler::ExitCode::IR_ERR);
+}
+
+TEST_F(CompilerFixture, IRErrWritesNoCode){
+    initCompiler("int fun(){ return 3/0; } int main(){ return fun(); }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::IR_ERR);
+    EXPECT_FALSE(std::filesystem::exists(output + ".s"));
+}
+
+TEST_F(CompilerFixture, SemanticErrReportedBeforeIRErr){
+    // functions go through the phases independently, errors are still reported in phase order
+    initCompiler("int fun(){ return 3/0; } int main(){ return a; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::SEMANTIC_ERR);
+}
+
+TEST_F(CompilerFixture, MaxErrorsSemanticErr){
+    maxErrors = 1;
+    testing::internal::CaptureStderr();
+    initCompiler("int one(){ return a; } int two(){ return b; } int main(){ return c; }");
+    const std::string errors{ testing::internal::GetCapturedStderr() };
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::SEMANTIC_ERR);
+
+    std::stringstream lines{ errors };
+    size_t errorLines{ 0 };
+    for(std::string line; std::getline(lines, line);){
+        errorLines += line.contains("SEMANTIC ERROR");
+    }
+    EXPECT_EQ(errorLines, 1);
+    EXPECT_TRUE(errors.contains("undefined variable 'a'"));
+    EXPECT_TRUE(errors.contains("compilation terminated due to -fmax-errors=1."));
+}
+
+TEST_F(CompilerFixture, MaxErrorsSameForEveryJobCount){
+    // first function is the cheapest and is checked last, the expensive ones fail before it
+    std::string source{ "int f0(){ return missing0; } " };
+    for(size_t i{ 1 }; i < 64; ++i){
+        source += std::format("int f{}(){{ int a = missing{};", i, i);
+        for(size_t j{ 0 }; j < 64; ++j){
+            source += " a = a + 1;";
+        }
+        source += " return a; } ";
+    }
+    source += "int main(){ return 0; }";
+    maxErrors = 1;
+
+    std::vector<std::string> outputs;
+    for(const size_t jobCount : { 1, 4 }){
+        jobs = jobCount;
+        testing::internal::CaptureStderr();
+        initCompiler(source);
+        outputs.push_back(testing::internal::GetCapturedStderr());
+        ASSERT_EQ(returnCode, compiler::ExitCode::SEMANTIC_ERR);
+    }
+
+    EXPECT_TRUE(outputs[0].contains("missing0"));
+    EXPECT_EQ(outputs[0], outputs[1]);
+}
+
+TEST_F(CompilerFixture, IrErrorsOfEveryFunction){
+    jobs = 4;
+    testing::internal::CaptureStderr();
+    initCompiler("int f(){ return 1 / 0; }\nint g(){ return 2 / 0; }\nint main(){ return 0; }");
+    const std::string errors{ testing::internal::GetCapturedStderr() };
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::IR_ERR);
+    EXPECT_TRUE(errors.contains("Line 1,"));
+    EXPECT_TRUE(errors.contains("Line 2,"));
+}
+
+TEST_F(CompilerFixture, MaxErrorsSameForEveryJobCountInIr){
+    // first function is the cheapest and is lowered last, the expensive ones fail before it
+    std::string source{ "int f0(){ return 1 / 0; }\n" };
+    for(size_t i{ 1 }; i < 64; ++i){
+        source += std::format("int f{}(){{ int a = {} / 0;", i, i);
+        for(size_t j{ 0 }; j < 64; ++j){
+            source += " a = a + 1;";
+        }
+        source += " return a; }\n";
+    }
+    source += "int main(){ return 0; }";
+    maxErrors = 1;
+
+    std::vector<std::string> outputs;
+    for(const size_t jobCount : { 1, 4 }){
+        jobs = jobCount;
+        testing::internal::CaptureStderr();
+        initCompiler(source);
+        outputs.push_back(testing::internal::GetCapturedStderr());
+        ASSERT_EQ(returnCode, compiler::ExitCode::IR_ERR);
+    }
+
+    EXPECT_TRUE(outputs[0].starts_with("Line 1,"));
+    EXPECT_FALSE(outputs[0].contains("Line 2,"));
+    EXPECT_EQ(outputs[0], outputs[1]);
+}
+
+TEST_F(CompilerFixture, TimePassesMeasuresEveryFunction){
+    __test__writeSourceToFile("int one(){ return 1; } int main(){ return one(); }", input);
+
+    util::timing::PassTimer timer;
+    returnCode = compiler::compileProgram({ .stopAfterAssembly = true, .input = input, .output = output }, &timer);
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+
+    EXPECT_EQ(timer.get(util::timing::Pass::READ_SOURCE).runs, 1);
+    EXPECT_EQ(timer.get(util::timing::Pass::TRANSLATION).runs, 1);
+    EXPECT_EQ(timer.get(util::timing::Pass::LOWERING).runs, 2);
+    EXPECT_EQ(timer.get(util::timing::Pass::FUNCTION_GENERATION).runs, 2);
+    EXPECT_EQ(timer.get(util::timing::Pass::ASSEMBLE_AND_LINK).runs, 0);
+
+    // estimated costs are reported next to the measured times of the per function passes
+    EXPECT_GT(timer.get(util::timing::Pass::LOWERING).cost, 0);
+    EXPECT_EQ(timer.get(util::timing::Pass::LOWERING).cost, timer.get(util::timing::Pass::FUNCTION_GENERATION).cost);
+    EXPECT_EQ(timer.get(util::timing::Pass::TRANSLATION).cost, 0);
+
+    // passes that did not run are left out of the report
+    std::stringstream report;
+    timer.write(report, util::timing::ReportFormat::JSON);
+    EXPECT_TRUE(report.str().contains("\"name\": \"ir lowering\", \"task\": true, \"runs\": 2"));
+    EXPECT_FALSE(report.str().contains("assemble and link"));
+    EXPECT_TRUE(report.str().contains("\"estimated_cost\": "));
+}
+
+TEST_F(CompilerFixture, TraceRecordsEveryFunction){
+    if(!util::tracing::compiledIn){
+        GTEST_SKIP() << "tracing is compiled out";
+    }
+
+    const std::string trace{ "tmp.json" };
+    __test__writeSourceToFile("int one(){ return 1; } int main(){ return one(); }", input);
+    returnCode = compiler::compile({ .stopAfterAssembly = true, .jobs = 2, .tracePath = trace, .input = input, .output = output });
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+
+    std::ifstream file{ trace };
+    ASSERT_TRUE(file.is_open());
+    std::stringstream events;
+    events << file.rdbuf();
+    __test__removeFile(trace);
+
+    EXPECT_TRUE(events.str().starts_with("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["));
+    EXPECT_TRUE(events.str().contains("\"args\": {\"name\": \"main\"}"));
+    EXPECT_TRUE(events.str().contains("\"name\": \"syntax analysis\", \"cat\": \"phase\""));
+    EXPECT_TRUE(events.str().contains("\"args\": {\"subject\": \"one\", \"cost\": "));
+    EXPECT_FALSE(util::tracing::enabled());
+}
+
+TEST(TraceTest, QueueWaitExcludesWorkOfTheTask){
+    if(!util::tracing::compiledIn){
+        GTEST_SKIP() << "tracing is compiled out";
+    }
+
+    const std::string trace{ "tmp.json" };
+    ASSERT_TRUE(util::tracing::start());
+    {
+        util::tracing::TaskScope task{ util::tracing::queuedAt() };
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        util::tracing::Scope scope{ "late", "phase" };
+    }
+    ASSERT_TRUE(util::tracing::write(trace));
+
+    std::ifstream file{ trace };
+    std::stringstream events;
+    events << file.rdbuf();
+    __test__removeFile(trace);
+
+    // event started late in the task waited in the queue only as long as the task did
+    const std::string& json{ events.str() };
+    const size_t event{ json.find("\"name\": \"late\"") };
+    ASSERT_NE(event, std::string::npos);
+    const std::string_view key{ "\"queue_wait_us\": " };
+    const size_t wait{ json.find(key, event) };
+    ASSERT_NE(wait, std::string::npos);
+    EXPECT_LT(std::stod(json.substr(wait + key.size())), 20000.0);
+}
+
+TEST_F(CompilerFixture, EmitInterface){
+    emitInterface = true;
+    initCompiler("void print_i(int number);\nunsigned add(unsigned a, int b);");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+
+    auto interface{ preprocessing::LibraryInterface::open(output + ".mcppi") };
+    ASSERT_TRUE(interface.has_value());
+
+    const auto& functions{ interface->getFunctions() };
+    ASSERT_EQ(functions.size(), 2);
+    EXPECT_EQ(functions[0].name, "print_i");
+    EXPECT_EQ(functions[0].type, types::Type::VOID);
+    ASSERT_EQ(functions[0].parameters.size(), 1);
+    EXPECT_EQ(functions[0].parameters[0].name, "number");
+    EXPECT_EQ(functions[0].parameters[0].type, types::Type::INT);
+    EXPECT_EQ(functions[1].name, "add");
+    EXPECT_EQ(functions[1].type, types::Type::UNSIGNED);
+    ASSERT_EQ(functions[1].parameters.size(), 2);
+    EXPECT_EQ(functions[1].parameters[1].type, types::Type::INT);
+}
+
+TEST_F(CompilerFixture, EmitInterfaceRejectsDefinition){
+    emitInterface = true;
+    initCompiler("int one(){ return 1; }");
+
+    ASSERT_EQ(returnCode, compiler::ExitCode::SEMANTIC_ERR);
+}
+
+TEST_F(CompilerFixture, IncludeThroughInterface){
+    const std::string libDir{ "./libmcpp/tmplib" };
+    const std::string libSource{ libDir + "/tmplib.mcpp" };
+    std::filesystem::create_directories(libDir);
+    createdDirs.push_back(libDir);
+    __test__writeSourceToFile("unsigned twice(unsigned value);", libSource);
+    ASSERT_EQ(compiler::emitLibraryInterface(libSource), compiler::ExitCode::NO_ERR);
+    ASSERT_TRUE(preprocessing::LibraryInterface::load("tmplib").has_value());
+
+    // signature of the interface is checked, library source is not spliced in
+    initCompiler("#include:tmplib\n int main(){ unsigned a = twice(2u); return 0; }");
+    EXPECT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+
+    initCompiler("#include:tmplib\n int main(){ unsigned a = twice(2); return 0; }");
+    EXPECT_EQ(returnCode, compiler::ExitCode::SEMANTIC_ERR);
+}
+
+TEST_F(CompilerFixture, StreamedIncludesMatchBatch){
+    const std::vector<std::pair<std::string, std::string>> libraries{
+        { "tmpouter", "#include:tmpinner\n int outer(int a){ return inner(a) + 1; }" },
+        { "tmpinner", "int inner(int a){ return a * 2; }" }
+    };
+    for(const auto& [name, source] : libraries){
+        const std::string libDir{ "./libmcpp/" + name };
+        std::filesystem::create_directories(libDir);
+        createdDirs.push_back(libDir);
+        __test__writeSourceToFile(source, libDir + "/" + name + ".mcpp");
+    }
+
+    // libraries are streamed after the source, their functions still precede it
+    std::vector<std::string> assembly;
+    jobs = 2;
+    for(const bool stream : { false, true }){
+        streamTokens = stream;
+        initCompiler("#include:tmpouter\n int main(){ return outer(2); }");
+        ASSERT_EQ(returnCode, compiler::ExitCode::NO_ERR);
+
+        std::ifstream file{ output + ".s" };
+        std::stringstream code;
+        code << file.rdbuf();
+        assembly.push_back(code.str());
+    }
+
+    EXPECT_LT(assembly[0].find("\ninner:"), assembly[0].find("\nmain:"));
+    EXPECT_EQ(assembly[0], assembly[1]);
+}
+
+TEST_F(CompilerOptionsTest, ParsesJobs){
+    EXPECT_EQ(parse({ "in.mcpp", "-j", "4" }).jobs, 4u);
+    EXPECT_EQ(parse({ "in.mcpp", "-j8" }).jobs, 8u);
+    EXPECT_THROW(parse({ "in.mcpp", "-j0" }), std::runtime_error);
+}
+
+TEST_F(CompilerOptionsTest, ParsesMaxErrors){
+    EXPECT_EQ(parse({ "in.mcpp", "-fmax-errors=5" }).maxErrors, 5u);
+    EXPECT_THROW(parse({ "in.mcpp", "-fmax-errors=" }), std::runtime_error);
+}
+
+TEST_F(CompilerOptionsTest, ParsesTimePasses){
+    EXPECT_EQ(parse({ "in.mcpp", "--time-passes" }).timePasses, util::timing::ReportFormat::TABLE);
+    EXPECT_EQ(parse({ "in.mcpp", "--time-passes=json" }).timePasses, util::timing::ReportFormat::JSON);
+    EXPECT_FALSE(parse({ "in.mcpp" }).timePasses.has_value());
 }
\ No newline at end of file
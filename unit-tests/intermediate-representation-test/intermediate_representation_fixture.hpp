@@ -19,12 +19,14 @@ protected:
 
 class StatementIntermediateRepresentationFixture : public StatementAnalyzerFixture {
 protected:
-    std::unique_ptr<ir::IRStmt> irStmt;
+    ir::IRArena irArena;
+    ir::IRPtr<ir::IRStmt> irStmt;
     std::unique_ptr<StatementIntermediateRepresentationTest> intermediateRepresentation;
     ir::IRFunctionContext ctx{};
 
     void initIR(){
         initAnalyzer();
+        ctx.arena = &irArena;
         intermediateRepresentation = std::make_unique<StatementIntermediateRepresentationTest>(ctx);
         irStmt = intermediateRepresentation->transformStmt(stmt.get());
     }
@@ -32,12 +34,14 @@ protected:
 
 class ExpressionIntermediateRepresentationFixture : public ExpressionAnalyzerFixture {
 protected:
-    std::unique_ptr<ir::IRExpr> irExpr;
+    ir::IRArena irArena;
+    ir::IRPtr<ir::IRExpr> irExpr;
     std::unique_ptr<ExpressionIntermediateRepresentationTest> intermediateRepresentation;
     ir::IRFunctionContext ctx{};
 
     void initIR(){
         initAnalyzer();
+        ctx.arena = &irArena;
         intermediateRepresentation = std::make_unique<ExpressionIntermediateRepresentationTest>(ctx);
         irExpr = intermediateRepresentation->transformExpr(expr.get());
     }
@@ -18,7 +18,26 @@ TEST_F(IntermediateRepresentationFixture, FormIRThrows){
     initIR();
 
     ASSERT_TRUE(intermediateRepresentation->hasErrors(irProgram.get()));
-    EXPECT_TRUE(intermediateRepresentation->getErrors("main")[0].contains("division by ZERO"));
+    EXPECT_TRUE(intermediateRepresentation->getErrors(irProgram.get(), "main")[0].contains("division by ZERO"));
+}
+
+TEST_F(IntermediateRepresentationFixture, NodesPlacedIntoFunctionArena){
+    input = {"int fun(int x){ if(x) return 1 + 2; return x; } int main(){ return fun(1); }"};
+    initIR();
+
+    ASSERT_EQ(irProgram->getFunctionCount(), 2);
+
+    ir::IRFunction* fun{ irProgram->getFunctions()[0].get() };
+    ir::IRFunction* main{ irProgram->getFunctions()[1].get() };
+    const auto* funResource{ fun->getArena().getAllocator().resource() };
+
+    EXPECT_NE(funResource, main->getArena().getAllocator().resource());
+    EXPECT_EQ(fun->getParameters().get_allocator().resource(), funResource);
+    EXPECT_EQ(fun->getBody().get_allocator().resource(), funResource);
+
+    const auto* ifStmt{ static_cast<const ir::IRIfStmt*>(fun->getBody()[0].get()) };
+    ASSERT_EQ(ifStmt->getNodeType(), ir::IRNodeType::IF);
+    EXPECT_EQ(ifStmt->getStmts().get_allocator().resource(), funResource);
 }
 
 TEST_F(IntermediateRepresentationFixture, FunctionDeadCodeElimination){
@@ -63,7 +82,7 @@ TEST_F(IntermediateRepresentationFixture, FunctionDeadCodeEliminationDoWhile){
 
 TEST_F(StatementIntermediateRepresentationFixture, CompoundStatementDeadCodeElimination){
     input = {"{ return 0; if(1 > 2) return 1; }"};
-    scopeManager.pushSymbol(semantic::Symbol{"tmp", semantic::Kind::FUN, types::Type::INT});
+    functionTable.declare(util::text::StringInterner::intern("tmp"), types::Type::INT);
     initIR();
 
     constexpr size_t expectedStmtCount{1};
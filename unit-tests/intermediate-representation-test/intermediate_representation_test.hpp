@@ -11,9 +11,14 @@ class IntermediateRepresentationTest : public ir::IntermediateRepresentation {
         IntermediateRepresentationTest(util::concurrency::ThreadPool& threadPool) 
             : ir::IntermediateRepresentation{ threadPool } {}
 
-        const std::vector<std::string>& getErrors(const std::string& func) const noexcept {
-            assert(exceptions.find(func) != exceptions.end());
-            return exceptions.at(func);
+        const std::vector<std::string>& getErrors(const ir::IRProgram* program, std::string_view func) const noexcept {
+            const auto funcId{ util::text::StringInterner::intern(func) };
+            size_t position{ 0 };
+            while(position < program->getFunctionCount() && program->getFunctionAtN(position)->getSymbolId() != funcId){
+                ++position;
+            }
+            assert(position < exceptions.size());
+            return exceptions[position];
         }
 };
 
@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "lexer_test.hpp"
@@ -10,10 +12,12 @@
 class LexerFixture : public ::testing::Test {
 protected:
     std::vector<std::string> input;
+    std::vector<std::string_view> inputViews;
     std::unique_ptr<LexerTest> lexer;
 
     void initLexer() {
-        lexer = std::make_unique<LexerTest>(input);
+        inputViews.assign(input.begin(), input.end());
+        lexer = std::make_unique<LexerTest>(inputViews);
         lexer->tokenize();
     }
 
@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 #include <utility>
 #include <array>
+#include <tuple>
+#include <string>
 #include <string_view>
+#include <filesystem>
 
 #include "lexer_fixture.hpp"
+#include "../test-utils/test_utils.hpp"
 
 TEST_F(LexerFixture, TokenizationOfAssignmentStatement){
     input = {"int x = -1 + 2 << 3u;"};
@@ -28,7 +32,7 @@ TEST_F(LexerFixture, TokenizationOfAssignmentStatement){
     for(size_t i = 0; i < expectedSize; ++i){
         SCOPED_TRACE("Token index: " + std::to_string(i));
         EXPECT_EQ(lexer->at(i).type, expectedTokens[i].first);
-        EXPECT_EQ(lexer->at(i).value, expectedTokens[i].second);
+        EXPECT_EQ(lexer->at(i).value(), expectedTokens[i].second);
     }
 }
 
@@ -56,7 +60,7 @@ TEST_F(LexerFixture, TokenizationOfIfStatement){
     for(size_t i = 0; i < expectedSize; ++i){
         SCOPED_TRACE("Token index: " + std::to_string(i));
         EXPECT_EQ(lexer->at(i).type, expectedTokens[i].first);
-        EXPECT_EQ(lexer->at(i).value, expectedTokens[i].second);
+        EXPECT_EQ(lexer->at(i).value(), expectedTokens[i].second);
     }
 }
 
@@ -96,4 +100,194 @@ TEST_F(LexerFixture, ThrowsOnInvalidMultiLineComment){
     initLexer();
 
     ASSERT_TRUE(lexer->hasErrors());
-}
\ No newline at end of file
+}
+TEST_F(LexerFixture, DecodesTokenPositions){
+    input = {"int x;\n  return x;", "\nfun()"};
+    initLexer();
+
+    constexpr std::array<std::tuple<std::string_view, size_t, size_t>, 8> expectedPositions {{
+        {"int", 1, 0},
+        {"x", 1, 4},
+        {";", 1, 5},
+        {"return", 2, 2},
+        {"x", 2, 9},
+        {";", 2, 10},
+        {"fun", 2, 0},
+        {"(", 2, 3}
+    }};
+
+    for(size_t i = 0; i < expectedPositions.size(); ++i){
+        SCOPED_TRACE("Token index: " + std::to_string(i));
+        const auto& [value, line, column]{ expectedPositions[i] };
+        EXPECT_EQ(lexer->at(i).value(), value);
+        EXPECT_EQ(lexer->at(i).line(), line);
+        EXPECT_EQ(lexer->at(i).column(), column);
+    }
+
+    const auto& eof{ lexer->at(lexer->tokensSize() - 1) };
+    EXPECT_EQ(eof.type, syntax::TokenType::_EOF);
+    EXPECT_EQ(eof.line(), 2);
+    EXPECT_EQ(eof.column(), 5);
+}
+
+TEST_F(LexerFixture, ScanKernelsStopAtRunEnd){
+    constexpr size_t maxLength{ 80 };
+
+    for(size_t stop = 0; stop < maxLength; ++stop){
+        SCOPED_TRACE("Stop index: " + std::to_string(stop));
+
+        std::string identifier(maxLength, 'a');
+        identifier[stop] = '+';
+        EXPECT_EQ(lex::scan::skipIdentifier(identifier, 0), stop);
+
+        std::string spaces(maxLength, ' ');
+        spaces[stop] = '\n';
+        EXPECT_EQ(lex::scan::skipWhitespace(spaces, 0), stop);
+
+        std::string digits(maxLength, '7');
+        digits[stop] = 'u';
+        EXPECT_EQ(lex::scan::skipDigits(digits, 0), stop);
+
+        std::string comment(maxLength, '/');
+        comment[stop] = '*';
+        EXPECT_EQ(lex::scan::findCommentStop(comment, 0), stop);
+        comment[stop] = '\n';
+        EXPECT_EQ(lex::scan::findNewline(comment, 0), stop);
+        EXPECT_EQ(lex::scan::findNewline(comment.substr(0, stop), 0), stop);
+    }
+}
+
+TEST_F(LexerFixture, TokenizationOfLongRuns){
+    const std::string longId(70, 'x');
+    const std::string banner(100, '*');
+    input = {"/" + banner + "/\n" + std::string(40, ' ') + "int " + longId + "_9 = 1234567890123456789012345678901234567890u; // " + banner + "\nreturn"};
+    initLexer();
+
+    ASSERT_FALSE(lexer->hasErrors());
+    ASSERT_EQ(lexer->tokensSize(), 7);
+
+    EXPECT_EQ(lexer->at(0).type, syntax::TokenType::INT);
+    EXPECT_EQ(lexer->at(0).line(), 2);
+    EXPECT_EQ(lexer->at(0).column(), 40);
+    EXPECT_EQ(lexer->at(1).value(), longId + "_9");
+    EXPECT_EQ(lexer->at(3).value(), "1234567890123456789012345678901234567890u");
+    EXPECT_EQ(lexer->at(5).type, syntax::TokenType::RETURN);
+    EXPECT_EQ(lexer->at(5).line(), 3);
+}
+
+TEST_F(LexerFixture, ParallelTokenizationMatchesSerial){
+    input = {
+        "int main(){\n  return fun(-1) . 2;\n}",
+        "-5 + x",
+        "",
+        "void fun(int a){ a = a - 1; $ }\n/* unterminated"
+    };
+    initLexer();
+
+    util::concurrency::ThreadPool threadPool{ 4 };
+    LexerTest parallelLexer{ inputViews };
+    parallelLexer.tokenize(threadPool);
+
+    ASSERT_EQ(parallelLexer.tokensSize(), lexer->tokensSize());
+    for(size_t i = 0; i < lexer->tokensSize(); ++i){
+        SCOPED_TRACE("Token index: " + std::to_string(i));
+        EXPECT_EQ(parallelLexer.at(i).type, lexer->at(i).type);
+        EXPECT_EQ(parallelLexer.at(i).value(), lexer->at(i).value());
+        EXPECT_EQ(parallelLexer.at(i).line(), lexer->at(i).line());
+        EXPECT_EQ(parallelLexer.at(i).column(), lexer->at(i).column());
+    }
+
+    EXPECT_EQ(lexer->at(10).type, syntax::TokenType::INVALID);
+    EXPECT_EQ(lexer->at(14).type, syntax::TokenType::MINUS);
+    EXPECT_EQ(parallelLexer.getErrors(), lexer->getErrors());
+    EXPECT_TRUE(parallelLexer.hasErrors());
+}
+
+TEST_F(LexerFixture, ResolvesIncludesWhileTokenizing){
+    const std::string libA{ "#include:lexincb\nvoid a(int x);" };
+    const std::string libB{ "void b(int y);" };
+    std::filesystem::create_directories("./libmcpp/lexinca");
+    std::filesystem::create_directories("./libmcpp/lexincb");
+    __test__writeSourceToFile(libA, "./libmcpp/lexinca/lexinca.mcpp");
+    __test__writeSourceToFile(libB, "./libmcpp/lexincb/lexincb.mcpp");
+
+    // libraries precede the file that included them first, commented include is not requested
+    const std::string source{ "#include:lexinca\n#include:lexincb\n// #include:lexincmissing\nint main(){ return 0; }" };
+    input = { libB, libA, source };
+    initLexer();
+
+    util::concurrency::ThreadPool threadPool{ 2 };
+    for(bool concurrent : { false, true }){
+        SCOPED_TRACE(concurrent ? "concurrent" : "serial");
+        preprocessing::Preprocessor preprocessor{ threadPool };
+        LexerTest includingLexer{ source, preprocessor };
+        if(concurrent){
+            includingLexer.tokenize(threadPool);
+        }
+        else {
+            includingLexer.tokenize();
+        }
+
+        EXPECT_FALSE(preprocessor.hasErrors());
+        ASSERT_EQ(includingLexer.tokensSize(), lexer->tokensSize());
+        for(size_t i = 0; i < lexer->tokensSize(); ++i){
+            SCOPED_TRACE("Token index: " + std::to_string(i));
+            EXPECT_EQ(includingLexer.at(i).type, lexer->at(i).type);
+            EXPECT_EQ(includingLexer.at(i).value(), lexer->at(i).value());
+        }
+    }
+
+    std::filesystem::remove_all("./libmcpp/lexinca");
+    std::filesystem::remove_all("./libmcpp/lexincb");
+}
+
+TEST_F(LexerFixture, ReportsMissingInclude){
+    preprocessing::Preprocessor preprocessor;
+    LexerTest includingLexer{ "#include:lexincmissing\nint main(){ return 0; }", preprocessor };
+    includingLexer.tokenize();
+
+    EXPECT_TRUE(preprocessor.hasErrors());
+    EXPECT_FALSE(includingLexer.hasErrors());
+    EXPECT_EQ(includingLexer.at(0).type, syntax::TokenType::HASH);
+}
+
+TEST_F(LexerFixture, ClassifiesKeywordsWithPerfectHash){
+    std::string source;
+    for(const auto& keyword : lex::keywordTable){
+        source += std::string{ keyword.spelling } + " ";
+    }
+
+    // share length, first or last characters with the keywords
+    const std::array<std::string_view, 10> identifiers{
+        "in", "iff", "Int", "intt", "unsigne", "unsigner", "retur", "returm", "da", "if_"
+    };
+    for(std::string_view identifier : identifiers){
+        source += std::string{ identifier } + " ";
+    }
+
+    input = {source};
+    initLexer();
+
+    ASSERT_FALSE(lexer->hasErrors());
+    ASSERT_EQ(lexer->tokensSize(), lex::keywordTable.size() + identifiers.size() + 1);
+
+    for(size_t i = 0; i < lex::keywordTable.size(); ++i){
+        EXPECT_EQ(lexer->at(i).type, lex::keywordTable[i].type);
+        EXPECT_EQ(lexer->at(i).gtype, lex::keywordTable[i].gtype);
+    }
+    for(size_t i = 0; i < identifiers.size(); ++i){
+        EXPECT_EQ(lexer->at(lex::keywordTable.size() + i).type, syntax::TokenType::ID);
+    }
+}
+
+TEST_F(LexerFixture, ReleasesSourcesWithTheLexer){
+    // more lexers than there are source ids, each one releases its ids when it is destroyed
+    input = {"int x;", "int y;"};
+    for(size_t i = 0; i < 40000; ++i){
+        initLexer();
+    }
+
+    ASSERT_FALSE(lexer->hasErrors());
+    EXPECT_EQ(lexer->at(3).line(), 1);
+    EXPECT_EQ(lexer->at(4).column(), 4);
+}
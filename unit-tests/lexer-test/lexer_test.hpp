@@ -2,11 +2,15 @@
 #define LEXER_TEST_HPP
 
 #include "../../lexer/lexer.hpp"
+#include "../../preprocessor/preprocessor.hpp"
 #include <cassert>
 
 class LexerTest : public lex::Lexer {
     public:
-        LexerTest(std::vector<std::string>& input) : lex::Lexer{ input } {}
+        LexerTest(std::vector<std::string_view>& input) : lex::Lexer{ input } {}
+
+        LexerTest(std::string_view source, preprocessing::Preprocessor& preprocessor) 
+            : lex::Lexer{ source, preprocessor } {}
 
         const syntax::Token& at(size_t i) const{
             assert(i < tokens.size());
@@ -20,36 +20,39 @@ protected:
 
 class FunctionParserFixture : public LexerFixture {
 protected:
-    std::unique_ptr<syntax::ast::ASTFunction> function;
+    syntax::ast::ASTArena arena;
+    syntax::ast::ASTPtr<syntax::ast::ASTFunction> function;
 
     void initParser(){
         initLexer();
         syntax::TokenConsumer tokenConsumer{ *lexer };
-        FunctionParserTest parser{ tokenConsumer };
+        FunctionParserTest parser{ tokenConsumer, arena };
         function = parser.parseFunction();
     }
 };
 
 class StatementParserFixture : public LexerFixture {
 protected:
-    std::unique_ptr<syntax::ast::ASTStmt> stmt;
+    syntax::ast::ASTArena arena;
+    syntax::ast::ASTPtr<syntax::ast::ASTStmt> stmt;
     
     void initParser() {
         initLexer();
         syntax::TokenConsumer tokenConsumer{ *lexer };
-        StatementParserTest stmtParser{ tokenConsumer };
+        StatementParserTest stmtParser{ tokenConsumer, arena };
         stmt = stmtParser.parseStmt();
     }
 };
 
 class ExpressionParserFixture : public LexerFixture {
 protected:
-    std::unique_ptr<syntax::ast::ASTExpr> expr;
+    syntax::ast::ASTArena arena;
+    syntax::ast::ASTPtr<syntax::ast::ASTExpr> expr;
     
     void initParser() {
         initLexer();
         syntax::TokenConsumer tokenConsumer{ *lexer };
-        ExpressionParserTest exprParser{ tokenConsumer };
+        ExpressionParserTest exprParser{ tokenConsumer, arena };
         expr = exprParser.parseExpr();
     }
 };
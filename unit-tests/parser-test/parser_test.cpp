@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include <stdexcept>
+#include <sstream>
+#include <vector>
 
 #include "parser_fixture.hpp"
+#include "../../common/dump/ast_dumper.hpp"
+#include "../../parser/parallel_parser.hpp"
 
 TEST_F(ParserFixture, ParseProgramSuccessful){
     input = {"int fun(){ return 123; } int main(){ int a = 1 + 2; return a; }" };
@@ -18,6 +22,115 @@ TEST_F(ParserFixture, ParseProgramThrows){
     ASSERT_THROW(initParser(), std::runtime_error);
 }
 
+TEST_F(ParserFixture, StreamedParsingMatchesSerial){
+    input = {
+        "int fun(int x){ if(x > 0){ return x - 1; } else { return -1; } }",
+        "int main(){ int a = fun(3) << 2; while(a > 0){ a = a - 1; } return a; }"
+    };
+    initParser();
+
+    std::stringstream serialDump;
+    syntax::ast::ASTDumper serialDumper{ serialDump };
+    serialDumper.visitNode(program);
+
+    util::concurrency::ThreadPool threadPool{ 1 };
+    LexerTest streamedLexer{ inputViews };
+
+    // ring smaller than the program, producer has to wait for the parser to release slots
+    streamedLexer.startStreaming(threadPool, 4);
+    syntax::TokenConsumer tokenConsumer{ streamedLexer };
+    ParserTest parser{ tokenConsumer };
+    std::unique_ptr<syntax::ast::ASTProgram> streamedProgram{ parser.parseProgram() };
+    streamedLexer.finishStreaming();
+
+    std::stringstream streamedDump;
+    syntax::ast::ASTDumper streamedDumper{ streamedDump };
+    streamedDumper.visitNode(streamedProgram);
+
+    EXPECT_FALSE(streamedLexer.hasErrors());
+    EXPECT_EQ(streamedDump.str(), serialDump.str());
+}
+
+TEST_F(ParserFixture, ParallelParsingMatchesSerial){
+    input = {
+        "#include:libio\n int fun(int x){ if(x > 0){ return x - 1; } else { return -1; } }",
+        "int decl(int a); int loop(int n){ int i; for(i = 0; i < n; i = i + 1){ { n = n - 1; } } return n; }",
+        "int main(){ int a = fun(3) << 2; switch(a){ case 1: a = 2; break; default: a = 3; } return loop(a); }"
+    };
+    initParser();
+
+    std::stringstream serialDump;
+    syntax::ast::ASTDumper serialDumper{ serialDump };
+    serialDumper.visitNode(program);
+
+    util::concurrency::ThreadPool threadPool{ 2 };
+    syntax::ParallelParser parser{ *lexer, threadPool };
+    std::unique_ptr<syntax::ast::ASTProgram> parallelProgram{ parser.parseProgram() };
+
+    std::stringstream parallelDump;
+    syntax::ast::ASTDumper parallelDumper{ parallelDump };
+    parallelDumper.visitNode(parallelProgram);
+
+    EXPECT_EQ(parallelProgram->getFunctionCount(), 4);
+    EXPECT_EQ(parallelDump.str(), serialDump.str());
+    for(size_t i{ 0 }; i < program->getFunctionCount(); ++i){
+        EXPECT_EQ(parallelProgram->getFunctionAtN(i)->getCost(), program->getFunctionAtN(i)->getCost());
+    }
+}
+
+TEST_F(ParserFixture, ParallelParsingReportsSerialError){
+    const std::vector<std::vector<std::string>> inputs{
+        // error inside of a balanced function
+        { "int fun(){ return 1; } int main(){ int a = ; return a; } int last(){ return 2 }" },
+        // unbalanced braces, pre-scan gives up
+        { "int fun(){ return 1; } int main(){ { return 0; }" },
+        // unknown top level token
+        { "int fun(){ return 1; } return 2;" }
+    };
+
+    util::concurrency::ThreadPool threadPool{ 2 };
+    for(const auto& source : inputs){
+        input = source;
+        initLexer();
+
+        std::string serialError;
+        try{
+            syntax::TokenConsumer tokenConsumer{ *lexer };
+            ParserTest serialParser{ tokenConsumer };
+            (void)serialParser.parseProgram();
+        }
+        catch(const std::runtime_error& e){
+            serialError = e.what();
+        }
+        ASSERT_FALSE(serialError.empty());
+
+        initLexer();
+        syntax::ParallelParser parser{ *lexer, threadPool };
+        try{
+            (void)parser.parseProgram();
+            ADD_FAILURE() << "parallel parser accepted: " << source.front();
+        }
+        catch(const std::runtime_error& e){
+            EXPECT_EQ(e.what(), serialError);
+        }
+    }
+}
+
+TEST_F(ParserFixture, NodesPlacedIntoProgramArena){
+    input = {"int fun(int x, int y){ { x = fun(x, y); } return x; } int main(){ return fun(1, 2); }"};
+    ASSERT_NO_THROW(initParser());
+
+    const auto* arenaResource{ program->getArena().getAllocator().resource() };
+    const auto* function{ program->getFunctionAtN(0) };
+
+    EXPECT_EQ(function->getParameters().get_allocator().resource(), arenaResource);
+    EXPECT_EQ(function->getBody().get_allocator().resource(), arenaResource);
+
+    const auto* compoundStmt{ static_cast<const syntax::ast::ASTCompoundStmt*>(function->getBody()[0].get()) };
+    ASSERT_EQ(compoundStmt->getNodeType(), syntax::ast::ASTNodeType::COMPOUND_STMT);
+    EXPECT_EQ(compoundStmt->getStmts().get_allocator().resource(), arenaResource);
+}
+
 TEST_F(FunctionParserFixture, FunctionMultipleParams){
     input = {"int rectArea(int a, int b){ return a * b; }"};
     ASSERT_NO_THROW(initParser());
@@ -28,6 +141,15 @@ TEST_F(FunctionParserFixture, FunctionMultipleParams){
     EXPECT_EQ(function->getParameterCount(), expectedParamCount);
 }
 
+TEST_F(FunctionParserFixture, FunctionCostCountsTokens){
+    input = {"int sq(int a){ return a * a; }"};
+    ASSERT_NO_THROW(initParser());
+
+    constexpr size_t expectedCost{ 13 };
+
+    EXPECT_EQ(function->getCost(), expectedCost);
+}
+
 TEST_F(FunctionParserFixture, FunctionSingleParam){
     input = {"int sq(int a){ return a * a; }"};
     ASSERT_NO_THROW(initParser());
@@ -244,7 +366,7 @@ TEST_F(ExpressionParserFixture, FunctionCallNoArgs){
 
     auto callExpr{ static_cast<syntax::ast::ASTFunctionCallExpr*>(expr.get()) };
     EXPECT_TRUE(callExpr->getArgumentCount() == 0);
-    EXPECT_EQ(callExpr->getToken().value, "fun");
+    EXPECT_EQ(callExpr->getToken().value(), "fun");
 }
 
 TEST_F(ExpressionParserFixture, FunctionCallSingleArg){
@@ -257,7 +379,7 @@ TEST_F(ExpressionParserFixture, FunctionCallSingleArg){
 
     auto callExpr{ static_cast<syntax::ast::ASTFunctionCallExpr*>(expr.get()) };
     EXPECT_EQ(callExpr->getArgumentCount(), expectedArgumentCount);
-    EXPECT_EQ(callExpr->getToken().value, "fun");
+    EXPECT_EQ(callExpr->getToken().value(), "fun");
 }
 
 TEST_F(ExpressionParserFixture, FunctionCallMultipleArgs){
@@ -270,7 +392,7 @@ TEST_F(ExpressionParserFixture, FunctionCallMultipleArgs){
 
     auto callExpr{ static_cast<syntax::ast::ASTFunctionCallExpr*>(expr.get()) };
     EXPECT_EQ(callExpr->getArgumentCount(), expectedArgumentCount);
-    EXPECT_EQ(callExpr->getToken().value, "fun");
+    EXPECT_EQ(callExpr->getToken().value(), "fun");
 }
 
 TEST_F(ExpressionParserFixture, FunctionCallInvalidArgs){
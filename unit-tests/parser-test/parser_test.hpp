@@ -11,20 +11,20 @@ class ParserTest : public syntax::Parser {
 
 class FunctionParserTest : public syntax::FunctionParser {
     public:
-        FunctionParserTest(syntax::TokenConsumer& consumer) 
-            : syntax::FunctionParser{ consumer } {}
+        FunctionParserTest(syntax::TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+            : syntax::FunctionParser{ consumer, arena } {}
 };
 
 class StatementParserTest : public syntax::StatementParser {
 public:
-    StatementParserTest(syntax::TokenConsumer& consumer) 
-        : syntax::StatementParser{ consumer } {}
+    StatementParserTest(syntax::TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+        : syntax::StatementParser{ consumer, arena } {}
 };
 
 class ExpressionParserTest : public syntax::ExpressionParser {
     public:
-        ExpressionParserTest(syntax::TokenConsumer& consumer) 
-            : syntax::ExpressionParser{ consumer } {}
+        ExpressionParserTest(syntax::TokenConsumer& consumer, syntax::ast::ASTArena& arena) 
+            : syntax::ExpressionParser{ consumer, arena } {}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../../common/source/mapped_file.hpp"
+#include "../test-utils/test_utils.hpp"
+
+TEST(MappedFileTest, MissingFileIsNotOpen){
+    const util::io::MappedFile file{ "missing.mcpp" };
+
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file.view().empty());
+}
+
+TEST(MappedFileTest, EmptyFileHasEmptyView){
+    const std::string path{ "tmp_empty.mcpp" };
+    __test__writeSourceToFile("", path);
+    const util::io::MappedFile file{ path };
+    __test__removeFile(path);
+
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_TRUE(file.view().empty());
+}
+
+TEST(MappedFileTest, MoveLeavesSourceEmpty){
+    const std::string path{ "tmp_move.mcpp" };
+    __test__writeSourceToFile("int main(){ return 0; }", path);
+    util::io::MappedFile source{ path };
+    __test__removeFile(path);
+    ASSERT_TRUE(source.isOpen());
+    const std::string_view contents{ source.view() };
+
+    // mapping changes its owner, views into it stay valid
+    util::io::MappedFile moved{ std::move(source) };
+    EXPECT_FALSE(source.isOpen());
+    EXPECT_TRUE(source.view().empty());
+    EXPECT_TRUE(moved.isOpen());
+    EXPECT_EQ(moved.view().data(), contents.data());
+    EXPECT_EQ(contents, "int main(){ return 0; }");
+
+    util::io::MappedFile assigned;
+    assigned = std::move(moved);
+    EXPECT_FALSE(moved.isOpen());
+    EXPECT_TRUE(moved.view().empty());
+    EXPECT_EQ(assigned.view(), "int main(){ return 0; }");
+}
\ No newline at end of file
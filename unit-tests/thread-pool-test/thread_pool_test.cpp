@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../../thread-pool/thread_pool.hpp"
+#include "../../thread-pool/task_group.hpp"
+#include "../../thread-pool/work_stealing_deque.hpp"
+#include "../../thread-pool/cancellation_token.hpp"
+
+TEST(WorkStealingDequeTest, OwnerPopsNewestThiefStealsOldest){
+    // more elements than the initial capacity, deque has to grow
+    util::concurrency::WorkStealingDeque<int*> deque{ 4 };
+    std::vector<int> values(10);
+    for(auto& value : values){
+        deque.push(&value);
+    }
+
+    EXPECT_EQ(deque.pop(), &values[9]);
+    EXPECT_EQ(deque.steal(), &values[0]);
+    EXPECT_EQ(deque.steal(), &values[1]);
+    EXPECT_EQ(deque.pop(), &values[8]);
+
+    size_t remaining{ 0 };
+    while(deque.pop()){
+        ++remaining;
+    }
+    EXPECT_EQ(remaining, 6u);
+    EXPECT_TRUE(deque.empty());
+    EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST(WorkStealingDequeTest, EveryElementIsTakenOnce){
+    constexpr size_t count{ 20000 };
+    util::concurrency::WorkStealingDeque<size_t*> deque{ 16 };
+    std::vector<size_t> values(count);
+    std::vector<std::atomic<int>> taken(count);
+
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> thieves;
+    for(size_t t{ 0 }; t < 3; ++t){
+        thieves.emplace_back(
+            [&] -> void {
+                while(!done.load() || !deque.empty()){
+                    if(size_t* value{ deque.steal() }){
+                        taken[*value].fetch_add(1);
+                    }
+                }
+            }
+        );
+    }
+
+    for(size_t i{ 0 }; i < count; ++i){
+        values[i] = i;
+        deque.push(&values[i]);
+        if(i % 3 == 0){
+            if(size_t* value{ deque.pop() }){
+                taken[*value].fetch_add(1);
+            }
+        }
+    }
+    done.store(true);
+    for(auto& thief : thieves){
+        thief.join();
+    }
+
+    for(const auto& times : taken){
+        EXPECT_EQ(times.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, RunsNestedTasks){
+    util::concurrency::ThreadPool threadPool{ 4 };
+
+    // every task below the depth spawns two more from inside of the pool
+    constexpr size_t depth{ 10 };
+    constexpr size_t taskCount{ (1u << (depth + 1)) - 1 };
+    std::atomic<size_t> executed{ 0 };
+    std::latch doneLatch{ static_cast<std::ptrdiff_t>(taskCount) };
+
+    std::function<void(size_t)> spawn{
+        [&](size_t level) -> void {
+            threadPool.enqueue(
+                [&, level] -> void {
+                    if(level < depth){
+                        spawn(level + 1);
+                        spawn(level + 1);
+                    }
+                    executed.fetch_add(1);
+                    doneLatch.count_down();
+                }
+            );
+        }
+    };
+    spawn(0);
+    doneLatch.wait();
+
+    EXPECT_EQ(executed.load(), taskCount);
+}
+
+TEST(ThreadPoolTest, PoolWithoutWorkersRunsTaskOnEnqueue){
+    util::concurrency::ThreadPool threadPool{ 0 };
+
+    size_t executed{ 0 };
+    threadPool.enqueue([&executed] -> void { ++executed; });
+
+    EXPECT_EQ(executed, 1u);
+}
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks){
+    std::atomic<size_t> executed{ 0 };
+    {
+        util::concurrency::ThreadPool threadPool{ 2 };
+        for(size_t i{ 0 }; i < 1000; ++i){
+            threadPool.enqueue([&executed] -> void { executed.fetch_add(1); });
+        }
+    }
+
+    EXPECT_EQ(executed.load(), 1000u);
+}
+
+TEST(TaskGroupTest, ParallelForVisitsEveryIndexOnce){
+    util::concurrency::ThreadPool threadPool{ 4 };
+
+    constexpr size_t count{ 10000 };
+    std::vector<std::atomic<int>> visited(count);
+    for(size_t grain : { 0u, 1u, 7u, 20000u }){
+        util::concurrency::parallelFor(threadPool, 0, count, grain,
+            [&visited](size_t i) -> void {
+                visited[i].fetch_add(1);
+            }
+        );
+    }
+
+    for(const auto& times : visited){
+        EXPECT_EQ(times.load(), 4);
+    }
+}
+
+TEST(TaskGroupTest, WaitingThreadRunsTasks){
+    // pool without workers, only the waiting thread executes the tasks
+    util::concurrency::ThreadPool threadPool{ 0 };
+
+    size_t executed{ 0 };
+    util::concurrency::parallelFor(threadPool, 0, 100, 1,
+        [&executed](size_t) -> void {
+            ++executed;
+        }
+    );
+
+    EXPECT_EQ(executed, 100u);
+}
+
+TEST(TaskGroupTest, WaitRethrowsTaskException){
+    util::concurrency::ThreadPool threadPool{ 2 };
+
+    std::atomic<size_t> executed{ 0 };
+    util::concurrency::TaskGroup group{ threadPool };
+    for(size_t i{ 0 }; i < 100; ++i){
+        group.run(
+            [&executed, i] -> void {
+                executed.fetch_add(1);
+                if(i == 50){
+                    throw std::runtime_error("task failed");
+                }
+            }
+        );
+    }
+
+    // exception is rethrown once every task finished
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(executed.load(), 100u);
+    EXPECT_NO_THROW(group.wait());
+}
+
+TEST(TaskGroupTest, ScheduleByCostStartsWithMostExpensive){
+    std::vector<size_t> costs(100, 1);
+    costs[70] = 1000;
+    costs[10] = 500;
+
+    const auto schedule{ util::concurrency::scheduleByCost(costs, 2) };
+
+    // expensive functions get tasks of their own, cheap ones are batched
+    ASSERT_GE(schedule.taskEnds.size(), 3u);
+    EXPECT_LT(schedule.taskEnds.size(), costs.size());
+    EXPECT_EQ(schedule.taskEnds[0], 1u);
+    EXPECT_EQ(schedule.indices[0], 70u);
+    EXPECT_EQ(schedule.taskEnds[1], 2u);
+    EXPECT_EQ(schedule.indices[1], 10u);
+    EXPECT_EQ(schedule.taskEnds.back(), costs.size());
+
+    std::vector<size_t> sorted{ schedule.indices };
+    std::ranges::sort(sorted);
+    for(size_t i{ 0 }; i < sorted.size(); ++i){
+        EXPECT_EQ(sorted[i], i);
+    }
+}
+
+TEST(TaskGroupTest, ParallelForByCostVisitsEveryIndexOnce){
+    util::concurrency::ThreadPool threadPool{ 4 };
+
+    constexpr size_t count{ 1000 };
+    std::vector<std::atomic<int>> visited(count);
+    util::concurrency::parallelForByCost(threadPool, count,
+        [](size_t i) -> size_t { return i % 10 == 0 ? i * 100 : i % 7; },
+        [&visited](size_t i) -> void {
+            visited[i].fetch_add(1);
+        }
+    );
+
+    for(const auto& times : visited){
+        EXPECT_EQ(times.load(), 1);
+    }
+}
+
+TEST(TaskGroupTest, CancelledParallelForSkipsPendingIndices){
+    util::concurrency::ThreadPool threadPool{ 2 };
+
+    // token set before the loop drops every task
+    util::concurrency::CancellationToken cancelled;
+    cancelled.cancel();
+    std::atomic<size_t> visited{ 0 };
+    util::concurrency::parallelFor(threadPool, 0, 1000, 1,
+        [&visited](size_t) -> void { visited.fetch_add(1); },
+        &cancelled
+    );
+    EXPECT_EQ(visited.load(), 0);
+
+    // token set by the reported errors stops the loop at the next index
+    util::concurrency::ThreadPool serialPool{ 0 };
+    util::concurrency::CancellationToken limited{ 3 };
+    util::concurrency::parallelFor(serialPool, 0, 1000, 0,
+        [&visited, &limited](size_t) -> void {
+            visited.fetch_add(1);
+            limited.reportErrors(1);
+        },
+        &limited
+    );
+    EXPECT_TRUE(limited.isCancelled());
+    EXPECT_EQ(visited.load(), 3);
+}
+
+TEST(TaskGroupTest, OrderedTokenStopsOnlyLaterItems){
+    util::concurrency::CancellationToken ordered{ 1, 4 };
+
+    // errors of the later item do not stop the earlier ones
+    ordered.reportErrors(2, 1);
+    ordered.finishItem(2);
+    EXPECT_FALSE(ordered.isCancelled(0));
+    EXPECT_FALSE(ordered.isCancelled(3));
+
+    ordered.finishItem(0);
+    ordered.reportErrors(1, 1);
+    EXPECT_FALSE(ordered.isCancelled(0));
+    EXPECT_TRUE(ordered.isCancelled(1));
+    EXPECT_TRUE(ordered.isCancelled(3));
+    EXPECT_FALSE(ordered.isCancelled());
+    EXPECT_EQ(ordered.getReportedErrors(), 2);
+}
\ No newline at end of file